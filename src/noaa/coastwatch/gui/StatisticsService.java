@@ -0,0 +1,539 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: StatisticsService.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.gui;
+
+// Imports
+// -------
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import javax.swing.SwingUtilities;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.io.tile.TilingScheme;
+import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.DataLocationConstraints;
+import noaa.coastwatch.util.DataLocationIteratorFactory;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
+import noaa.coastwatch.util.StatisticsAccumulator;
+import noaa.coastwatch.util.VariableStatisticsGenerator;
+
+/**
+ * The <code>StatisticsService</code> class computes preview statistics
+ * for the variables in data files in the background, for use by
+ * interactive components that need statistics before displaying data.
+ * The service works as follows:
+ * <ul>
+ *   <li>Requests run on a small shared pool of background threads, and
+ *   each request opens its own reader for the data file so that the
+ *   caller's reader may continue to be used while statistics are
+ *   computed.</li>
+ *   <li>The 2D variables of a file that have the same dimensions are
+ *   sampled together in a single pass over the data, one tile at a
+ *   time, so that each tile is only read once for all variables.</li>
+ *   <li>Statistics are published to a listener on the event dispatch
+ *   thread as they become available, including partial statistics
+ *   during the pass over the data.</li>
+ *   <li>Requests may be cancelled, for example when the user selects a
+ *   different file.</li>
+ *   <li>Statistics are cached by file and variable for the session, so
+ *   repeated requests return immediately.</li>
+ * </ul>
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public class StatisticsService {
+
+  // Constants
+  // ---------
+
+  /** The fraction of data values to sample. */
+  private static final double FRACTION = 0.01;
+
+  /** The tile dimensions to use for grids that have no tiling scheme. */
+  private static final int[] TILE_DIMS = new int[] {512, 512};
+
+  /** The number of partial statistics updates to publish during a pass. */
+  private static final int UPDATES = 4;
+
+  // Variables
+  // ---------
+
+  /** The singleton instance of this service. */
+  private static StatisticsService instance;
+
+  /** The pool of threads for computing statistics. */
+  private ExecutorService pool;
+
+  /** The cache of statistics by file and variable name. */
+  private Map<String, Statistics> cache;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>Listener</code> interface receives statistics and
+   * status updates from a request.  All methods are called on the
+   * event dispatch thread, and none are called after the request is
+   * cancelled.
+   */
+  public interface Listener {
+
+    /**
+     * Receives the statistics for a variable.
+     *
+     * @param name the variable name.
+     * @param stats the variable statistics.
+     * @param isComplete the complete flag, true if the statistics are
+     * final or false if they are partial statistics computed from the
+     * data read so far.
+     */
+    void statisticsUpdated (String name, Statistics stats, boolean isComplete);
+
+    /**
+     * Receives the progress of the request.
+     *
+     * @param fraction the fraction of the request completed in the
+     * range [0..1].
+     */
+    void progressUpdated (double fraction);
+
+    /**
+     * Receives notice that the request has finished.
+     *
+     * @param error the error that stopped the request, or null if the
+     * request completed normally.
+     */
+    void requestFinished (Exception error);
+
+  } // Listener interface
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>Request</code> class is a handle to a statistics
+   * computation that has been submitted to the service.
+   */
+  public static class Request {
+
+    /** The future for the request computation. */
+    private Future<?> future;
+
+    /** The cancelled flag, true if the request was cancelled. */
+    private volatile boolean isCancelled;
+
+    /** Cancels the request. */
+    public void cancel () {
+      isCancelled = true;
+      if (future != null) future.cancel (false);
+    } // cancel
+
+    /** Determines if the request has been cancelled. */
+    public boolean isCancelled () { return (isCancelled); }
+
+  } // Request class
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the shared instance of this service. */
+  public static synchronized StatisticsService getInstance () {
+
+    if (instance == null) instance = new StatisticsService();
+    return (instance);
+
+  } // getInstance
+
+  ////////////////////////////////////////////////////////////
+
+  private StatisticsService () {
+
+    int threads = Math.max (1, Math.min (2, Runtime.getRuntime().availableProcessors()/2));
+    pool = Executors.newFixedThreadPool (threads, runnable -> {
+      Thread thread = new Thread (runnable, "StatisticsService");
+      thread.setDaemon (true);
+      return (thread);
+    });
+    cache = new ConcurrentHashMap<>();
+
+  } // StatisticsService constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the cache key for a variable in a file. */
+  private static String getKey (String source, String name) { return (source + "\n" + name); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the cached statistics for a variable.
+   *
+   * @param source the data file source.
+   * @param name the variable name.
+   *
+   * @return the statistics or null if none are cached.
+   */
+  public Statistics getCached (
+    String source,
+    String name
+  ) {
+
+    return (cache.get (getKey (source, name)));
+
+  } // getCached
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Submits a request for variable statistics.  Variables whose
+   * statistics are already cached are published to the listener
+   * without opening the file.
+   *
+   * @param source the data file source, as used to create a reader.
+   * @param names the variable names to compute statistics.
+   * @param listener the listener to receive the statistics.
+   *
+   * @return the request handle, which may be used to cancel the request.
+   */
+  public Request submit (
+    String source,
+    List<String> names,
+    Listener listener
+  ) {
+
+    Request request = new Request();
+    request.future = pool.submit (() -> {
+      Exception error = null;
+      try { compute (source, new ArrayList<String> (names), listener, request); }
+      catch (Exception e) { error = e; }
+      Exception finalError = error;
+      publish (request, () -> listener.requestFinished (finalError));
+    });
+
+    return (request);
+
+  } // submit
+
+  ////////////////////////////////////////////////////////////
+
+  /** Publishes an update to a listener if the request is still active. */
+  private static void publish (
+    Request request,
+    Runnable update
+  ) {
+
+    SwingUtilities.invokeLater (() -> {
+      if (!request.isCancelled()) update.run();
+    });
+
+  } // publish
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the statistics for a request.
+   *
+   * @param source the data file source.
+   * @param names the variable names.
+   * @param listener the listener to receive the statistics.
+   * @param request the request being computed.
+   *
+   * @throws IOException if an error occurred reading the file.
+   */
+  private void compute (
+    String source,
+    List<String> names,
+    Listener listener,
+    Request request
+  ) throws IOException {
+
+    // Publish cached statistics
+    // -------------------------
+    List<String> uncached = new ArrayList<>();
+    for (String name : names) {
+      Statistics stats = cache.get (getKey (source, name));
+      if (stats != null) publish (request, () -> listener.statisticsUpdated (name, stats, true));
+      else uncached.add (name);
+    } // for
+    if (uncached.isEmpty() || request.isCancelled()) return;
+
+    EarthDataReader reader = EarthDataReaderFactory.create (source);
+    try {
+
+      // Group grids by dimensions
+      // -------------------------
+      /**
+       * Variables with stored statistics and variables that are not
+       * 2D grids are handled individually.  The rest are grouped by
+       * dimensions for a shared pass over the data.  Variables that
+       * cannot be read are skipped.
+       */
+      Map<String, List<Grid>> groups = new LinkedHashMap<>();
+      List<DataVariable> others = new ArrayList<>();
+      for (String name : uncached) {
+        DataVariable var;
+        try { var = reader.getVariable (name); }
+        catch (IOException e) { continue; }
+        Statistics stats = var.getStoredStatistics();
+        if (stats != null) complete (source, name, stats, listener, request);
+        else if (var instanceof Grid)
+          groups.computeIfAbsent (Arrays.toString (var.getDimensions()),
+            key -> new ArrayList<>()).add ((Grid) var);
+        else others.add (var);
+        if (request.isCancelled()) return;
+      } // for
+
+      // Compute statistics
+      // ------------------
+      int total = uncached.size(), done = total;
+      for (List<Grid> group : groups.values()) done -= group.size();
+      done -= others.size();
+      for (List<Grid> group : groups.values()) {
+        computeGroup (source, group, listener, request, done, total);
+        if (request.isCancelled()) return;
+        done += group.size();
+      } // for
+      for (DataVariable var : others) {
+        DataLocationConstraints lc = new DataLocationConstraints();
+        lc.fraction = FRACTION;
+        Statistics stats = VariableStatisticsGenerator.getInstance().generate (var, lc);
+        complete (source, var.getName(), stats, listener, request);
+        if (request.isCancelled()) return;
+        done++;
+        double fraction = (double) done / total;
+        publish (request, () -> listener.progressUpdated (fraction));
+      } // for
+
+    } // try
+    finally {
+      reader.close();
+    } // finally
+
+  } // compute
+
+  ////////////////////////////////////////////////////////////
+
+  /** Caches and publishes the final statistics for a variable. */
+  private void complete (
+    String source,
+    String name,
+    Statistics stats,
+    Listener listener,
+    Request request
+  ) {
+
+    if (request.isCancelled()) return;
+    cache.put (getKey (source, name), stats);
+    publish (request, () -> listener.statisticsUpdated (name, stats, true));
+
+  } // complete
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the statistics for a group of grids with the same
+   * dimensions in a single pass.  The grids are sampled on the same
+   * regular stride as {@link VariableStatisticsGenerator} uses for the
+   * sampling fraction, visiting the tiles of the first grid in order.
+   *
+   * @param source the data file source.
+   * @param group the grids to compute.
+   * @param listener the listener to receive the statistics.
+   * @param request the request being computed.
+   * @param done the number of variables in the request already done.
+   * @param total the total number of variables in the request.
+   */
+  private void computeGroup (
+    String source,
+    List<Grid> group,
+    Listener listener,
+    Request request,
+    int done,
+    int total
+  ) {
+
+    // Set up sampling
+    // ---------------
+    Grid first = group.get (0);
+    int[] dims = first.getDimensions();
+    int[] stride = DataLocationIteratorFactory.getInstance().getOptimalStride (
+      new DataLocation (0, 0), new DataLocation (dims[Grid.ROWS]-1, dims[Grid.COLS]-1),
+      FRACTION, 0);
+    TilingScheme scheme = first.getTilingScheme();
+    if (scheme == null) scheme = new TilingScheme (dims, TILE_DIMS);
+    int[] tileCounts = scheme.getTileCounts();
+    int tiles = tileCounts[Grid.ROWS]*tileCounts[Grid.COLS];
+    List<StatisticsAccumulator> accumulators = new ArrayList<>();
+    for (Grid grid : group) accumulators.add (new StatisticsAccumulator (grid));
+
+    // Loop over tiles
+    // ---------------
+    int tile = 0;
+    for (int tileRow = 0; tileRow < tileCounts[Grid.ROWS]; tileRow++) {
+      for (int tileCol = 0; tileCol < tileCounts[Grid.COLS]; tileCol++) {
+        if (request.isCancelled()) return;
+        tile++;
+
+        // Find sampled box in tile
+        // ------------------------
+        TilePosition pos = scheme.new TilePosition (tileRow, tileCol);
+        int[] start = pos.getStart();
+        int[] tileDims = pos.getDimensions();
+        int[] sampleStart = new int[2];
+        int[] sampleCount = new int[2];
+        for (int i = 0; i < 2; i++) {
+          sampleStart[i] = ((start[i] + stride[i] - 1) / stride[i]) * stride[i];
+          int end = start[i] + tileDims[i] - 1;
+          sampleCount[i] = (sampleStart[i] > end ? 0 : (end - sampleStart[i])/stride[i] + 1);
+        } // for
+
+        // Accumulate samples
+        // ------------------
+        if (sampleCount[Grid.ROWS] != 0 && sampleCount[Grid.COLS] != 0) {
+          int[] count = new int[] {
+            (sampleCount[Grid.ROWS]-1)*stride[Grid.ROWS] + 1,
+            (sampleCount[Grid.COLS]-1)*stride[Grid.COLS] + 1
+          };
+          for (int k = 0; k < group.size(); k++) {
+            Object data = group.get (k).getData (sampleStart, count);
+            accumulators.get (k).accumulate (subsample (data, count[Grid.COLS],
+              sampleCount, stride));
+          } // for
+        } // if
+
+        // Publish partial statistics
+        // --------------------------
+        if (tile != tiles && tile*UPDATES/tiles != (tile-1)*UPDATES/tiles) {
+          for (int k = 0; k < group.size(); k++) {
+            String name = group.get (k).getName();
+            Statistics stats = accumulators.get (k).getStatistics();
+            if (stats != null)
+              publish (request, () -> listener.statisticsUpdated (name, stats, false));
+          } // for
+        } // if
+        double fraction = (done + group.size()*((double) tile/tiles)) / total;
+        publish (request, () -> listener.progressUpdated (fraction));
+
+      } // for
+    } // for
+
+    // Publish final statistics
+    // ------------------------
+    for (int k = 0; k < group.size(); k++) {
+      Grid grid = group.get (k);
+      Statistics stats = accumulators.get (k).getStatistics();
+      if (stats == null) {
+        DataLocationConstraints lc = new DataLocationConstraints();
+        lc.fraction = FRACTION;
+        stats = VariableStatisticsGenerator.getInstance().generate (grid, lc);
+      } // if
+      complete (source, grid.getName(), stats, listener, request);
+    } // for
+
+  } // computeGroup
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Subsamples a block of raw data values.
+   *
+   * @param data the raw data block.
+   * @param cols the number of columns in the data block.
+   * @param sampleCount the number of samples as [rows, columns].
+   * @param stride the sample stride as [rows, columns].
+   *
+   * @return the subsampled raw data values.
+   */
+  private static Object subsample (
+    Object data,
+    int cols,
+    int[] sampleCount,
+    int[] stride
+  ) {
+
+    // Compute sample indices
+    // ----------------------
+    int rows = sampleCount[Grid.ROWS];
+    int sampleCols = sampleCount[Grid.COLS];
+    int samples = rows*sampleCols;
+    int[] indices = new int[samples];
+    int index = 0;
+    for (int i = 0; i < rows; i++) {
+      int offset = i*stride[Grid.ROWS]*cols;
+      for (int j = 0; j < sampleCols; j++)
+        indices[index++] = offset + j*stride[Grid.COLS];
+    } // for
+
+    // Copy samples
+    // ------------
+    Object result;
+    if (data instanceof byte[]) {
+      byte[] in = (byte[]) data, out = new byte[samples];
+      for (int k = 0; k < samples; k++) out[k] = in[indices[k]];
+      result = out;
+    } // if
+    else if (data instanceof short[]) {
+      short[] in = (short[]) data, out = new short[samples];
+      for (int k = 0; k < samples; k++) out[k] = in[indices[k]];
+      result = out;
+    } // else if
+    else if (data instanceof int[]) {
+      int[] in = (int[]) data, out = new int[samples];
+      for (int k = 0; k < samples; k++) out[k] = in[indices[k]];
+      result = out;
+    } // else if
+    else if (data instanceof long[]) {
+      long[] in = (long[]) data, out = new long[samples];
+      for (int k = 0; k < samples; k++) out[k] = in[indices[k]];
+      result = out;
+    } // else if
+    else if (data instanceof float[]) {
+      float[] in = (float[]) data, out = new float[samples];
+      for (int k = 0; k < samples; k++) out[k] = in[indices[k]];
+      result = out;
+    } // else if
+    else {
+      double[] in = (double[]) data, out = new double[samples];
+      for (int k = 0; k < samples; k++) out[k] = in[indices[k]];
+      result = out;
+    } // else
+
+    return (result);
+
+  } // subsample
+
+  ////////////////////////////////////////////////////////////
+
+} // StatisticsService class
+
+////////////////////////////////////////////////////////////////////////
@@ -19,12 +19,7 @@
 */
 ////////////////////////////////////////////////////////////////////////
 
-// TODO: There should be a way to save survey data.
-//       o For lines: Save plot data to PDF file.
-//                    Save line data to lat/lon/value ASCII file.
-//                    Save results to text file.
-//       o For boxes: Save plot data to PDF file.
-//                    Save results to text file.
+// TODO: It would be useful to save the survey plot to a PDF file.
 //       Also, it may be useful to save the survey overlay itself as
 //       lat/lon locations via a group save.
 
@@ -37,12 +32,18 @@ package noaa.coastwatch.gui;
 import java.awt.BasicStroke;
 import java.awt.BorderLayout;
 import java.awt.Color;
+import java.awt.FlowLayout;
 import java.awt.Font;
+import java.awt.Frame;
 import java.awt.GridLayout;
 import java.awt.event.ActionEvent;
 import java.awt.event.ActionListener;
 import java.beans.PropertyChangeEvent;
 import java.beans.PropertyChangeListener;
+import java.io.File;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.PrintStream;
 import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.Iterator;
@@ -51,6 +52,9 @@ import java.util.List;
 import java.util.Map;
 import javax.swing.ButtonGroup;
 import javax.swing.Icon;
+import javax.swing.JButton;
+import javax.swing.JFileChooser;
+import javax.swing.JOptionPane;
 import javax.swing.JPanel;
 import javax.swing.JScrollPane;
 import javax.swing.JTabbedPane;
@@ -58,6 +62,7 @@ import javax.swing.JTextArea;
 import javax.swing.JToggleButton;
 import noaa.coastwatch.gui.AbstractOverlayListPanel;
 import noaa.coastwatch.gui.GUIServices;
+import noaa.coastwatch.gui.SimpleFileFilter;
 import noaa.coastwatch.gui.SurveyPlotFactory;
 import noaa.coastwatch.gui.TabComponent;
 import noaa.coastwatch.render.SurveyOverlay;
@@ -68,7 +73,8 @@ import noaa.coastwatch.util.EarthDataSurvey;
  * allows the user to manipulate a list of {@link
  * EarthDataSurvey} objects.  The user may add a new point, line,
  * or box survey, edit the survey color, name and linestyle, and
- * change the survey layer.<p>
+ * change the survey layer.  The data of the selected survey may be
+ * exported to a CSV file.<p>
  *
  * The chooser signals a change in the survey list by firing a
  * property change event whose property name is given by
@@ -138,6 +144,12 @@ public class SurveyListChooser
   /** The map of surveys to plot panels. */
   private Map surveyPlotMap;
 
+  /** The currently shown survey, or null for none. */
+  private EarthDataSurvey currentSurvey;
+
+  /** The button used to export the current survey. */
+  private JButton exportButton;
+
   ////////////////////////////////////////////////////////////
 
   /** Gets the last survey command executed. */
@@ -181,8 +193,20 @@ public class SurveyListChooser
 
     // Create results panel
     // --------------------
+    JPanel bottomPanel = new JPanel (new BorderLayout());
+    this.add (bottomPanel);
     JTabbedPane resultsPanel = new JTabbedPane();
-    this.add (resultsPanel);
+    bottomPanel.add (resultsPanel, BorderLayout.CENTER);
+
+    // Create export button
+    // --------------------
+    exportButton = new JButton ("Export CSV...");
+    exportButton.setToolTipText ("Save survey data to a CSV file");
+    exportButton.setEnabled (false);
+    exportButton.addActionListener (event -> exportSurvey());
+    JPanel buttonPanel = new JPanel (new FlowLayout (FlowLayout.RIGHT));
+    buttonPanel.add (exportButton);
+    bottomPanel.add (buttonPanel, BorderLayout.SOUTH);
 
     // Create results area
     // -------------------
@@ -274,6 +298,9 @@ public class SurveyListChooser
   /** Clears the survey results. */
   private void clearSurvey () {
 
+    currentSurvey = null;
+    exportButton.setEnabled (false);
+
     // Clear results text
     // ------------------
     resultsArea.setText ("");
@@ -299,6 +326,9 @@ public class SurveyListChooser
     // if the survey overlay itself changed.  For example, small black
     // squares on the endpoints of the survey shape.
 
+    currentSurvey = survey;
+    exportButton.setEnabled (true);
+
     // Set results text
     // ----------------
     resultsArea.setText (survey.getResults());
@@ -315,6 +345,41 @@ public class SurveyListChooser
 
   } // showSurvey
 
+  ////////////////////////////////////////////////////////////
+
+  /** Exports the current survey data to a user-selected CSV file. */
+  private void exportSurvey () {
+
+    if (currentSurvey == null) return;
+
+    // Show file chooser
+    // -----------------
+    JFileChooser fileChooser = GUIServices.getFileChooser();
+    fileChooser.setFileFilter (new SimpleFileFilter (
+      new String[] {"csv"}, "CSV data"));
+    fileChooser.setDialogType (JFileChooser.SAVE_DIALOG);
+    Frame frame = JOptionPane.getFrameForComponent (this);
+    if (fileChooser.showSaveDialog (frame) != JFileChooser.APPROVE_OPTION)
+      return;
+    File file = fileChooser.getSelectedFile();
+    if (!file.getName().toLowerCase().endsWith (".csv"))
+      file = new File (file.getPath() + ".csv");
+
+    // Write survey data
+    // -----------------
+    try (PrintStream stream = new PrintStream (new FileOutputStream (file))) {
+      currentSurvey.writeCSV (stream);
+      if (stream.checkError())
+        throw new IOException ("Error writing to " + file);
+    } // try
+    catch (IOException e) {
+      JOptionPane.showMessageDialog (frame,
+        "An error occurred exporting the survey data:\n" + e.getMessage(),
+        "Error", JOptionPane.ERROR_MESSAGE);
+    } // catch
+
+  } // exportSurvey
+
   ////////////////////////////////////////////////////////////
   
   /** Implements survey list buttons and title. */
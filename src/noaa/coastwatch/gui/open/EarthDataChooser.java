@@ -74,6 +74,7 @@ import noaa.coastwatch.gui.EarthDataViewFactory;
 import noaa.coastwatch.gui.EarthDataViewPanel;
 import noaa.coastwatch.gui.GUIServices;
 import noaa.coastwatch.gui.SimpleFileFilter;
+import noaa.coastwatch.gui.StatisticsService;
 import noaa.coastwatch.gui.open.BasicReaderInfoPanel;
 import noaa.coastwatch.gui.open.DataVariableTableModel;
 import noaa.coastwatch.gui.open.FileChooser;
@@ -87,12 +88,9 @@ import noaa.coastwatch.render.CoastOverlay;
 import noaa.coastwatch.render.EarthDataView;
 import noaa.coastwatch.render.SolidBackground;
 import noaa.coastwatch.tools.ResourceManager;
-import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.trans.SwathProjection;
-import noaa.coastwatch.util.DataLocationConstraints;
-import noaa.coastwatch.util.VariableStatisticsGenerator;
 
 /** 
  * The <code>EarthDataChooser</code> class allows the user to choose a
@@ -141,6 +139,9 @@ public class EarthDataChooser
   /** The active earth data reader. */
   private EarthDataReader reader;
 
+  /** The statistics request for the reader being opened, or null for none. */
+  private StatisticsService.Request statsRequest;
+
   /** The dialog created by the showDialog() method. */
   private static JDialog openDialog;
 
@@ -384,84 +385,56 @@ public class EarthDataChooser
 
     // Create progress monitor
     // -----------------------
-    final JProgressBar bar = new JProgressBar (0, variableNames.size());
+    final JProgressBar bar = new JProgressBar (0, 100);
     String fileName = new File (reader.getSource()).getName();
     final JLabel note = new JLabel ("Computing statistics for " + longestName);
     JOptionPane pane = new JOptionPane (
       new Object[] {"Reading data from " + GUIServices.ellipsisString (fileName, 40), note, bar},
       JOptionPane.INFORMATION_MESSAGE);
-    pane.setOptions (new Object[] {});
+    pane.setOptions (new Object[] {"Cancel"});
     final JDialog progressDialog = pane.createDialog (openDialog, 
       "Progress...");
     progressDialog.setDefaultCloseOperation (JDialog.DO_NOTHING_ON_CLOSE);
     note.setText (" ");
 
-    // Set view panel to null
-    // ----------------------
+    // Submit statistics request
+    // -------------------------
     /**
-     * We do this so that the view panel has no further need to access
-     * the file that is about to be closed and reopened by the stats
-     * thread.  But we don't want any existing preview to go away
-     * visually from the screen, so we don't call repaint().
+     * The statistics service reads the file with its own reader, so
+     * the preview may continue to use our reader while statistics are
+     * computed.  If the user cancels, the chooser remains open.
      */
-    previewPanel.setView (nullView);
-
-    // Create statistics thread
-    // ------------------------
-    Thread statsThread = new Thread () {
-        public void run () {
-
-          // Reopen reader
-          // -------------
-          try { 
-            reader.close();
-            reader = EarthDataReaderFactory.create (reader.getSource());
-          } // try
-          catch (IOException e) {
-            throw new RuntimeException ("Error reopening reader");
-          } // catch
-
-          // Loop over each variable name
-          // ----------------------------
-          for (int i = 0; i < variableNames.size(); i++) {
-
-            // Update monitor
-            // --------------
-            final String name = (String) variableNames.get(i);
-            final int progress = i;
-            SwingUtilities.invokeLater (new Runnable () {
-                public void run () {
-                  note.setText ("Computing statistics for " + name);
-                  bar.setValue (progress);
-                } // run
-              });
-
-            // Compute stats
-            // -------------
-            DataVariable var;
-            try { var = reader.getVariable (name); }
-            catch (IOException e) { continue; }
-            DataLocationConstraints lc = new DataLocationConstraints();
-            lc.fraction = 0.01;
-            Statistics stats = VariableStatisticsGenerator.getInstance().generate (var, lc);
-            reader.putStatistics (name, stats);
-            
-          } // for
-
-          // Dispose of dialogs
-          // ------------------
-          SwingUtilities.invokeLater (new Runnable () {
-              public void run () {
-                progressDialog.dispose();
-                openDialog.dispose();
-              } // run
-            });
-          
-        } // run
-      };
-    statsThread.start();
+    final EarthDataReader openedReader = reader;
+    statsRequest = StatisticsService.getInstance().submit (reader.getSource(),
+      variableNames, new StatisticsService.Listener() {
+        public void statisticsUpdated (String name, Statistics stats, 
+          boolean isComplete) {
+          note.setText ("Computing statistics for " + name);
+          if (isComplete) openedReader.putStatistics (name, stats);
+        } // statisticsUpdated
+        public void progressUpdated (double fraction) {
+          bar.setValue ((int) Math.round (fraction*bar.getMaximum()));
+        } // progressUpdated
+        public void requestFinished (Exception error) {
+          statsRequest = null;
+          progressDialog.dispose();
+          if (error == null) openDialog.dispose();
+          else {
+            JOptionPane.showMessageDialog (openDialog, 
+              "Error computing statistics:\n" + error.getMessage(),
+              "Error", JOptionPane.ERROR_MESSAGE);
+          } // else
+        } // requestFinished
+      });
     progressDialog.setVisible (true);
 
+    // Cancel unfinished request
+    // -------------------------
+    if (statsRequest != null) {
+      statsRequest.cancel();
+      statsRequest = null;
+    } // if
+
   } // openReader
 
   ////////////////////////////////////////////////////////////
@@ -549,6 +522,10 @@ public class EarthDataChooser
    */
   private void closeOldReader () {
 
+    if (statsRequest != null) {
+      statsRequest.cancel();
+      statsRequest = null;
+    } // if
     if (reader != null) {
       clearPreview();
       readerInfoPanel.clear();
@@ -27,11 +27,16 @@ package noaa.coastwatch.io;
 // -------
 import java.io.BufferedOutputStream;
 import java.io.DataOutputStream;
+import java.io.File;
 import java.io.FileOutputStream;
 import java.io.IOException;
 import java.nio.ByteOrder;
+import java.util.ArrayList;
+import java.util.LinkedHashMap;
 import java.util.List;
+import java.util.Map;
 import noaa.coastwatch.io.EarthDataWriter;
+import noaa.coastwatch.io.JSONMetadataServices;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
@@ -40,7 +45,10 @@ import noaa.coastwatch.util.EarthDataInfo;
  * A binary writer is an earth data writer that writes variable
  * data as a stream of binary values.  The data may be scaled and/or
  * byte swapped prior to writing.  An optional dimension header may be
- * prepended to each variable.
+ * prepended to each variable.  An optional JSON sidecar file may also be
+ * written that describes the data type, byte order, scaling, variable
+ * layout, and earth transform so that the file can be read back directly
+ * by {@link MappedBinaryReader}.
  *
  * @author Mark Robinson
  * @since 3.1.0
@@ -62,6 +70,12 @@ abstract public class BinaryWriter
   /** Output buffer size in kilobytes. */
   public static final int DEFAULT_CHUNK_SIZE = 512;
 
+  /** The file name extension appended to create the sidecar file name. */
+  public static final String SIDECAR_EXTENSION = ".json";
+
+  /** The sidecar file format identifier. */
+  public static final String SIDECAR_FORMAT = "CoastWatch binary grid";
+
   // Variables
   // ---------
   /** The scaling as [factor, offset]. */
@@ -79,6 +93,15 @@ abstract public class BinaryWriter
   /** The data output stream. */
   private DataOutputStream out;
 
+  /** The sidecar flag. */
+  private boolean sidecar;
+
+  /** The number of bytes written to the file so far. */
+  private long fileOffset;
+
+  /** The list of variable layout entries for the sidecar file. */
+  private List<Map<String,Object>> sidecarVariables = new ArrayList<>();
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -91,6 +114,37 @@ abstract public class BinaryWriter
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Sets the sidecar flag.
+   *
+   * @param sidecar the sidecar flag.  If true, a JSON sidecar file
+   * describing the file layout and earth transform is written on close.
+   *
+   * @see #getSidecarFile
+   *
+   * @since 3.7.0
+   */
+  public void setSidecar (boolean sidecar) { this.sidecar = sidecar; }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the sidecar file for a binary file.
+   *
+   * @param file the binary file name.
+   *
+   * @return the sidecar file name.
+   *
+   * @since 3.7.0
+   */
+  public static String getSidecarFile (String file) {
+
+    return (file + SIDECAR_EXTENSION);
+
+  } // getSidecarFile
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Sets the byte order.
    *
@@ -284,6 +338,28 @@ abstract public class BinaryWriter
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the data type name written to the sidecar file.  The type is
+   * determined from the class of the default missing value.
+   *
+   * @return the data type name, either "ubyte", "short", or "float".
+   *
+   * @since 3.7.0
+   */
+  protected String getDataType () {
+
+    Number value = getDefaultMissing();
+    String type;
+    if (value instanceof Byte) type = "ubyte";
+    else if (value instanceof Short) type = "short";
+    else type = "float";
+
+    return (type);
+
+  } // getDataType
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Creates a new binary file from the specified earth data info
    * and file name.  By default the byte order is <code>HOST</code>,
@@ -398,6 +474,7 @@ abstract public class BinaryWriter
       // --------------
       DataVariable var = (DataVariable) variables.remove (0);
       writeVariableName = var.getName();
+      if (sidecar) addSidecarVariable (var);
       if (header) writeHeader (var);
       writeVariable (var);
 
@@ -422,6 +499,49 @@ abstract public class BinaryWriter
 
   ////////////////////////////////////////////////////////////
 
+  /** Adds a variable layout entry to the sidecar variable list. */
+  private void addSidecarVariable (
+    DataVariable var
+  ) {
+
+    int[] dims = var.getDimensions();
+    long headerBytes = (header ? 1 + 4*dims.length : 0);
+    long dataBytes = (long) var.getValues() * convertValue (missing).length;
+
+    Map<String,Object> entry = new LinkedHashMap<>();
+    entry.put ("name", var.getName());
+    entry.put ("long_name", var.getLongName());
+    entry.put ("units", var.getUnits());
+    entry.put ("dims", dims);
+    entry.put ("offset", fileOffset + headerBytes);
+    entry.put ("fraction_digits", var.getFormat().getMaximumFractionDigits());
+    sidecarVariables.add (entry);
+
+    fileOffset += headerBytes + dataBytes;
+
+  } // addSidecarVariable
+
+  ////////////////////////////////////////////////////////////
+
+  /** Writes the sidecar file for the variables written so far. */
+  private void writeSidecar () throws IOException {
+
+    Map<String,Object> attributes = new LinkedHashMap<>();
+    attributes.put ("format", SIDECAR_FORMAT);
+    JSONMetadataServices.putInfoAttributes (info, attributes);
+    attributes.put ("data_type", getDataType());
+    attributes.put ("byte_order", (order == LSB ? "lsb" : "msb"));
+    attributes.put ("header", header);
+    attributes.put ("scaling", scaling);
+    attributes.put ("missing_value", missing);
+    attributes.put ("variables", sidecarVariables);
+    JSONMetadataServices.writeMetadata (new File (getSidecarFile (getDestination())),
+      attributes);
+
+  } // writeSidecar
+
+  ////////////////////////////////////////////////////////////
+
   public void close () throws IOException {
 
     // Flush and close
@@ -429,6 +549,10 @@ abstract public class BinaryWriter
     flush();
     out.close();
 
+    // Write sidecar
+    // -------------
+    if (sidecar && !isCanceled) writeSidecar();
+
   } // close
 
   ////////////////////////////////////////////////////////////
@@ -52,7 +52,9 @@ import noaa.coastwatch.util.EarthLocation;
 import noaa.coastwatch.util.GCTP;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.MetadataServices;
+import noaa.coastwatch.util.PrecisionTrimmer;
 import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.StatisticsAccumulator;
 import noaa.coastwatch.util.TimePeriod;
 import noaa.coastwatch.util.trans.Datum;
 import noaa.coastwatch.util.trans.EarthTransform;
@@ -136,6 +138,9 @@ public class CFNC4Writer
   /** The name of the coordinate reference variable. */
   private static final String COORD_REF = "coord_ref";
 
+  /** The name of the quantization container variable. */
+  private static final String QUANTIZATION_VAR = "quantization_info";
+
   /** The name of the time variable. */
   private static final String TIME_VAR = "time";
 
@@ -1383,6 +1388,30 @@ public class CFNC4Writer
       ncVar.addAttribute ("add_offset", packingDataType, addOffset);
     } // if
 
+    // Set quantization info
+    // ---------------------
+    final PrecisionTrimmer trimmer = getTrimmer (var);
+    if (trimmer != null) {
+      NhVariable quantVar = root.findVariable (QUANTIZATION_VAR);
+      if (quantVar == null) {
+        quantVar = root.addVariable (
+          QUANTIZATION_VAR,
+          NhVariable.TP_INT,
+          new NhDimension[0],
+          null,
+          null,
+          0
+        );
+        quantVar.addAttribute ("algorithm", NhVariable.TP_STRING_VAR, 
+          PrecisionTrimmer.ALGORITHM);
+        quantVar.addAttribute ("implementation", NhVariable.TP_STRING_VAR, 
+          ToolServices.PACKAGE_SHORT + " " + ToolServices.getVersion());
+      } // if
+      ncVar.addAttribute ("quantization", NhVariable.TP_STRING_VAR, QUANTIZATION_VAR);
+      ncVar.addAttribute ("quantization_nsb", NhVariable.TP_INT, trimmer.getBits());
+    } // if
+    final Object trimMissing = var.getMissing();
+
     // Set standard and long name
     // --------------------------
     String standard = (String) var.getMetadataMap().get ("standard_name");
@@ -1454,6 +1483,31 @@ public class CFNC4Writer
       } // if
     } // if
 
+    // Set statistics
+    // --------------
+    /**
+     * Attributes can't be added once the file leaves define mode and
+     * the data is written, so the statistics take a separate pass over
+     * the tiles here.  The tiles are trimmed first so that the
+     * statistics match the values that will be written.
+     */
+    StatisticsAccumulator accumulator = getAccumulator (var);
+    if (accumulator != null) {
+      for (TilePosition pos : tilePositions) {
+        Object data = ((Grid) var).getData (pos.getStart(), pos.getDimensions());
+        if (trimmer != null) trimmer.trim (data, trimMissing);
+        accumulator.accumulate (data);
+      } // for
+      Map<String, Object> statsMap = new LinkedHashMap<String, Object>();
+      accumulator.getStatistics().putAttributes (statsMap);
+      for (Map.Entry<String, Object> entry : statsMap.entrySet()) {
+        Object value = entry.getValue();
+        int attType = ((value instanceof Integer || value instanceof int[]) ? 
+          NhVariable.TP_INT : NhVariable.TP_DOUBLE);
+        ncVar.addAttribute (entry.getKey(), attType, value);
+      } // for
+    } // if
+
     // Add variable data to write queue
     // --------------------------------
     writeQueue.add (new WriteQueueEntry () {
@@ -1469,6 +1523,7 @@ public class CFNC4Writer
           int[] tileDims = pos.getDimensions();
           int[] start = new int[] {0, 0, tileStart[TilingScheme.ROWS], tileStart[TilingScheme.COLS]};
           Object data = ((Grid) var).getData (tileStart, tileDims);
+          if (trimmer != null) trimmer.trim (data, trimMissing);
           if (isUnsigned) data = convertUnsignedData (data, dataType);
 
           // Write tile
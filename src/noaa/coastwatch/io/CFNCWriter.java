@@ -49,6 +49,7 @@ import noaa.coastwatch.util.GCTP;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.MetadataServices;
 import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.StatisticsAccumulator;
 import noaa.coastwatch.util.TimePeriod;
 import noaa.coastwatch.util.trans.Datum;
 import noaa.coastwatch.util.trans.EarthTransform;
@@ -1235,12 +1236,14 @@ public class CFNCWriter
     int[] count = new int[] {1, 1, 1, dims[Grid.COLS]};
     int[] dataStart = new int[] {0, 0};
     int[] dataCount = new int[] {1, dims[Grid.COLS]};
+    StatisticsAccumulator accumulator = getAccumulator (var);
     ncFileWriter.setRedefineMode (false);
     try {
       for (int row = 0; row < dims[Grid.ROWS]; row++) {
         dataStart[Grid.ROWS] = row;
         start[2] = row;
         Object data = ((Grid) var).getData (dataStart, dataCount);
+        if (accumulator != null) accumulator.accumulate (data);
         if (isUnsigned) data = convertUnsignedData (data, dataType);
         Array dataArray = Array.factory (dataType, count, data);
         ncFileWriter.write (ncVar, start, dataArray);
@@ -1250,6 +1253,30 @@ public class CFNCWriter
       ncFileWriter.setRedefineMode (true);
     } // finally
 
+    // Set statistics
+    // --------------
+    /**
+     * The variable attributes can be added after the data here because
+     * we're back in define mode, at the cost of the library possibly
+     * rewriting the file header.
+     */
+    if (accumulator != null) {
+      Map<String, Object> statsMap = new LinkedHashMap<String, Object>();
+      accumulator.getStatistics().putAttributes (statsMap);
+      for (Map.Entry<String, Object> entry : statsMap.entrySet()) {
+        Object value = entry.getValue();
+        Attribute att;
+        if (value instanceof Number)
+          att = new Attribute (entry.getKey(), (Number) value);
+        else {
+          DataType attType = (value instanceof int[] ? DataType.INT : DataType.DOUBLE);
+          att = new Attribute (entry.getKey(), Array.factory (attType, 
+            new int[] {java.lang.reflect.Array.getLength (value)}, value));
+        } // else
+        ncFileWriter.addVariableAttribute (ncVar, att);
+      } // for
+    } // if
+
     // Flush to the file
     // -----------------
     ncFileWriter.flush();
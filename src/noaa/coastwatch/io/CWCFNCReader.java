@@ -569,6 +569,7 @@ public class CWCFNCReader
     // Get attributes
     // --------------
     //getAttributes (dataVar.getMetadataMap(), false);
+    getStatisticsAttributes (var, dataVar);
 
     // Return the new variable
     // -----------------------
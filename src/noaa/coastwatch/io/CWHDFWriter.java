@@ -32,6 +32,7 @@ import java.text.NumberFormat;
 import java.util.BitSet;
 import java.util.Date;
 import java.util.Iterator;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
@@ -49,7 +50,9 @@ import noaa.coastwatch.util.EarthLocation;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.Line;
 import noaa.coastwatch.util.MetadataServices;
+import noaa.coastwatch.util.PrecisionTrimmer;
 import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.TimePeriod;
 import noaa.coastwatch.util.trans.DataProjection;
 import noaa.coastwatch.util.trans.EarthTransform;
@@ -669,9 +672,24 @@ public class CWHDFWriter
         Integer.valueOf (var.getFormat().getMaximumFractionDigits()));
     } // if
 
+    // Set quantization
+    // ----------------
+    PrecisionTrimmer trimmer = getTrimmer (var);
+    if (trimmer != null) {
+      setAttribute (sdsid, "quantization_algorithm", PrecisionTrimmer.ALGORITHM);
+      setAttribute (sdsid, "quantization_nsb", Integer.valueOf (trimmer.getBits()));
+    } // if
+
     // Set user metadata
     // -----------------
-    setAttributes (sdsid, var.getMetadataMap(), false);
+    /**
+     * Any statistics summary in the metadata describes the data that
+     * the variable was copied from, so we leave it out and write a
+     * fresh summary only if statistics are computed during writing.
+     */
+    Map map = new LinkedHashMap (var.getMetadataMap());
+    Statistics.removeAttributes (map);
+    setAttributes (sdsid, map, false);
 
   } // setVariableInfo
 
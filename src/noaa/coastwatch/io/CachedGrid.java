@@ -34,11 +34,13 @@ import java.util.Iterator;
 import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
+import noaa.coastwatch.io.tile.OffHeapTileStore;
 import noaa.coastwatch.io.tile.TilingScheme;
 import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
 import noaa.coastwatch.io.tile.TilingScheme.Tile;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
 
 // Testing
 import noaa.coastwatch.test.TestLogger;
@@ -176,6 +178,8 @@ public abstract class CachedGrid
 
     cache.clear();
     lastTile = null;
+    OffHeapTileStore store = OffHeapTileStore.getInstance();
+    if (store.isEnabled()) store.removeAll (this);
   
   } // clearCache
 
@@ -212,6 +216,9 @@ public abstract class CachedGrid
             if (tile.getDirty())
               throw new IllegalStateException ("Written tile has getDirty() == true");
           } // if
+          OffHeapTileStore store = OffHeapTileStore.getInstance();
+          if (store.isEnabled())
+            store.put (new OffHeapTileStore.Key (CachedGrid.this, tile.getPosition()), tile);
           return (true);
         } // else
 
@@ -325,6 +332,8 @@ public abstract class CachedGrid
     // Initialize
     // ----------
     super (grid);
+    if (accessMode == READ_ONLY)
+      Statistics.copyAttributes (grid.getMetadataMap(), getMetadataMap());
 
     // Create new cache
     // ----------------
@@ -446,7 +455,33 @@ public abstract class CachedGrid
   ////////////////////////////////////////////////////////////
 
   /**
-   * Handles a cache miss.  The specified tile is read into the cache.
+   * Removes a tile from the cache without writing it.  This is used when
+   * the tile data has been replaced in the data stream directly, so that
+   * neither a stale copy is read nor a modified copy written over the new
+   * data.  Any copy of the tile in the off-heap tile store is also removed.
+   *
+   * @param pos the position of the tile to remove.
+   *
+   * @since 3.7.0
+   */
+  protected void removeTile (
+    TilePosition pos
+  ) {
+
+    cache.remove (pos);
+    if (lastTile != null && lastTile.getPosition().equals (pos))
+      lastTile = null;
+    OffHeapTileStore store = OffHeapTileStore.getInstance();
+    if (store.isEnabled())
+      store.remove (new OffHeapTileStore.Key (this, pos));
+
+  } // removeTile
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Handles a cache miss.  The specified tile is promoted from the
+   * off-heap tile store if available, or otherwise read into the cache.
    *
    * @param pos the tile position to read.
    */
@@ -454,7 +489,13 @@ public abstract class CachedGrid
     TilePosition pos
   ) {
 
-    Tile tile;
+    Tile tile = null;
+    OffHeapTileStore store = OffHeapTileStore.getInstance();
+    if (store.isEnabled()) {
+      tile = store.remove (new OffHeapTileStore.Key (this, pos));
+      if (tile != null) { cache.put (pos, tile); return; }
+    } // if
+
     try { tile = readTile (pos); }
     catch (IOException e) {
 
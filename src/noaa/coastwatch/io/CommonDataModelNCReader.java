@@ -1187,6 +1187,7 @@ utilities when:
           " for " + name);
       } // else
       dataVar.setUnsigned (isUnsigned);
+      getStatisticsAttributes (var, dataVar);
       
       // Return the new variable
       // -----------------------
@@ -34,8 +34,11 @@ import java.util.LinkedList;
 import java.util.List;
 import java.util.Map;
 
+import noaa.coastwatch.io.GridSubsetReader;
+import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.EarthRegion;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.chunk.ChunkProducer;
@@ -476,6 +479,106 @@ public abstract class EarthDataReader {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the data coordinate rectangle that covers a region of
+   * interest.  The rectangle should be computed once and then passed to
+   * {@link #getRegionInfo} and {@link #getRegionVariable} for each
+   * variable.
+   *
+   * @param region the region of interest.
+   *
+   * @return the rectangle as an array of [start, count] in
+   * [row, column] order, or null if the region does not intersect the
+   * data.
+   *
+   * @see EarthRegion#getDataBounds
+   *
+   * @since 3.7.0
+   */
+  public int[][] getRegionBounds (
+    EarthRegion region
+  ) {
+
+    return (region.getDataBounds (info.getTransform()));
+
+  } // getRegionBounds
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the global information for a region of the data.  The
+   * information is a copy of the reader information with an earth
+   * transform translated to the region rectangle.
+   *
+   * @param bounds the region rectangle from {@link #getRegionBounds}.
+   *
+   * @return the region information.
+   *
+   * @throws UnsupportedOperationException if the earth transform does
+   * not support subsets.
+   *
+   * @since 3.7.0
+   */
+  public EarthDataInfo getRegionInfo (
+    int[][] bounds
+  ) {
+
+    EarthDataInfo regionInfo = (EarthDataInfo) info.clone();
+    DataLocation origin = new DataLocation (bounds[0][Grid.ROWS], bounds[0][Grid.COLS]);
+    regionInfo.setTransform (info.getTransform().getSubset (origin, bounds[1]));
+
+    return (regionInfo);
+
+  } // getRegionInfo
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a grid variable for a region of the data.  If this reader
+   * supports {@link GridSubsetReader}, only the region data is read.
+   * Otherwise the grid is a subset view of the variable, so that data
+   * is accessed only from the parts of the variable that overlap the
+   * region, for example the tiles of a cached grid.
+   *
+   * @param name the variable name.
+   * @param bounds the region rectangle from {@link #getRegionBounds}.
+   *
+   * @return the grid for the region.
+   *
+   * @throws IOException if the data source had I/O errors, or the
+   * variable is not a grid with the earth transform dimensions.
+   *
+   * @since 3.7.0
+   */
+  public Grid getRegionVariable (
+    String name,
+    int[][] bounds
+  ) throws IOException {
+
+    // Check grid dimensions
+    // ---------------------
+    DataVariable preview = getPreview (name);
+    if (!(preview instanceof Grid) ||
+      !Arrays.equals (preview.getDimensions(), info.getTransform().getDimensions()))
+      throw new IOException ("Variable " + name + " does not match the region dimensions");
+
+    // Get region grid
+    // ---------------
+    Grid grid;
+    if (this instanceof GridSubsetReader) {
+      grid = ((GridSubsetReader) this).getGridSubset (name, bounds[0],
+        new int[] {1, 1}, bounds[1]);
+    } // if
+    else {
+      grid = ((Grid) getVariable (name)).getSubset (bounds[0], bounds[1]);
+    } // else
+
+    return (grid);
+
+  } // getRegionVariable
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Closes the reader and frees any resources.
    *
@@ -45,6 +45,14 @@ import noaa.coastwatch.io.EarthDataReader;
  * list of readers is as follows:
  * <ul>
  *
+ *   <li>Directory store formats:<ul>
+ *     <li> {@link noaa.coastwatch.io.ZarrReader} </li>
+ *   </ul></li>
+ *
+ *   <li>Raw binary formats:<ul>
+ *     <li> {@link noaa.coastwatch.io.MappedBinaryReader} </li>
+ *   </ul></li>
+ *
  *   <li>HDF formats:<ul>
  *     <li> {@link noaa.coastwatch.io.CWHDFReader} </li>
  *     <li> {@link noaa.coastwatch.io.TSHDFReader} </li>
@@ -103,6 +111,14 @@ public class EarthDataReaderFactory {
     readerList = new ArrayList();
     String thisPackage = EarthDataReaderFactory.class.getPackage().getName();
 
+    // Add directory store variants
+    // ----------------------------
+    readerList.add (thisPackage + ".ZarrReader");
+
+    // Add raw binary variants
+    // -----------------------
+    readerList.add (thisPackage + ".MappedBinaryReader");
+
     // Add HDF variants
     // ----------------
     readerList.add (thisPackage + ".CWHDFReader");
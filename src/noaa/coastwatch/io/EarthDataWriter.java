@@ -27,9 +27,13 @@ package noaa.coastwatch.io;
 // -------
 import java.io.IOException;
 import java.util.ArrayList;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.PrecisionTrimmer;
+import noaa.coastwatch.util.StatisticsAccumulator;
 
 /**
  * <p>The <code>EarthDataWriter</code> interface is for classes that obtain data
@@ -77,6 +81,15 @@ public abstract class EarthDataWriter {
   /** The canceled flag, true if the current flush is canceled. */
   protected boolean isCanceled;
 
+  /** The map of variable name to significant bits for precision trimming. */
+  private Map<String,Integer> significantBitsMap = new HashMap<>();
+
+  /** The significant bits for variables not in the map, or 0 for none. */
+  private int defaultSignificantBits;
+
+  /** The statistics flag, true to store statistics with each variable. */
+  private boolean isStatistics;
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -178,6 +191,114 @@ public abstract class EarthDataWriter {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Sets the number of significant bits to keep when writing
+   * floating-point variable data.  The trailing mantissa bits of each
+   * value are rounded off before writing so that the data compresses
+   * better (see {@link PrecisionTrimmer}).  Only writers that compress
+   * their output make use of this setting, currently
+   * {@link HDFWriter} and {@link CFNC4Writer}, and the setting must be
+   * made before the variable is added to the writer.
+   *
+   * @param name the variable name, or null to set the significant bits
+   * for all variables that do not have a specific setting.
+   * @param bits the number of significant mantissa bits to keep, or 0
+   * to write the full precision.  Variables whose data type has no more
+   * mantissa bits than this (23 for float, 52 for double) are also
+   * written at full precision.
+   *
+   * @since 3.7.0
+   */
+  public void setSignificantBits (
+    String name,
+    int bits
+  ) {
+
+    if (name == null) defaultSignificantBits = bits;
+    else significantBitsMap.put (name, bits);
+
+  } // setSignificantBits
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the precision trimmer for a variable.
+   *
+   * @param var the variable to get the trimmer for.
+   *
+   * @return the trimmer, or null if the variable is not floating-point
+   * or should be written with full precision, including when the number
+   * of significant bits is at least the mantissa width of the variable
+   * data type.
+   *
+   * @see #setSignificantBits
+   *
+   * @since 3.7.0
+   */
+  public PrecisionTrimmer getTrimmer (
+    DataVariable var
+  ) {
+
+    Integer bitsObj = significantBitsMap.get (var.getName());
+    int bits = (bitsObj == null ? defaultSignificantBits : bitsObj.intValue());
+
+    /**
+     * We only return a trimmer if it would actually remove bits, so that
+     * no quantization attributes are written with a number of bits
+     * larger than the data type can hold.
+     */
+    PrecisionTrimmer trimmer = null;
+    if (bits > 0 && bits < PrecisionTrimmer.getMantissaBits (var.getDataClass()))
+      trimmer = new PrecisionTrimmer (bits);
+
+    return (trimmer);
+
+  } // getTrimmer
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the statistics flag.  When on, the writer computes statistics
+   * for each variable while writing the data values, and stores them
+   * in the output as a summary of variable attributes (see
+   * {@link noaa.coastwatch.util.Statistics#putAttributes}).  Readers
+   * attach the summary to the variable metadata so that statistics for
+   * the whole variable are available without reading the data.  Only
+   * the {@link CWHDFWriter}, {@link CFNCWriter}, and {@link CFNC4Writer}
+   * classes currently make use of this setting, and the setting must be
+   * made before the variable is added to the writer.  By default
+   * statistics are not stored.
+   *
+   * @param flag the statistics flag, true to store statistics.
+   *
+   * @since 3.7.0
+   */
+  public void setStatistics (boolean flag) { isStatistics = flag; }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a statistics accumulator for a variable.
+   *
+   * @param var the variable to get the accumulator for.
+   *
+   * @return the accumulator, or null if statistics should not be
+   * stored.
+   *
+   * @see #setStatistics
+   *
+   * @since 3.7.0
+   */
+  public StatisticsAccumulator getAccumulator (
+    DataVariable var
+  ) {
+
+    return (isStatistics ? new StatisticsAccumulator (var) : null);
+
+  } // getAccumulator
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Flushes all unwritten data to the destination.
    *
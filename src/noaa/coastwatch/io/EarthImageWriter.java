@@ -36,12 +36,18 @@ import com.lowagie.text.pdf.PdfWriter;
 import edu.wlu.cs.levy.CG.KDTree;
 
 import java.awt.Color;
+import java.awt.Composite;
+import java.awt.CompositeContext;
 import java.awt.Dimension;
 import java.awt.Font;
 import java.awt.Graphics2D;
 import java.awt.RenderingHints;
 import java.awt.image.BufferedImage;
+import java.awt.image.ColorModel;
+import java.awt.image.DataBuffer;
+import java.awt.image.DirectColorModel;
 import java.awt.image.IndexColorModel;
+import java.awt.image.Raster;
 import java.awt.image.WritableRaster;
 import java.io.File;
 import java.io.FileOutputStream;
@@ -50,11 +56,12 @@ import java.io.IOException;
 import java.text.SimpleDateFormat;
 import java.util.ArrayList;
 import java.util.Date;
-import java.util.HashMap;
+import java.util.HashSet;
 import java.util.LinkedHashMap;
 import java.util.Map;
 import java.util.Iterator;
 import java.util.List;
+import java.util.Set;
 
 import javax.imageio.ImageIO;
 import javax.imageio.ImageWriter;
@@ -257,11 +264,7 @@ public class EarthImageWriter {
         // ------------------
         List overlayColorList = new ArrayList();
         if (!format.equals ("pdf")) {
-          for (Iterator iter = overlayList.iterator(); iter.hasNext();) {
-            EarthDataOverlay overlay = (EarthDataOverlay) iter.next();
-            overlayColorList.addAll (overlay.getColors());
-          } // for
-          while (overlayColorList.remove (null)) ;
+          overlayColorList = getOverlayColors (overlayList);
         } // if
         int overlayColors = overlayColorList.size();
 
@@ -303,7 +306,12 @@ public class EarthImageWriter {
 
           // Add overlay colors
           // ------------------
-          int colorIndex = (imageColors-1) - extraColors;
+          /**
+           * The overlay colors start just after the last data view
+           * color, which is the missing color.  This keeps the data view
+           * color model as an exact prefix of the new color model.
+           */
+          int colorIndex = imageColors - extraColors;
           for (Iterator iter = overlayColorList.iterator(); iter.hasNext();) {
             Color color = (Color) iter.next();
             red[colorIndex] = (byte) color.getRed();
@@ -375,38 +383,17 @@ public class EarthImageWriter {
     if (format.equals ("png") || format.equals ("jpg") || 
       format.equals ("tif") || format.equals ("gif")) {
 
-      // Create buffered image
-      // ---------------------
-      BufferedImage image = new BufferedImage (renderSize.width, 
-        renderSize.height, BufferedImage.TYPE_INT_RGB);
-      Graphics2D g = image.createGraphics();
-
-      // Set antialiasing
-      // ----------------
-      if (isAntialiased) {
-        g.setRenderingHint (RenderingHints.KEY_ANTIALIASING, 
-          RenderingHints.VALUE_ANTIALIAS_ON);
-        g.setRenderingHint (RenderingHints.KEY_TEXT_ANTIALIASING, 
-          RenderingHints.VALUE_TEXT_ANTIALIAS_ON);
-      } // if
-      else {
-        g.setRenderingHint (RenderingHints.KEY_ANTIALIASING, 
-          RenderingHints.VALUE_ANTIALIAS_OFF);
-        g.setRenderingHint (RenderingHints.KEY_TEXT_ANTIALIASING, 
-          RenderingHints.VALUE_TEXT_ANTIALIAS_OFF);
-      } // else
-
-      // Render
-      // ------
-      g.setColor (fillColor);
-      g.fillRect (0, 0, renderSize.width, renderSize.height); 
-      renderable.render (g);
-      g.dispose();
-
-      // Convert to indexed
-      // ------------------
-      if (isIndexed) {
-        image = quantizeToIndex (image, colorModel);
+      // Render full image
+      // -----------------
+      /**
+       * PNG files are rendered and written in strips below so that the
+       * full image is never held in memory, but the other formats need
+       * the full image.
+       */
+      BufferedImage image = null;
+      if (!format.equals ("png")) {
+        image = renderStrip (renderable, renderSize.width, 0, 
+          renderSize.height, isAntialiased, isIndexed ? colorModel : null);
       } // if
 
       // Print writing message
@@ -484,8 +471,37 @@ public class EarthImageWriter {
 
       } // if
 
-      // Write JPEG, GIF or PNG file
-      // ---------------------------
+      // Write PNG file
+      // --------------
+      else if (format.equals ("png")) {
+        if (file.exists()) file.delete();
+        FileOutputStream outputStream = new FileOutputStream (file);
+        PNGWriter writer = null;
+        view.setStripRendering (true);
+        try {
+          writer = new PNGWriter (outputStream, renderSize.width,
+            renderSize.height, isIndexed ? colorModel : null);
+          Map<String, String> keyValueMap = getTextMetadata();
+          for (String keyword : keyValueMap.keySet())
+            writer.addText (keyword, keyValueMap.get (keyword));
+          int stripRows = PNGWriter.getStripRows (renderSize.width, renderSize.height);
+          for (int y = 0; y < renderSize.height; y += stripRows) {
+            int rows = Math.min (stripRows, renderSize.height - y);
+            BufferedImage strip = renderStrip (renderable, renderSize.width, 
+              y, rows, isAntialiased, isIndexed ? colorModel : null);
+            writer.writeStrip (strip);
+          } // for
+          writer.finish();
+        } // try
+        finally {
+          view.setStripRendering (false);
+          if (writer != null) writer.dispose();
+          outputStream.close();
+        } // finally
+      } // else if
+
+      // Write JPEG or GIF file
+      // ----------------------
       else {
 
         // Get default metadata
@@ -505,32 +521,19 @@ public class EarthImageWriter {
          *
          * http://dev.exiv2.org/projects/exiv2/wiki/The_Metadata_in_PNG_files
          *
-         * We use them for GIF and JPEG files as well.
+         * We use them for GIF and JPEG files as well, and PNG files are
+         * written with the same keywords by the PNG writer.
          */
 
-        Map<String, String> keyValueMap = new LinkedHashMap<String, String>();
-        keyValueMap.put ("Author", System.getProperty ("user.name"));
-        String dateTime =  new SimpleDateFormat ("yyyy/MM/dd HH:mm:ss z").format (new Date());
-        keyValueMap.put ("Creation Time", dateTime);
-        keyValueMap.put ("Software", ToolServices.PACKAGE + " version " +
-          ToolServices.getVersion());
-        keyValueMap.put ("Source", ToolServices.getJavaVersion());
-        keyValueMap.put ("Comment", "Command line was " + ToolServices.getCommandLine());
+        Map<String, String> keyValueMap = getTextMetadata();
 
         IIOMetadataNode root = new IIOMetadataNode (metadataFormat);
         IIOMetadataNode textNode = new IIOMetadataNode ("Text");
         root.appendChild (textNode);
 
-        boolean supportsKeywords = (format.equals ("png"));
         for (String keyword : keyValueMap.keySet()) {
           IIOMetadataNode entry = new IIOMetadataNode ("TextEntry");
-          if (supportsKeywords) {
-            entry.setAttribute ("keyword", keyword);
-            entry.setAttribute ("value", keyValueMap.get (keyword));
-          } // if
-          else {
-            entry.setAttribute ("value", keyword + ": " + keyValueMap.get (keyword));
-          } // else
+          entry.setAttribute ("value", keyword + ": " + keyValueMap.get (keyword));
           textNode.appendChild (entry);
         } // for
 
@@ -649,6 +652,370 @@ public class EarthImageWriter {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the text metadata keyword and value pairs to write to image
+   * files.
+   *
+   * @return the map of keyword to value.
+   */
+  private static Map<String, String> getTextMetadata () {
+
+    Map<String, String> keyValueMap = new LinkedHashMap<String, String>();
+    keyValueMap.put ("Author", System.getProperty ("user.name"));
+    String dateTime =  new SimpleDateFormat ("yyyy/MM/dd HH:mm:ss z").format (new Date());
+    keyValueMap.put ("Creation Time", dateTime);
+    keyValueMap.put ("Software", ToolServices.PACKAGE + " version " +
+      ToolServices.getVersion());
+    keyValueMap.put ("Source", ToolServices.getJavaVersion());
+    keyValueMap.put ("Comment", "Command line was " + ToolServices.getCommandLine());
+
+    return (keyValueMap);
+
+  } // getTextMetadata
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Renders a horizontal strip of a renderable object.  The graphics
+   * are clipped to the strip, so that only the strip region is drawn.
+   *
+   * @param renderable the object to render.
+   * @param width the strip width.
+   * @param y the top row of the strip within the rendered image.
+   * @param rows the number of rows in the strip.
+   * @param isAntialiased the antialias flag, true to antialias fonts
+   * and lines.  Antialiasing is not used for indexed rendering.
+   * @param colorModel the index color model to render directly into an
+   * indexed image, or null to render an RGB image.
+   *
+   * @return the rendered strip image.
+   */
+  private BufferedImage renderStrip (
+    Renderable renderable,
+    int width,
+    int y,
+    int rows,
+    boolean isAntialiased,
+    IndexColorModel colorModel
+  ) {
+
+    // Create buffered image
+    // ---------------------
+    BufferedImage image;
+    Graphics2D g;
+    if (colorModel != null) {
+      image = new BufferedImage (width, rows, BufferedImage.TYPE_BYTE_INDEXED,
+        colorModel);
+      g = image.createGraphics();
+      g.setComposite (new IndexedComposite (colorModel));
+      isAntialiased = false;
+    } // if
+    else {
+      image = new BufferedImage (width, rows, BufferedImage.TYPE_INT_RGB);
+      g = image.createGraphics();
+    } // else
+
+    // Set antialiasing
+    // ----------------
+    if (isAntialiased) {
+      g.setRenderingHint (RenderingHints.KEY_ANTIALIASING, 
+        RenderingHints.VALUE_ANTIALIAS_ON);
+      g.setRenderingHint (RenderingHints.KEY_TEXT_ANTIALIASING, 
+        RenderingHints.VALUE_TEXT_ANTIALIAS_ON);
+    } // if
+    else {
+      g.setRenderingHint (RenderingHints.KEY_ANTIALIASING, 
+        RenderingHints.VALUE_ANTIALIAS_OFF);
+      g.setRenderingHint (RenderingHints.KEY_TEXT_ANTIALIASING, 
+        RenderingHints.VALUE_TEXT_ANTIALIAS_OFF);
+    } // else
+
+    // Render
+    // ------
+    g.setColor (fillColor);
+    g.fillRect (0, 0, width, rows); 
+    g.translate (0, -y);
+    g.clipRect (0, y, width, rows);
+    renderable.render (g);
+    g.dispose();
+
+    return (image);
+
+  } // renderStrip
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the list of colors used by a set of overlays.
+   *
+   * @param overlayList the list of overlays.
+   *
+   * @return the list of non-null overlay colors.
+   */
+  private static List getOverlayColors (
+    List overlayList
+  ) {
+
+    List overlayColorList = new ArrayList();
+    for (Iterator iter = overlayList.iterator(); iter.hasNext();) {
+      EarthDataOverlay overlay = (EarthDataOverlay) iter.next();
+      overlayColorList.addAll (overlay.getColors());
+    } // for
+    while (overlayColorList.remove (null)) ;
+
+    return (overlayColorList);
+
+  } // getOverlayColors
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>ColorIndexMap</code> class maps RGB colors to color
+   * model indices using an open addressing hash table of primitive
+   * values.  It avoids creating objects per pixel when most pixels in
+   * an image have colors that match the color model exactly.
+   */
+  private static class ColorIndexMap {
+
+    /** The table of RGB keys with alpha set, or 0 for an empty slot. */
+    private int[] keys;
+
+    /** The table of color index values. */
+    private byte[] values;
+
+    /** The number of entries in the table. */
+    private int entries;
+
+    /** Creates a new empty map. */
+    public ColorIndexMap () {
+      keys = new int[1024];
+      values = new byte[1024];
+    } // ColorIndexMap constructor
+
+    /** Gets the table slot for a key. */
+    private int slot (int key, int[] keys) {
+      int mask = keys.length-1;
+      int hash = key * 0x9e3779b9;
+      int index = (hash ^ (hash >>> 16)) & mask;
+      while (keys[index] != 0 && keys[index] != key) index = (index+1) & mask;
+      return (index);
+    } // slot
+
+    /** 
+     * Gets the index for an RGB color.
+     *
+     * @return the index in the range [0..255] or -1 if not found.
+     */
+    public int get (int rgb) {
+      int key = rgb | 0xff000000;
+      int index = slot (key, keys);
+      return (keys[index] == 0 ? -1 : values[index] & 0xff);
+    } // get
+
+    /** Puts an index for an RGB color if not already present. */
+    public void put (int rgb, byte value) {
+      int key = rgb | 0xff000000;
+      int index = slot (key, keys);
+      if (keys[index] != 0) return;
+      keys[index] = key;
+      values[index] = value;
+      entries++;
+      if (entries*2 > keys.length) {
+        int[] oldKeys = keys;
+        byte[] oldValues = values;
+        keys = new int[oldKeys.length*2];
+        values = new byte[oldKeys.length*2];
+        for (int i = 0; i < oldKeys.length; i++) {
+          if (oldKeys[i] != 0) {
+            int newIndex = slot (oldKeys[i], keys);
+            keys[newIndex] = oldKeys[i];
+            values[newIndex] = oldValues[i];
+          } // if
+        } // for
+      } // if
+    } // put
+
+  } // ColorIndexMap class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>IndexedComposite</code> class draws into an indexed image
+   * by writing exact color model indices.  The Java2D loops for indexed
+   * destinations use an approximate inverse color table and dithering,
+   * so a palette color drawn by an overlay may be stored as a different
+   * index.  This composite instead looks up each source color in the
+   * palette, and only falls back to the nearest palette color for colors
+   * not in the palette, such as translucent colors blended with the
+   * destination.  The data view image is mapped index to index when it
+   * shares the palette, so that no RGB image or quantization is needed.
+   * Since each graphics context renders on one thread, the composite is
+   * not thread-safe.
+   */
+  private static class IndexedComposite implements Composite {
+
+    /** The destination color model. */
+    private IndexColorModel colorModel;
+
+    /** The destination palette as ARGB values. */
+    private int[] palette;
+
+    /** The map of RGB color to index. */
+    private ColorIndexMap colorMap;
+
+    /** The tree for nearest color searches, or null if not created. */
+    private KDTree colorTree;
+
+    /** The temporary key for nearest color searches. */
+    private double[] treeKey = new double[3];
+
+    /** Creates a new composite for the specified color model. */
+    public IndexedComposite (IndexColorModel colorModel) {
+      this.colorModel = colorModel;
+      int colors = colorModel.getMapSize();
+      palette = new int[colors];
+      colorModel.getRGBs (palette);
+      colorMap = new ColorIndexMap();
+      for (int i = 0; i < colors; i++) colorMap.put (palette[i], (byte) i);
+    } // IndexedComposite constructor
+
+    /** Gets the palette index for an RGB color, exact if possible. */
+    public int getIndex (int rgb) {
+      int colorIndex = colorMap.get (rgb);
+      if (colorIndex == -1) {
+        if (colorTree == null) colorTree = createColorTree (colorModel);
+        treeKey[0] = (rgb & 0xff0000) >>> 16;
+        treeKey[1] = (rgb & 0xff00) >>> 8;
+        treeKey[2] = rgb & 0xff;
+        try { colorIndex = ((Byte) colorTree.nearest (treeKey)).byteValue() & 0xff; }
+        catch (Exception e) {
+          throw new RuntimeException ("Error in k-d tree nearest call");
+        } // catch
+        colorMap.put (rgb, (byte) colorIndex);
+      } // if
+      return (colorIndex);
+    } // getIndex
+
+    @Override
+    public CompositeContext createContext (
+      ColorModel srcColorModel,
+      ColorModel dstColorModel,
+      RenderingHints hints
+    ) {
+      return (new IndexedContext (this, srcColorModel));
+    } // createContext
+
+  } // IndexedComposite class
+
+  ////////////////////////////////////////////////////////////
+
+  /** The context for a drawing operation with an indexed composite. */
+  private static class IndexedContext implements CompositeContext {
+
+    /** The composite for the context. */
+    private IndexedComposite composite;
+
+    /** The source color model. */
+    private ColorModel srcModel;
+
+    /** The destination index for each source index, or null. */
+    private int[] indexMap;
+
+    /** The source ARGB value for each source index, or null. */
+    private int[] srcPalette;
+
+    /** Creates a new context for the specified source color model. */
+    public IndexedContext (IndexedComposite composite, ColorModel srcModel) {
+      this.composite = composite;
+      this.srcModel = srcModel;
+      if (srcModel instanceof IndexColorModel) {
+        IndexColorModel srcIndexModel = (IndexColorModel) srcModel;
+        srcPalette = new int[srcIndexModel.getMapSize()];
+        srcIndexModel.getRGBs (srcPalette);
+        indexMap = new int[srcPalette.length];
+        for (int i = 0; i < srcPalette.length; i++)
+          indexMap[i] = ((srcPalette[i] >>> 24) == 255 ? composite.getIndex (srcPalette[i]) : -1);
+      } // if
+    } // IndexedContext constructor
+
+    /** Gets a row of source ARGB values for a non-indexed source. */
+    private void getRow (Raster src, int y, int width, int[] argbRow) {
+      int minX = src.getMinX();
+      if (srcModel instanceof DirectColorModel &&
+        src.getTransferType() == DataBuffer.TYPE_INT) {
+        src.getDataElements (minX, y, width, 1, argbRow);
+        for (int x = 0; x < width; x++) argbRow[x] = srcModel.getRGB (argbRow[x]);
+      } // else if
+      else {
+        Object pixel = null;
+        for (int x = 0; x < width; x++) {
+          pixel = src.getDataElements (minX + x, y, pixel);
+          argbRow[x] = srcModel.getRGB (pixel);
+        } // for
+      } // else
+    } // getRow
+
+    @Override
+    public void compose (
+      Raster src,
+      Raster dstIn,
+      WritableRaster dstOut
+    ) {
+
+      int width = Math.min (src.getWidth(), dstIn.getWidth());
+      int height = Math.min (src.getHeight(), dstIn.getHeight());
+      int[] argbRow = (indexMap == null ? new int[width] : null);
+      int[] srcRow = (indexMap != null ? new int[width] : null);
+      byte[] dstRow = new byte[width];
+      int[] palette = composite.palette;
+
+      for (int y = 0; y < height; y++) {
+
+        // Get source and destination rows
+        // -------------------------------
+        dstIn.getDataElements (dstIn.getMinX(), dstIn.getMinY() + y, width, 1, dstRow);
+        if (indexMap != null) 
+          src.getSamples (src.getMinX(), src.getMinY() + y, width, 1, 0, srcRow);
+        else
+          getRow (src, src.getMinY() + y, width, argbRow);
+
+        // Combine source colors with destination
+        // ---------------------------------------
+        for (int x = 0; x < width; x++) {
+          int argb;
+          if (indexMap != null) {
+            int srcIndex = srcRow[x];
+            if (indexMap[srcIndex] != -1) {
+              dstRow[x] = (byte) indexMap[srcIndex];
+              continue;
+            } // if
+            argb = srcPalette[srcIndex];
+          } // if
+          else argb = argbRow[x];
+          int alpha = argb >>> 24;
+          if (alpha == 0) continue;
+          if (alpha != 255) {
+            int dst = palette[dstRow[x] & 0xff];
+            int red = (((argb >> 16) & 0xff)*alpha + ((dst >> 16) & 0xff)*(255 - alpha))/255;
+            int green = (((argb >> 8) & 0xff)*alpha + ((dst >> 8) & 0xff)*(255 - alpha))/255;
+            int blue = ((argb & 0xff)*alpha + (dst & 0xff)*(255 - alpha))/255;
+            argb = (red << 16) | (green << 8) | blue;
+          } // if
+          dstRow[x] = (byte) composite.getIndex (argb);
+        } // for
+        dstOut.setDataElements (dstOut.getMinX(), dstOut.getMinY() + y, width, 1, dstRow);
+
+      } // for
+
+    } // compose
+
+    @Override
+    public void dispose () { }
+
+  } // IndexedContext class
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Performs a color quantization of an image to a specific
    * index color model.
@@ -664,37 +1031,12 @@ public class EarthImageWriter {
     IndexColorModel colorModel
   ) {
 
-    // Create hash map and color tree
-    // ------------------------------
-    HashMap colorMap = new HashMap();
-    KDTree colorTree = new KDTree (3);
+    // Create color map
+    // ----------------
+    ColorIndexMap colorMap = new ColorIndexMap();
     int colors = colorModel.getMapSize();
-    for (int i = 0; i < colors; i++) {
-
-      // Check for duplicate color
-      // -------------------------
-      int colorRGB = colorModel.getRGB (i);
-      Integer mapKey = Integer.valueOf (colorRGB);
-      if (colorMap.containsKey (mapKey)) continue;
-
-      // Add entry to hash map
-      // ---------------------
-      Byte colorIndex = Byte.valueOf ((byte) i);
-      colorMap.put (mapKey, colorIndex);
-
-      // Add entry to color tree
-      // -----------------------
-      double[] treeKey = new double[] {
-        (colorRGB & 0xff0000) >>> 16,
-        (colorRGB & 0xff00) >>> 8,
-        colorRGB & 0xff
-      };
-      try { colorTree.insert (treeKey, colorIndex); }
-      catch (Exception e) {
-        throw new RuntimeException ("Error in k-d tree insert call");
-      } // catch
-
-    } // for
+    for (int i = 0; i < colors; i++) 
+      colorMap.put (colorModel.getRGB (i), (byte) i);
 
     // Create new image
     // ----------------
@@ -705,33 +1047,52 @@ public class EarthImageWriter {
 
     // Loop over each color pixel
     // --------------------------
+    /**
+     * In most cases the image colors match the color model exactly, so
+     * we only build the color tree for nearest color matches if we find
+     * a color that isn't in the map.  Nearest matches are then added
+     * to the map so that the tree is searched once per distinct color.
+     */
+    KDTree colorTree = null;
     WritableRaster raster = newImage.getRaster();
+    int[] rgbRow = new int[width];
     byte[] byteRow = new byte[width];
     double[] treeKey = new double[3];
+    int lastRGB = 0, lastIndex = -1;
     for (int y = 0; y < height; y++) {
+      image.getRGB (0, y, width, 1, rgbRow, 0, width);
       for (int x = 0; x < width; x++) {
 
-        // Get color index from hash map
-        // -----------------------------
-        int colorRGB = image.getRGB (x, y);
-        Integer mapKey = Integer.valueOf (colorRGB);
-        Byte colorIndex = (Byte) colorMap.get (mapKey);
-
-        // If that fails, get closest index from color tree
-        // ------------------------------------------------
-        if (colorIndex == null) {
-          treeKey[0] = (colorRGB & 0xff0000) >>> 16;
-          treeKey[1] = (colorRGB & 0xff00) >>> 8;
-          treeKey[2] = colorRGB & 0xff;
-          try { colorIndex = (Byte) colorTree.nearest (treeKey); }
-          catch (Exception e) { 
-            throw new RuntimeException ("Error in k-d tree nearest call");
-          } // catch
-        } // if
+        // Get color index from color map
+        // ------------------------------
+        int colorRGB = rgbRow[x];
+        int colorIndex;
+        if (lastIndex != -1 && colorRGB == lastRGB) 
+          colorIndex = lastIndex;
+        else {
+          colorIndex = colorMap.get (colorRGB);
+
+          // If that fails, get closest index from color tree
+          // ------------------------------------------------
+          if (colorIndex == -1) {
+            if (colorTree == null) colorTree = createColorTree (colorModel);
+            treeKey[0] = (colorRGB & 0xff0000) >>> 16;
+            treeKey[1] = (colorRGB & 0xff00) >>> 8;
+            treeKey[2] = colorRGB & 0xff;
+            try { colorIndex = ((Byte) colorTree.nearest (treeKey)).byteValue() & 0xff; }
+            catch (Exception e) { 
+              throw new RuntimeException ("Error in k-d tree nearest call");
+            } // catch
+            colorMap.put (colorRGB, (byte) colorIndex);
+          } // if
+
+          lastRGB = colorRGB;
+          lastIndex = colorIndex;
+        } // else
 
         // Set color index in new image
         // ----------------------------
-        byteRow[x] = colorIndex.byteValue();
+        byteRow[x] = (byte) colorIndex;
 
       } // for
       raster.setDataElements (0, y, width, 1, byteRow);
@@ -743,6 +1104,47 @@ public class EarthImageWriter {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Creates a tree for nearest color searches in a color model.
+   *
+   * @param colorModel the index color model to use for colors.
+   *
+   * @return the tree of RGB color values to color index.
+   */
+  private static KDTree createColorTree (
+    IndexColorModel colorModel
+  ) {
+
+    KDTree colorTree = new KDTree (3);
+    Set<Integer> colorSet = new HashSet<>();
+    int colors = colorModel.getMapSize();
+    for (int i = 0; i < colors; i++) {
+
+      // Check for duplicate color
+      // -------------------------
+      int colorRGB = colorModel.getRGB (i);
+      if (!colorSet.add (colorRGB)) continue;
+
+      // Add entry to color tree
+      // -----------------------
+      double[] treeKey = new double[] {
+        (colorRGB & 0xff0000) >>> 16,
+        (colorRGB & 0xff00) >>> 8,
+        colorRGB & 0xff
+      };
+      try { colorTree.insert (treeKey, Byte.valueOf ((byte) i)); }
+      catch (Exception e) {
+        throw new RuntimeException ("Error in k-d tree insert call");
+      } // catch
+
+    } // for
+
+    return (colorTree);
+
+  } // createColorTree
+
+  ////////////////////////////////////////////////////////////
+
 } // EarthImageWriter class
 
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,444 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: FootprintCache.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileOutputStream;
+import java.io.IOException;
+import java.io.ObjectInputStream;
+import java.io.ObjectOutputStream;
+import java.io.Serializable;
+import java.util.HashMap;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.zip.GZIPInputStream;
+import java.util.zip.GZIPOutputStream;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.render.feature.LineFeature;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.EarthArea;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.EarthTransform2D;
+import noaa.coastwatch.util.trans.SwathProjection;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>FootprintCache</code> class computes and caches the earth
+ * footprints of data files.  A footprint is the boundary polygon of the
+ * data and optionally the set of 1x1 degree grid squares that the data
+ * covers.  Footprints are cached by file path and are only reused if the
+ * file size and modification time are unchanged, so that the files in a
+ * large archive do not need to be opened again when their footprints
+ * are requested more than once.  The cache may be saved to and loaded
+ * from a file.  All methods are safe to call from multiple threads.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class FootprintCache {
+
+  // Constants
+  // ---------
+
+  /** The number of segments along each side of the boundary polygon. */
+  private static final int SEGMENTS = 4;
+
+  // Variables
+  // ---------
+
+  /** The cache file, or null for no file. */
+  private File cacheFile;
+
+  /** The map of absolute file path to footprint. */
+  private Map<String, Footprint> footprintMap;
+
+  /** The number of footprints found in the cache. */
+  private AtomicInteger hits = new AtomicInteger();
+
+  /** The modified flag, true if footprints were added since loading. */
+  private boolean modified;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>Footprint</code> class holds the footprint of a single
+   * data file.
+   */
+  public static class Footprint implements Serializable {
+
+    private static final long serialVersionUID = 1L;
+
+    /** The file size in bytes. */
+    private long size;
+
+    /** The file modification time. */
+    private long lastModified;
+
+    /** The boundary polygon latitudes. */
+    private double[] lats;
+
+    /** The boundary polygon longitudes. */
+    private double[] lons;
+
+    /** 
+     * The covered grid square lower-left corners as [lat, lon] pairs, or
+     * null if not computed.
+     */
+    private int[] squares;
+
+    ////////////////////////////////////////////////////////
+
+    /**
+     * Creates a new footprint.
+     *
+     * @param file the data file.
+     * @param polygon the boundary polygon.
+     * @param area the covered area or null for none.
+     */
+    public Footprint (
+      File file,
+      LineFeature polygon,
+      EarthArea area
+    ) {
+
+      size = file.length();
+      lastModified = file.lastModified();
+      int points = polygon.size();
+      lats = new double[points];
+      lons = new double[points];
+      for (int i = 0; i < points; i++) {
+        EarthLocation loc = polygon.get (i);
+        lats[i] = loc.lat;
+        lons[i] = loc.lon;
+      } // for
+      if (area != null) {
+        int count = 0;
+        for (int[] square : area) count++;
+        squares = new int[count*2];
+        count = 0;
+        for (int[] square : area) {
+          squares[count++] = square[0];
+          squares[count++] = square[1];
+        } // for
+      } // if
+
+    } // Footprint constructor
+
+    ////////////////////////////////////////////////////////
+
+    /**
+     * Determines if this footprint is current for a file.
+     *
+     * @param file the file to check.
+     *
+     * @return true if the file size and modification time match
+     * those of the file when the footprint was computed.
+     */
+    public boolean isCurrent (
+      File file
+    ) {
+
+      return (file.length() == size && file.lastModified() == lastModified);
+
+    } // isCurrent
+
+    ////////////////////////////////////////////////////////
+
+    /** Determines if this footprint has a covered area. */
+    public boolean hasArea () { return (squares != null); }
+
+    ////////////////////////////////////////////////////////
+
+    /**
+     * Gets the boundary polygon.
+     *
+     * @return the new boundary polygon.
+     */
+    public LineFeature getPolygon () {
+
+      LineFeature polygon = new LineFeature();
+      for (int i = 0; i < lats.length; i++)
+        polygon.add (new EarthLocation (lats[i], lons[i]));
+
+      return (polygon);
+
+    } // getPolygon
+
+    ////////////////////////////////////////////////////////
+
+    /**
+     * Adds the covered area of this footprint to an earth area.
+     *
+     * @param area the area to add to.
+     */
+    public void addArea (
+      EarthArea area
+    ) {
+
+      if (squares != null) {
+        for (int i = 0; i < squares.length; i += 2)
+          area.add (new EarthLocation (squares[i] + 0.5, squares[i+1] + 0.5));
+      } // if
+
+    } // addArea
+
+    ////////////////////////////////////////////////////////
+
+  } // Footprint class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new cache.  If the cache file exists, the footprints in
+   * the file are loaded.  If the file cannot be read, the cache starts
+   * empty and the file is overwritten on saving.
+   *
+   * @param cacheFile the cache file, or null to not use a file.
+   */
+  public FootprintCache (
+    File cacheFile
+  ) {
+
+    this.cacheFile = cacheFile;
+    footprintMap = new HashMap<>();
+    if (cacheFile != null && cacheFile.exists()) {
+      try (ObjectInputStream in = new ObjectInputStream (new GZIPInputStream (
+        new FileInputStream (cacheFile)))) {
+        @SuppressWarnings ("unchecked")
+        Map<String, Footprint> map = (Map<String, Footprint>) in.readObject();
+        footprintMap = map;
+      } // try
+      catch (Exception e) { }
+    } // if
+
+  } // FootprintCache constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Saves the cache to the cache file if any footprints were added.
+   *
+   * @throws IOException if an error occurred writing the file.
+   */
+  public void save () throws IOException {
+
+    if (cacheFile == null) return;
+    synchronized (footprintMap) {
+      if (!modified) return;
+
+      /**
+       * We write to a temporary file and then rename it, so that an
+       * interrupted save never leaves a partial cache file behind.
+       */
+      File tempFile = new File (cacheFile.getPath() + ".tmp");
+      try (ObjectOutputStream out = new ObjectOutputStream (new GZIPOutputStream (
+        new FileOutputStream (tempFile)))) {
+        out.writeObject (footprintMap);
+      } // try
+      cacheFile.delete();
+      if (!tempFile.renameTo (cacheFile))
+        throw new IOException ("Cannot rename " + tempFile + " to " + cacheFile);
+      modified = false;
+    } // synchronized
+
+  } // save
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of footprints that were found in the cache. */
+  public int getHits () { return (hits.get()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the footprint of a file, either from the cache or by opening
+   * the file and computing the footprint.
+   *
+   * @param file the data file name.
+   * @param withArea the area flag, true to make sure the footprint has
+   * the covered area computed.
+   *
+   * @return the file footprint.
+   *
+   * @throws IOException if an error occurred opening the file.
+   */
+  public Footprint getFootprint (
+    String file,
+    boolean withArea
+  ) throws IOException {
+
+    // Check cache
+    // -----------
+    File fileObj = new File (file);
+    String key = fileObj.getAbsolutePath();
+    Footprint footprint;
+    synchronized (footprintMap) { footprint = footprintMap.get (key); }
+    if (footprint != null && footprint.isCurrent (fileObj) &&
+      (!withArea || footprint.hasArea())) {
+      hits.incrementAndGet();
+      return (footprint);
+    } // if
+
+    // Compute footprint
+    // -----------------
+    EarthDataReader reader = EarthDataReaderFactory.create (file);
+    EarthTransform trans;
+    try { trans = reader.getInfo().getTransform(); }
+    finally { reader.close(); }
+    footprint = computeFootprint (fileObj, trans, withArea);
+
+    // Add to cache
+    // ------------
+    synchronized (footprintMap) {
+      footprintMap.put (key, footprint);
+      modified = true;
+    } // synchronized
+
+    return (footprint);
+
+  } // getFootprint
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the footprint of a file.
+   *
+   * @param file the data file.
+   * @param trans the data file earth transform.
+   * @param withArea the area flag, true to compute the covered area.
+   *
+   * @return the file footprint.
+   */
+  public static Footprint computeFootprint (
+    File file,
+    EarthTransform trans,
+    boolean withArea
+  ) {
+
+    // Compute boundary polygon
+    // ------------------------
+    int[] dims = trans.getDimensions();
+    DataLocation min = new DataLocation (0, 0);
+    DataLocation max = new DataLocation (dims[0]-1, dims[1]-1);
+    DataLocation upperLeft = min, lowerRight = max;
+    if (trans instanceof SwathProjection) {
+      upperLeft = upperLeft.truncate (dims);
+      lowerRight = lowerRight.truncate (dims);
+    } // if
+    LineFeature polygon = ((EarthTransform2D) trans).getBoundingBox (upperLeft,
+      lowerRight, SEGMENTS);
+
+    // Explore area from corners
+    // -------------------------
+    /**
+     * The polygon starts at each corner after every SEGMENTS points, so
+     * we use those as the exploration starting points rather than
+     * transforming the corners again.
+     */
+    EarthArea area = null;
+    if (withArea) {
+      area = new EarthArea();
+      for (int corner = 0; corner < 4; corner++) {
+        EarthLocation start = polygon.get (corner*SEGMENTS);
+        if (start.isValid()) area.explore (trans, min, max, start);
+      } // for
+    } // if
+
+    return (new Footprint (file, polygon, area));
+
+  } // computeFootprint
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (FootprintCache.class);
+
+    // ------------------------->
+
+    logger.test ("save, load, and check footprints");
+
+    File dataFile = File.createTempFile ("footprint", ".dat");
+    dataFile.deleteOnExit();
+    File cacheFile = File.createTempFile ("footprint", ".cache");
+    cacheFile.delete();
+    cacheFile.deleteOnExit();
+    try (FileOutputStream out = new FileOutputStream (dataFile)) { out.write (new byte[100]); }
+
+    LineFeature polygon = new LineFeature();
+    polygon.add (new EarthLocation (10, 20));
+    polygon.add (new EarthLocation (10, 21));
+    polygon.add (new EarthLocation (11, 21));
+    EarthArea area = new EarthArea();
+    area.add (new EarthLocation (10.5, 20.5));
+
+    FootprintCache cache = new FootprintCache (cacheFile);
+    String key = dataFile.getAbsolutePath();
+    cache.footprintMap.put (key, new Footprint (dataFile, polygon, area));
+    cache.modified = true;
+    cache.save();
+    assert (cacheFile.exists());
+
+    cache = new FootprintCache (cacheFile);
+    Footprint footprint = cache.getFootprint (dataFile.getPath(), true);
+    assert (cache.getHits() == 1);
+    assert (footprint.getPolygon().size() == 3);
+    assert (footprint.getPolygon().get (2).lat == 11);
+    EarthArea loaded = new EarthArea();
+    footprint.addArea (loaded);
+    assert (loaded.equals (area));
+
+    try (FileOutputStream out = new FileOutputStream (dataFile, true)) { out.write (new byte[10]); }
+    assert (!footprint.isCurrent (dataFile));
+    boolean isRead = false;
+    try { cache.getFootprint (dataFile.getPath(), true); }
+    catch (IOException e) { isRead = true; }
+    assert (isRead);
+    assert (cache.getHits() == 1);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // FootprintCache class
+
+////////////////////////////////////////////////////////////////////////
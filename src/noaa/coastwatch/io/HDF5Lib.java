@@ -29,6 +29,10 @@ import java.lang.reflect.Method;
 import java.lang.reflect.Modifier;
 import java.lang.annotation.Annotation;
 import java.util.Collection;
+import java.util.concurrent.Callable;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.logging.Logger;
 import hdf.hdf5lib.H5;
 import hdf.hdf5lib.HDF5GroupInfo;
 import hdf.hdf5lib.callbacks.H5A_iterate_cb;
@@ -57,19 +61,49 @@ import hdf.hdf5lib.structs.H5AC_cache_config_t;
 /**
  * The <code>HDF5Lib</code> object provides a singleton interface for accessing
  * a thread-safe version of the HDF 5 library.  All methods should use this
- * interface for performing HDF 5 library operations.
+ * interface for performing HDF 5 library operations.<p>
+ *
+ * Since every call is serialized on the single instance, the instance
+ * lock is a potential bottleneck when many threads open HDF 5 files at
+ * once.  Sequences of calls made through {@link #callLocked} are timed
+ * so that the contention for the lock can be measured, see
+ * {@link #getLockStatistics}.  If the <code>cw.hdf5.lock.stats</code>
+ * system property is true, the statistics are logged on exit.
  *
  * @author Peter Hollemans
  * @since 3.3.1
  */
 public class HDF5Lib {
 
+  private static final Logger LOGGER = Logger.getLogger (HDF5Lib.class.getName());
+
+  // Constants
+  // ---------
+
+  /** The lock statistics logging property. */
+  private static final String LOCK_STATS_PROP = "cw.hdf5.lock.stats";
+
   // Variables
   // ---------
 
   /** The single instance of this class. */
   private static HDF5Lib instance;
-  
+
+  /** The number of timed lock acquisitions. */
+  private static AtomicLong lockCount = new AtomicLong();
+
+  /** The number of timed lock acquisitions that had to wait. */
+  private static AtomicLong contentionCount = new AtomicLong();
+
+  /** The total time in nanoseconds spent waiting for the lock. */
+  private static AtomicLong waitTime = new AtomicLong();
+
+  /** The total time in nanoseconds spent holding the lock. */
+  private static AtomicLong holdTime = new AtomicLong();
+
+  /** The number of threads waiting for or holding the lock. */
+  private static AtomicInteger lockUsers = new AtomicInteger();
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -86,12 +120,125 @@ public class HDF5Lib {
    *
    * @return the singeton instance.
    */
-  public static HDF5Lib getInstance () {
-  
-    if (instance == null) instance = new HDF5Lib();
+  public static synchronized HDF5Lib getInstance () {
+  
+    /**
+     * This method is synchronized so that two threads can never create
+     * separate instances, which would give each its own lock.
+     */
+    if (instance == null) {
+      instance = new HDF5Lib();
+      if (Boolean.getBoolean (LOCK_STATS_PROP)) {
+        Runtime.getRuntime().addShutdownHook (new Thread (() ->
+          LOGGER.info (getLockStatistics())));
+      } // if
+    } // if
     return (instance);
     
   } // getInstance
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Performs a sequence of HDF 5 library operations while holding the
+   * library lock, and records the time spent waiting for and holding
+   * the lock.  Any HDF 5 code that calls the library through a higher
+   * level API, such as the HDF object package, should use this method
+   * so that the calls cannot interleave with other threads.
+   *
+   * @param operation the operation to perform.
+   *
+   * @return the operation result.
+   *
+   * @throws Exception if the operation threw an exception.
+   *
+   * @since 3.7.0
+   */
+  public <T> T callLocked (
+    Callable<T> operation
+  ) throws Exception {
+
+    boolean isContended = (lockUsers.getAndIncrement() != 0);
+    long startTime = System.nanoTime();
+    try {
+      synchronized (this) {
+        long lockTime = System.nanoTime();
+        waitTime.addAndGet (lockTime - startTime);
+        lockCount.incrementAndGet();
+        if (isContended) contentionCount.incrementAndGet();
+        try { return (operation.call()); }
+        finally { holdTime.addAndGet (System.nanoTime() - lockTime); }
+      } // synchronized
+    } // try
+    finally {
+      lockUsers.decrementAndGet();
+    } // finally
+
+  } // callLocked
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the number of timed lock acquisitions made by
+   * {@link #callLocked}.
+   *
+   * @return the acquisition count.
+   *
+   * @since 3.7.0
+   */
+  public static long getLockCount () { return (lockCount.get()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the number of timed lock acquisitions that found the lock
+   * held or requested by another thread.
+   *
+   * @return the contended acquisition count.
+   *
+   * @since 3.7.0
+   */
+  public static long getContentionCount () { return (contentionCount.get()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the total time spent by all threads waiting for the lock in
+   * {@link #callLocked}.
+   *
+   * @return the wait time in milliseconds.
+   *
+   * @since 3.7.0
+   */
+  public static double getLockWaitTime () { return (waitTime.get()/1e6); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the total time spent holding the lock in {@link #callLocked}.
+   *
+   * @return the hold time in milliseconds.
+   *
+   * @since 3.7.0
+   */
+  public static double getLockHoldTime () { return (holdTime.get()/1e6); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a summary of the lock statistics.
+   *
+   * @return the statistics summary string.
+   *
+   * @since 3.7.0
+   */
+  public static String getLockStatistics () {
+
+    return (String.format ("HDF 5 library lock acquired %d times, " +
+      "%d contended, %.1f ms waiting, %.1f ms held", getLockCount(),
+      getContentionCount(), getLockWaitTime(), getLockHoldTime()));
+
+  } // getLockStatistics
     
   ////////////////////////////////////////////////////////////
 
@@ -28,6 +28,7 @@ package noaa.coastwatch.io;
 import java.io.IOException;
 import java.lang.reflect.Array;
 import java.util.Arrays;
+import java.util.BitSet;
 import hdf.hdflib.HDFConstants;
 import hdf.hdflib.HDFException;
 import noaa.coastwatch.io.HDFLib;
@@ -39,6 +40,9 @@ import noaa.coastwatch.io.tile.TilingScheme;
 import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
 import noaa.coastwatch.io.tile.TilingScheme.Tile;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.PrecisionTrimmer;
+import noaa.coastwatch.util.Statistics;
+import noaa.coastwatch.util.StatisticsAccumulator;
 
 import java.util.logging.Logger;
 import java.util.logging.Level;
@@ -81,6 +85,15 @@ public class HDFCachedGrid
   /** HDF compression flag. */
   private boolean compressed;
 
+  /** The precision trimmer for written tiles, or null for none. */
+  private PrecisionTrimmer trimmer;
+
+  /** The statistics accumulator for written tiles, or null for none. */
+  private StatisticsAccumulator accumulator;
+
+  /** The set of tile indices written so far when accumulating statistics. */
+  private BitSet writtenTiles;
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -231,6 +244,10 @@ public class HDFCachedGrid
       if (sdsid < 0)
         throw new HDFException ("Cannot create variable '" + varName + "'");
       writer.setVariableInfo (sdsid, grid);
+      trimmer = writer.getTrimmer (grid);
+      accumulator = writer.getAccumulator (grid);
+      if (accumulator != null) writtenTiles = new BitSet();
+      Statistics.removeAttributes (getMetadataMap());
 
       // Get variable index
       // ------------------
@@ -399,6 +416,34 @@ public class HDFCachedGrid
       if (sdsid < 0)
         throw new HDFException ("Cannot access variable at index " + varIndex);
 
+      // Trim precision
+      // --------------
+      /**
+       * The tile data is trimmed in place so that values read back
+       * from the cache match those in the file.
+       */
+      if (trimmer != null) trimmer.trim (tile.getData(), getMissing());
+
+      // Accumulate statistics
+      // ---------------------
+      /**
+       * Statistics can't be taken back out of the accumulator, so if
+       * a tile is written a second time, for example after being
+       * modified again once flushed from the cache, we have to give up
+       * on the statistics.
+       */
+      if (accumulator != null) {
+        int[] coords = tile.getPosition().getCoords();
+        int index = coords[ROWS]*tiling.getTileCounts()[COLS] + coords[COLS];
+        boolean isRewrite;
+        synchronized (writtenTiles) {
+          isRewrite = writtenTiles.get (index);
+          writtenTiles.set (index);
+        } // synchronized
+        if (isRewrite) accumulator.invalidate();
+        else accumulator.accumulate (tile.getData());
+      } // if
+
       // Write unchunked data
       // --------------------
       if (!chunked) {
@@ -464,6 +509,56 @@ public class HDFCachedGrid
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Writes the statistics summary for the data written so far as
+   * variable attributes, if the writer was set to store statistics.
+   * Tiles that were never written are counted as missing data.  This
+   * is called by the writer when the grid is flushed, after which the
+   * statistics are no longer updated.
+   *
+   * @throws IOException if an error occurred writing the attributes.
+   *
+   * @see EarthDataWriter#setStatistics
+   */
+  protected void writeStatistics () throws IOException {
+
+    if (accumulator == null) return;
+
+    // Count unwritten tiles
+    // ---------------------
+    int[] tileCounts = tiling.getTileCounts();
+    long unwritten = 0;
+    for (int i = 0; i < tileCounts[ROWS]; i++) {
+      for (int j = 0; j < tileCounts[COLS]; j++) {
+        if (!writtenTiles.get (i*tileCounts[COLS] + j)) {
+          int[] length = tiling.new TilePosition (i, j).getDimensions();
+          unwritten += (long) length[ROWS]*length[COLS];
+        } // if
+      } // for
+    } // for
+    if (unwritten != 0) {
+      if (getMissing() == null) accumulator.invalidate();
+      else accumulator.addInvalid (unwritten);
+    } // if
+
+    // Write attributes
+    // ----------------
+    try {
+      int sdsid = HDFLib.getInstance().SDselect (dataset.getSDID(), varIndex);
+      if (sdsid < 0)
+        throw new HDFException ("Cannot access variable at index " + varIndex);
+      HDFWriter.setStatisticsInfo (sdsid, accumulator.getStatistics());
+      HDFLib.getInstance().SDendaccess (sdsid);
+    } // try
+    catch (Exception e) {
+      throw new IOException (e.getMessage());
+    } // catch
+    accumulator = null;
+
+  } // writeStatistics
+
+  ////////////////////////////////////////////////////////////
+
 } // HDFCachedGrid class
 
 ////////////////////////////////////////////////////////////////////////
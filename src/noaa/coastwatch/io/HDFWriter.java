@@ -29,6 +29,7 @@ import java.io.IOException;
 import java.io.UnsupportedEncodingException;
 import java.lang.reflect.Array;
 import java.util.Arrays;
+import java.util.LinkedHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Set;
@@ -46,6 +47,9 @@ import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.Line;
 import noaa.coastwatch.util.MetadataServices;
+import noaa.coastwatch.util.PrecisionTrimmer;
+import noaa.coastwatch.util.Statistics;
+import noaa.coastwatch.util.StatisticsAccumulator;
 
 import java.util.logging.Logger;
 import java.util.logging.Level;
@@ -542,6 +546,8 @@ public abstract class HDFWriter
       CachedGrid cache = (CachedGrid) var;
       if (cache.getDataStream() == this) {
         cache.flush();
+        if (cache instanceof HDFCachedGrid) 
+          ((HDFCachedGrid) cache).writeStatistics();
         return;
       } // if
     } // 
@@ -565,6 +571,9 @@ public abstract class HDFWriter
     if (sdsid < 0)
       throw new HDFException ("Cannot create variable '" + varName + "'");
     setVariableInfo (sdsid, var);
+    PrecisionTrimmer trimmer = getTrimmer (var);
+    StatisticsAccumulator accumulator = getAccumulator (var);
+    Object missing = var.getMissing();
 
     // Check rank
     // ----------
@@ -601,6 +610,8 @@ public abstract class HDFWriter
             j*tileDims[Grid.COLS]};
           int[] dataDims = tiling.new TilePosition (i, j).getDimensions();
           Object data = ((Grid) var).getData (dataStart, dataDims);
+          if (trimmer != null) trimmer.trim (data, missing);
+          if (accumulator != null) accumulator.accumulate (data);
           if (dataDims[Grid.ROWS] != tileDims[Grid.ROWS] || 
             dataDims[Grid.COLS] != tileDims[Grid.COLS]) {
             Object newData = Array.newInstance (var.getDataClass(), values);
@@ -644,6 +655,14 @@ public abstract class HDFWriter
       // ----------
       // NOTE: Have to write it all at once!
       Object data = var.getData();
+      if (trimmer != null) {
+        int values = Array.getLength (data);
+        Object trimmed = Array.newInstance (varClass, values);
+        System.arraycopy (data, 0, trimmed, 0, values);
+        trimmer.trim (trimmed, missing);
+        data = trimmed;
+      } // if
+      if (accumulator != null) accumulator.accumulate (data);
       int[] start = new int[dims.length];
       Arrays.fill (start, 0);
       int[] stride = new int[dims.length];
@@ -662,6 +681,7 @@ public abstract class HDFWriter
       // ---------------
       if (var instanceof Line) {
         Object data = var.getData ();
+        if (accumulator != null) accumulator.accumulate (data);
         if (!HDFLib.getInstance().SDwritedata (sdsid, new int[] {0},
           new int[] {1}, new int[] {dims[0]}, data))
           throw new HDFException ("Write failed for '" + varName + "'");
@@ -681,6 +701,8 @@ public abstract class HDFWriter
           // ---------
           int[] start = new int[] {i, 0};
           Object data = ((Grid) var).getData (start, count);
+          if (trimmer != null) trimmer.trim (data, missing);
+          if (accumulator != null) accumulator.accumulate (data);
           if (!HDFLib.getInstance().SDwritedata (sdsid, start, stride, count, data))
             throw new HDFException ("Write failed for '" +
               varName + "' at row " + i);
@@ -701,12 +723,44 @@ public abstract class HDFWriter
 
     } // else
 
+    // Set statistics
+    // --------------
+    if (accumulator != null) setStatisticsInfo (sdsid, accumulator.getStatistics());
+
     // End access
     // ----------
     HDFLib.getInstance().SDendaccess (sdsid);
 
   } // writeVariable  
 
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Writes a statistics summary as variable attributes.  Attributes
+   * may be set after the variable data has been written, so this is
+   * normally called once all the data values are accumulated.
+   *
+   * @param sdsid the variable HDF scientific dataset ID.
+   * @param stats the statistics to write, or null to write nothing.
+   *
+   * @throws HDFException if an error occurred in an HDF routine.
+   * @throws ClassNotFoundException if the HDF attribute type is unknown.
+   *
+   * @since 3.7.0
+   */
+  protected static void setStatisticsInfo (
+    int sdsid,
+    Statistics stats
+  ) throws HDFException, ClassNotFoundException {
+
+    if (stats != null) {
+      Map map = new LinkedHashMap();
+      stats.putAttributes (map);
+      setAttributes (sdsid, map, true);
+    } // if
+
+  } // setStatisticsInfo
+
   ////////////////////////////////////////////////////////////
   
   public void flush () throws IOException {
@@ -0,0 +1,360 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: JSONMetadataServices.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.awt.geom.AffineTransform;
+import java.awt.geom.NoninvertibleTransformException;
+import java.io.File;
+import java.io.IOException;
+import java.nio.charset.StandardCharsets;
+import java.nio.file.Files;
+import java.util.ArrayList;
+import java.util.Date;
+import java.util.List;
+import java.util.Map;
+import noaa.coastwatch.io.JSONServices;
+import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.TimePeriod;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.MapProjection;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+
+/**
+ * The <code>JSONMetadataServices</code> class defines various static
+ * methods for reading and writing the JSON metadata files used by
+ * directory-based data stores and raw binary sidecar files, and for
+ * converting between earth data info and a map of attributes stored in
+ * such a file.  The methods are shared by the {@link ZarrReader},
+ * {@link ZarrWriter}, {@link MappedBinaryReader}, and {@link BinaryWriter}
+ * classes.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public class JSONMetadataServices {
+
+  // Constants
+  // ---------
+
+  /** The number of milliseconds per day. */
+  private static final long MSEC_PER_DAY = (1000L * 3600L * 24L);
+
+  ////////////////////////////////////////////////////////////
+
+  private JSONMetadataServices () { }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Reads a JSON metadata file.
+   *
+   * @param file the file to read.
+   *
+   * @return the map of metadata keys to values.
+   *
+   * @throws IOException if an error occurred reading or parsing the file.
+   */
+  public static Map<String,Object> readMetadata (
+    File file
+  ) throws IOException {
+
+    String text = new String (Files.readAllBytes (file.toPath()), StandardCharsets.UTF_8);
+    Object obj = JSONServices.parse (text);
+    if (!(obj instanceof Map))
+      throw new IOException ("Expected JSON object in " + file);
+
+    return ((Map<String,Object>) obj);
+
+  } // readMetadata
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Writes a JSON metadata file.
+   *
+   * @param file the file to write.
+   * @param map the map of metadata keys to values.
+   *
+   * @throws IOException if an error occurred writing the file.
+   */
+  public static void writeMetadata (
+    File file,
+    Map<String,Object> map
+  ) throws IOException {
+
+    Files.write (file.toPath(), (JSONServices.format (map) + "\n").getBytes (
+      StandardCharsets.UTF_8));
+
+  } // writeMetadata
+  ////////////////////////////////////////////////////////////
+
+  /** Adds the JSON-compatible entries of a metadata map to a map of attributes. */
+  static void putMetadata (
+    Map metadata,
+    Map<String,Object> attributes
+  ) {
+
+    for (Object obj : metadata.entrySet()) {
+      Map.Entry entry = (Map.Entry) obj;
+      Object value = entry.getValue();
+      if (value instanceof String || value instanceof Number ||
+        value instanceof Boolean || (value != null && value.getClass().isArray() &&
+        value.getClass().getComponentType().isPrimitive()))
+        attributes.put (entry.getKey().toString(), value);
+    } // for
+
+  } // putMetadata
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Adds attributes for earth data info to a map of attributes.  The
+   * attributes follow the CoastWatch HDF naming for the data source,
+   * time periods, and earth transform dimensions and type.  Map
+   * projections are written in full using the GCTP parameters, other
+   * transforms only by type.
+   *
+   * @param info the earth data info to add attributes for.
+   * @param attributes the map of attribute names to values to modify.
+   *
+   * @see #createInfo
+   */
+  static void putInfoAttributes (
+    EarthDataInfo info,
+    Map<String,Object> attributes
+  ) {
+
+    // Set user metadata
+    // -----------------
+    putMetadata (info.getMetadataMap(), attributes);
+
+    // Set source attributes
+    // ---------------------
+    if (info instanceof SatelliteDataInfo) {
+      attributes.put ("satellite", ((SatelliteDataInfo) info).getSatellite());
+      attributes.put ("sensor", ((SatelliteDataInfo) info).getSensor());
+    } // if
+    else {
+      attributes.put ("data_source", info.getSource());
+    } // else
+    attributes.put ("origin", info.getOrigin());
+    attributes.put ("history", info.getHistory());
+
+    // Set time periods
+    // ----------------
+    List<TimePeriod> periodList = info.getTimePeriods();
+    int periods = periodList.size();
+    int[] passDateArray = new int[periods];
+    double[] startTimeArray = new double[periods];
+    double[] extentArray = new double[periods];
+    for (int i = 0; i < periods; i++) {
+      TimePeriod period = periodList.get (i);
+      long msec = period.getStartDate().getTime();
+      passDateArray[i] = (int) (msec / MSEC_PER_DAY);
+      startTimeArray[i] = (msec % MSEC_PER_DAY)/1000.0;
+      extentArray[i] = period.getDuration()/1000.0;
+    } // for
+    attributes.put ("pass_date", passDateArray);
+    attributes.put ("start_time", startTimeArray);
+    attributes.put ("temporal_extent", extentArray);
+
+    // Set earth transform
+    // -------------------
+    EarthTransform trans = info.getTransform();
+    int[] dims = trans.getDimensions();
+    attributes.put ("projection_type", trans.describe());
+    if (trans instanceof MapProjection) {
+      MapProjection map = (MapProjection) trans;
+      attributes.put ("projection", map.getSystemName());
+      attributes.put ("gctp_sys", map.getSystem());
+      attributes.put ("gctp_zone", map.getZone());
+      attributes.put ("gctp_parm", map.getParameters());
+      attributes.put ("gctp_datum", map.getSpheroid());
+      double[] matrix = new double[6];
+      map.getAffine().getMatrix (matrix);
+      attributes.put ("et_affine", matrix);
+    } // if
+    attributes.put ("rows", dims[Grid.ROWS]);
+    attributes.put ("cols", dims[Grid.COLS]);
+
+  } // putInfoAttributes
+  ////////////////////////////////////////////////////////////
+
+  /** Converts a parsed JSON list of numbers to a double array. */
+  static double[] toDoubleArray (Object obj) {
+
+    List list = (List) obj;
+    double[] array = new double[list.size()];
+    for (int i = 0; i < array.length; i++)
+      array[i] = JSONServices.toDouble (list.get (i));
+    return (array);
+
+  } // toDoubleArray
+  ////////////////////////////////////////////////////////////
+
+  /** Gets an attribute as a string, or null if not found. */
+  static String getString (Map<String,Object> attributes, String name) {
+
+    Object value = attributes.get (name);
+    return (value == null ? null : value.toString());
+
+  } // getString
+  ////////////////////////////////////////////////////////////
+
+  /** Gets an attribute as an integer. */
+  static int getInt (Map<String,Object> attributes, String name) throws IOException {
+
+    Object value = attributes.get (name);
+    if (!(value instanceof Number))
+      throw new IOException ("Missing or invalid attribute " + name);
+    return (((Number) value).intValue());
+
+  } // getInt
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates earth data info from a map of attributes written by
+   * {@link #putInfoAttributes}.
+   *
+   * @param attributes the map of attribute names to values.
+   * @param trans the earth transform for the info.
+   *
+   * @return the info object.
+   *
+   * @throws IOException if an error occurred reading the info.
+   */
+  static EarthDataInfo createInfo (
+    Map<String,Object> attributes,
+    EarthTransform trans
+  ) throws IOException {
+
+    // Get source attributes
+    // ---------------------
+    String sat = getString (attributes, "satellite");
+    String sensor = getString (attributes, "sensor");
+    String source = getString (attributes, "data_source");
+    String origin = getString (attributes, "origin");
+    String history = getString (attributes, "history");
+    if (origin == null) origin = "Unknown";
+    if (history == null) history = "";
+
+    // Get time period list
+    // --------------------
+    List<TimePeriod> periodList = new ArrayList<>();
+    if (attributes.containsKey ("pass_date")) {
+      double[] passDateArray = toDoubleArray (attributes.get ("pass_date"));
+      double[] startTimeArray = toDoubleArray (attributes.get ("start_time"));
+      double[] extentArray = (attributes.containsKey ("temporal_extent") ?
+        toDoubleArray (attributes.get ("temporal_extent")) :
+        new double[passDateArray.length]);
+      if (passDateArray.length != startTimeArray.length ||
+        startTimeArray.length != extentArray.length)
+        throw new IOException ("Date, time, and extent attributes have different lengths");
+      for (int i = 0; i < passDateArray.length; i++) {
+        long msec = (long) passDateArray[i] * MSEC_PER_DAY;
+        msec += (long) (startTimeArray[i] * 1000L);
+        periodList.add (new TimePeriod (new Date (msec), (long) (extentArray[i] * 1000L)));
+      } // for
+    } // if
+    else
+      periodList.add (new TimePeriod (new Date (0), 0));
+
+    // Create info object
+    // ------------------
+    EarthDataInfo info;
+    if (sat == null && sensor == null && source == null)
+      source = "Unknown";
+    if (source != null) {
+      info = new EarthDataInfo (source, periodList, trans, origin, history);
+    } // if
+    else {
+      if (sat == null) sat = "Unknown";
+      if (sensor == null) sensor = "Unknown";
+      info = new SatelliteDataInfo (sat, sensor, periodList, trans,
+        origin, history);
+    } // else
+
+    return (info);
+
+  } // createInfo
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a map projection from a map of attributes written by
+   * {@link #putInfoAttributes}.
+   *
+   * @param attributes the map of attribute names to values.
+   *
+   * @return the map projection.
+   *
+   * @throws IOException if the attributes are missing or invalid.
+   */
+  static MapProjection createMapProjection (
+    Map<String,Object> attributes
+  ) throws IOException {
+
+    try {
+      return (MapProjectionFactory.getInstance().create (
+        getInt (attributes, "gctp_sys"),
+        getInt (attributes, "gctp_zone"),
+        toDoubleArray (attributes.get ("gctp_parm")),
+        getInt (attributes, "gctp_datum"),
+        new int[] {getInt (attributes, "rows"), getInt (attributes, "cols")},
+        new AffineTransform (toDoubleArray (attributes.get ("et_affine")))
+      ));
+    } // try
+    catch (NoninvertibleTransformException e) {
+      throw new IOException ("Cannot create map projection: " + e.getMessage());
+    } // catch
+
+  } // createMapProjection
+  ////////////////////////////////////////////////////////////
+
+  /** Converts a numeric attribute value to the wrapper for a data class. */
+  static Object toMissing (
+    Object value,
+    Class dataClass
+  ) {
+
+    Object missing = null;
+    if (value != null) {
+      double number = JSONServices.toDouble (value);
+      if (dataClass.equals (Byte.TYPE)) missing = Byte.valueOf ((byte) (long) number);
+      else if (dataClass.equals (Short.TYPE)) missing = Short.valueOf ((short) (long) number);
+      else if (dataClass.equals (Integer.TYPE)) missing = Integer.valueOf ((int) (long) number);
+      else if (dataClass.equals (Long.TYPE)) missing = Long.valueOf ((long) number);
+      else if (dataClass.equals (Float.TYPE)) missing = Float.valueOf ((float) number);
+      else if (dataClass.equals (Double.TYPE)) missing = Double.valueOf (number);
+    } // if
+
+    return (missing);
+
+  } // toMissing
+  ////////////////////////////////////////////////////////////
+
+} // JSONMetadataServices class
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,470 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: JSONServices.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.IOException;
+import java.lang.reflect.Array;
+import java.util.ArrayList;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>JSONServices</code> class defines various static methods for
+ * formatting and parsing the small JSON documents used as metadata by
+ * directory-based data stores.  Parsed objects are returned as
+ * <code>Map</code> (with insertion order preserved), <code>List</code>,
+ * <code>String</code>, <code>Long</code>, <code>Double</code>,
+ * <code>Boolean</code>, or null.  Formatting accepts the same types, plus
+ * any <code>Number</code> and primitive or object arrays.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class JSONServices {
+
+  ////////////////////////////////////////////////////////////
+
+  private JSONServices () { }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Formats an object as JSON text.  Non-finite floating point values are
+   * written as the strings "NaN", "Infinity", and "-Infinity" as is the
+   * convention in Zarr metadata.
+   *
+   * @param obj the object to format.
+   *
+   * @return the JSON text.
+   *
+   * @throws IllegalArgumentException if the object contains a value that
+   * cannot be represented in JSON.
+   */
+  public static String format (
+    Object obj
+  ) {
+
+    StringBuilder buffer = new StringBuilder();
+    format (obj, buffer, 0);
+    return (buffer.toString());
+
+  } // format
+
+  ////////////////////////////////////////////////////////////
+
+  /** Appends the indentation for the specified level. */
+  private static void indent (StringBuilder buffer, int level) {
+
+    buffer.append ('\n');
+    for (int i = 0; i < level; i++) buffer.append ("  ");
+
+  } // indent
+
+  ////////////////////////////////////////////////////////////
+
+  /** Formats an object into a buffer at the specified nesting level. */
+  private static void format (
+    Object obj,
+    StringBuilder buffer,
+    int level
+  ) {
+
+    // Format simple values
+    // --------------------
+    if (obj == null)
+      buffer.append ("null");
+    else if (obj instanceof String)
+      formatString ((String) obj, buffer);
+    else if (obj instanceof Boolean)
+      buffer.append (obj.toString());
+    else if (obj instanceof Double || obj instanceof Float) {
+      double value = ((Number) obj).doubleValue();
+      if (Double.isNaN (value)) buffer.append ("\"NaN\"");
+      else if (Double.isInfinite (value))
+        buffer.append (value > 0 ? "\"Infinity\"" : "\"-Infinity\"");
+      else buffer.append (obj.toString());
+    } // else if
+    else if (obj instanceof Number)
+      buffer.append (((Number) obj).longValue());
+
+    // Format map
+    // ----------
+    else if (obj instanceof Map) {
+      Map map = (Map) obj;
+      buffer.append ('{');
+      for (Iterator iter = map.entrySet().iterator(); iter.hasNext();) {
+        Map.Entry entry = (Map.Entry) iter.next();
+        indent (buffer, level+1);
+        formatString (entry.getKey().toString(), buffer);
+        buffer.append (": ");
+        format (entry.getValue(), buffer, level+1);
+        if (iter.hasNext()) buffer.append (',');
+      } // for
+      if (!map.isEmpty()) indent (buffer, level);
+      buffer.append ('}');
+    } // else if
+
+    // Format list or array
+    // --------------------
+    else if (obj instanceof List || obj.getClass().isArray()) {
+      List list = (obj instanceof List ? (List) obj : toList (obj));
+      buffer.append ('[');
+      for (int i = 0; i < list.size(); i++) {
+        if (i != 0) buffer.append (", ");
+        format (list.get (i), buffer, level+1);
+      } // for
+      buffer.append (']');
+    } // else if
+
+    else
+      throw new IllegalArgumentException ("Unsupported JSON value type " + obj.getClass());
+
+  } // format
+
+  ////////////////////////////////////////////////////////////
+
+  /** Converts a primitive or object array to a list. */
+  private static List toList (Object array) {
+
+    int length = Array.getLength (array);
+    List list = new ArrayList (length);
+    for (int i = 0; i < length; i++) list.add (Array.get (array, i));
+    return (list);
+
+  } // toList
+
+  ////////////////////////////////////////////////////////////
+
+  /** Formats a string value with quotes and escapes. */
+  private static void formatString (
+    String value,
+    StringBuilder buffer
+  ) {
+
+    buffer.append ('"');
+    for (int i = 0; i < value.length(); i++) {
+      char c = value.charAt (i);
+      switch (c) {
+      case '"': buffer.append ("\\\""); break;
+      case '\\': buffer.append ("\\\\"); break;
+      case '\n': buffer.append ("\\n"); break;
+      case '\r': buffer.append ("\\r"); break;
+      case '\t': buffer.append ("\\t"); break;
+      default:
+        if (c < 0x20) buffer.append (String.format ("\\u%04x", (int) c));
+        else buffer.append (c);
+      } // switch
+    } // for
+    buffer.append ('"');
+
+  } // formatString
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Parses JSON text into an object.
+   *
+   * @param text the JSON text to parse.
+   *
+   * @return the parsed object.
+   *
+   * @throws IOException if the text is not valid JSON.
+   */
+  public static Object parse (
+    String text
+  ) throws IOException {
+
+    Parser parser = new Parser (text);
+    Object obj = parser.parseValue();
+    parser.skipSpace();
+    if (parser.pos != text.length())
+      throw new IOException ("Unexpected trailing JSON text at position " + parser.pos);
+
+    return (obj);
+
+  } // parse
+
+  ////////////////////////////////////////////////////////////
+
+  /** Parses JSON values from a string, tracking the current position. */
+  private static class Parser {
+
+    /** The text being parsed. */
+    private String text;
+
+    /** The current parse position. */
+    private int pos;
+
+    ////////////////////////////////////////////////////////
+
+    public Parser (String text) { this.text = text; }
+
+    ////////////////////////////////////////////////////////
+
+    /** Skips any whitespace at the current position. */
+    public void skipSpace () {
+
+      while (pos < text.length() && Character.isWhitespace (text.charAt (pos))) pos++;
+
+    } // skipSpace
+
+    ////////////////////////////////////////////////////////
+
+    /** Checks for and consumes the expected character. */
+    private void expect (char c) throws IOException {
+
+      skipSpace();
+      if (pos >= text.length() || text.charAt (pos) != c)
+        throw new IOException ("Expected '" + c + "' in JSON text at position " + pos);
+      pos++;
+
+    } // expect
+
+    ////////////////////////////////////////////////////////
+
+    /** Checks if the next non-space character is the one specified. */
+    private boolean peek (char c) {
+
+      skipSpace();
+      return (pos < text.length() && text.charAt (pos) == c);
+
+    } // peek
+
+    ////////////////////////////////////////////////////////
+
+    /** Parses the value at the current position. */
+    public Object parseValue () throws IOException {
+
+      skipSpace();
+      if (pos >= text.length())
+        throw new IOException ("Unexpected end of JSON text");
+
+      Object value;
+      char c = text.charAt (pos);
+
+      // Parse object
+      // ------------
+      if (c == '{') {
+        pos++;
+        Map<String,Object> map = new LinkedHashMap<>();
+        if (peek ('}')) pos++;
+        else {
+          do {
+            skipSpace();
+            String key = parseString();
+            expect (':');
+            map.put (key, parseValue());
+            skipSpace();
+          } while (pos < text.length() && text.charAt (pos++) == ',');
+          if (text.charAt (pos-1) != '}')
+            throw new IOException ("Expected '}' in JSON text at position " + (pos-1));
+        } // else
+        value = map;
+      } // if
+
+      // Parse array
+      // -----------
+      else if (c == '[') {
+        pos++;
+        List<Object> list = new ArrayList<>();
+        if (peek (']')) pos++;
+        else {
+          do {
+            list.add (parseValue());
+            skipSpace();
+          } while (pos < text.length() && text.charAt (pos++) == ',');
+          if (text.charAt (pos-1) != ']')
+            throw new IOException ("Expected ']' in JSON text at position " + (pos-1));
+        } // else
+        value = list;
+      } // else if
+
+      // Parse literals
+      // --------------
+      else if (c == '"') value = parseString();
+      else if (text.startsWith ("true", pos)) { pos += 4; value = Boolean.TRUE; }
+      else if (text.startsWith ("false", pos)) { pos += 5; value = Boolean.FALSE; }
+      else if (text.startsWith ("null", pos)) { pos += 4; value = null; }
+      else value = parseNumber();
+
+      return (value);
+
+    } // parseValue
+
+    ////////////////////////////////////////////////////////
+
+    /** Parses a quoted string at the current position. */
+    private String parseString () throws IOException {
+
+      if (pos >= text.length() || text.charAt (pos) != '"')
+        throw new IOException ("Expected string in JSON text at position " + pos);
+      pos++;
+
+      StringBuilder buffer = new StringBuilder();
+      while (true) {
+        if (pos >= text.length())
+          throw new IOException ("Unterminated string in JSON text");
+        char c = text.charAt (pos++);
+        if (c == '"') break;
+        else if (c == '\\') {
+          if (pos >= text.length())
+            throw new IOException ("Unterminated string in JSON text");
+          char e = text.charAt (pos++);
+          switch (e) {
+          case 'b': buffer.append ('\b'); break;
+          case 'f': buffer.append ('\f'); break;
+          case 'n': buffer.append ('\n'); break;
+          case 'r': buffer.append ('\r'); break;
+          case 't': buffer.append ('\t'); break;
+          case 'u':
+            if (pos+4 > text.length())
+              throw new IOException ("Invalid unicode escape in JSON text");
+            buffer.append ((char) Integer.parseInt (text.substring (pos, pos+4), 16));
+            pos += 4;
+            break;
+          default: buffer.append (e);
+          } // switch
+        } // else if
+        else buffer.append (c);
+      } // while
+
+      return (buffer.toString());
+
+    } // parseString
+
+    ////////////////////////////////////////////////////////
+
+    /** Parses a number at the current position. */
+    private Number parseNumber () throws IOException {
+
+      int start = pos;
+      boolean isFloat = false;
+      while (pos < text.length()) {
+        char c = text.charAt (pos);
+        if (c == '.' || c == 'e' || c == 'E') isFloat = true;
+        else if (!(Character.isDigit (c) || c == '-' || c == '+')) break;
+        pos++;
+      } // while
+      String token = text.substring (start, pos);
+
+      try {
+        return (isFloat ? (Number) Double.valueOf (token) : (Number) Long.valueOf (token));
+      } // try
+      catch (NumberFormatException e) {
+        throw new IOException ("Invalid number '" + token + "' in JSON text at position " + start);
+      } // catch
+
+    } // parseNumber
+
+    ////////////////////////////////////////////////////////
+
+  } // Parser class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a double value from a parsed JSON value, accounting for the
+   * string representations of non-finite values.
+   *
+   * @param value the parsed value, either a <code>Number</code> or one of
+   * the strings "NaN", "Infinity", or "-Infinity".
+   *
+   * @return the double value.
+   *
+   * @throws IllegalArgumentException if the value is not numeric.
+   */
+  public static double toDouble (
+    Object value
+  ) {
+
+    double result;
+    if (value instanceof Number) result = ((Number) value).doubleValue();
+    else if ("NaN".equals (value)) result = Double.NaN;
+    else if ("Infinity".equals (value)) result = Double.POSITIVE_INFINITY;
+    else if ("-Infinity".equals (value)) result = Double.NEGATIVE_INFINITY;
+    else throw new IllegalArgumentException ("Value " + value + " is not numeric");
+
+    return (result);
+
+  } // toDouble
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (JSONServices.class);
+
+    // ------------------------->
+
+    logger.test ("format, parse");
+
+    Map<String,Object> map = new LinkedHashMap<>();
+    map.put ("zarr_format", 2);
+    map.put ("shape", new int[] {1024, 2048});
+    map.put ("dtype", "<f4");
+    map.put ("fill_value", Float.NaN);
+    map.put ("filters", null);
+    map.put ("scale", 0.01);
+    map.put ("flag", Boolean.TRUE);
+    map.put ("text", "quote \" and \\ and\ttab");
+    map.put ("empty", new LinkedHashMap());
+
+    Map parsed = (Map) parse (format (map));
+    assert (((Number) parsed.get ("zarr_format")).intValue() == 2);
+    assert (parsed.get ("shape").equals (List.of (1024L, 2048L)));
+    assert (parsed.get ("dtype").equals ("<f4"));
+    assert (Double.isNaN (toDouble (parsed.get ("fill_value"))));
+    assert (parsed.containsKey ("filters") && parsed.get ("filters") == null);
+    assert (((Double) parsed.get ("scale")) == 0.01);
+    assert (parsed.get ("flag").equals (Boolean.TRUE));
+    assert (parsed.get ("text").equals (map.get ("text")));
+    assert (((Map) parsed.get ("empty")).isEmpty());
+
+    boolean failed = false;
+    try { parse ("{\"a\": [1, 2}"); }
+    catch (IOException e) { failed = true; }
+    assert (failed);
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // JSONServices class
+
+////////////////////////////////////////////////////////////////////////
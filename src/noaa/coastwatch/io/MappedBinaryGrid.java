@@ -0,0 +1,299 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: MappedBinaryGrid.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.IOException;
+import java.lang.reflect.Array;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.MappedByteBuffer;
+import java.nio.channels.FileChannel;
+import noaa.coastwatch.io.CachedGrid;
+import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
+import noaa.coastwatch.io.tile.TilingScheme.Tile;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.Grid;
+
+/**
+ * The <code>MappedBinaryGrid</code> class is a read-only cached grid that
+ * accesses a flat binary array of values in a file through memory
+ * mapping.  The data values are stored in row-major order starting at
+ * a byte offset in the file.  Tiles are bands of complete rows, so that
+ * each tile is one contiguous region of the mapping.<p>
+ *
+ * Since the mapping is shared and never modified, the raw bytes of a
+ * tile may be accessed as a zero-copy buffer view using
+ * {@link #getTileBuffer}, and any subset of data may be read without
+ * the tile cache or locking using {@link #getSubsetData}.  Both are
+ * safe to use from multiple threads at once.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public class MappedBinaryGrid
+  extends CachedGrid {
+
+  // Constants
+  // ---------
+
+  /** Default tile size in bytes. */
+  public final static int DEFAULT_TILE_SIZE = 512*1024;
+
+  /** Default cache size in bytes. */
+  public final static int DEFAULT_CACHE_SIZE = (4*1024)*1024;
+
+  /** The maximum size of each mapped segment in bytes. */
+  private final static long MAX_SEGMENT_SIZE = 1L << 30;
+
+  // Variables
+  // ---------
+
+  /** The file channel used to create the mapping. */
+  private FileChannel channel;
+
+  /** The byte order of the data values. */
+  private ByteOrder order;
+
+  /** The number of bytes per data value. */
+  private int valueBytes;
+
+  /** The number of rows in each mapped segment. */
+  private int segmentRows;
+
+  /** The mapped segments of the data, each a band of rows. */
+  private MappedByteBuffer[] segments;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Constructs a new mapped grid.
+   *
+   * @param grid the grid to use for attributes.
+   * @param channel the file channel to map data from, open for reading.
+   * @param offset the byte offset of the first data value in the file.
+   * @param order the byte order of the data values.
+   *
+   * @throws IOException if the file is too short for the data or an
+   * error occurred creating the mapping.
+   */
+  public MappedBinaryGrid (
+    Grid grid,
+    FileChannel channel,
+    long offset,
+    ByteOrder order
+  ) throws IOException {
+
+    super (grid, READ_ONLY);
+    this.channel = channel;
+    this.order = order;
+
+    // Check file size
+    // ---------------
+    valueBytes = DataVariable.getClassBits (getDataClass())/8;
+    long rowBytes = (long) dims[COLS] * valueBytes;
+    long dataBytes = rowBytes * dims[ROWS];
+    if (offset + dataBytes > channel.size())
+      throw new IOException ("File too short for data of variable " + getName());
+
+    // Set tile dimensions
+    // -------------------
+    int tileRows = (int) Math.max (1, Math.min (dims[ROWS], DEFAULT_TILE_SIZE / rowBytes));
+    super.setTileDims (new int[] {tileRows, dims[COLS]});
+    setOptimizedCacheSize (DEFAULT_CACHE_SIZE);
+
+    // Map segments
+    // ------------
+    /**
+     * A single mapping is limited to 2 Gb, so we map the data in bands of
+     * rows.  Each segment is a whole number of tiles so that no tile or
+     * row crosses a segment boundary.
+     */
+    long tileBytes = rowBytes * tileRows;
+    segmentRows = tileRows * (int) Math.max (1, MAX_SEGMENT_SIZE / tileBytes);
+    int segmentCount = (dims[ROWS] + segmentRows - 1) / segmentRows;
+    segments = new MappedByteBuffer[segmentCount];
+    for (int i = 0; i < segmentCount; i++) {
+      int startRow = i*segmentRows;
+      int rows = Math.min (segmentRows, dims[ROWS] - startRow);
+      segments[i] = channel.map (FileChannel.MapMode.READ_ONLY,
+        offset + startRow*rowBytes, rows*rowBytes);
+    } // for
+
+  } // MappedBinaryGrid constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Has no effect.  The tiles of a mapped grid are always bands of
+   * complete rows.
+   *
+   * @param dims the tile dimensions as [rows, columns].
+   */
+  @Override
+  public void setTileDims (
+    int[] dims
+  ) {
+
+    // do nothing
+
+  } // setTileDims
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public Object getDataStream () { return (channel); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a buffer view of the bytes for a range of complete rows.
+   *
+   * @param row the starting row.
+   * @param rows the number of rows.
+   *
+   * @return the read-only buffer view with the data byte order.
+   */
+  private ByteBuffer getRowBuffer (
+    int row,
+    int rows
+  ) {
+
+    int segment = row / segmentRows;
+    int rowBytes = dims[COLS] * valueBytes;
+    ByteBuffer buffer = segments[segment].duplicate();
+    int position = (row - segment*segmentRows) * rowBytes;
+    buffer.position (position);
+    buffer.limit (position + rows*rowBytes);
+
+    return (buffer.slice().asReadOnlyBuffer().order (order));
+
+  } // getRowBuffer
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a zero-copy buffer view of the raw bytes of a tile.  The
+   * buffer is positioned at zero and has the byte order of the data.
+   *
+   * @param pos the tile position.
+   *
+   * @return the read-only buffer view of the tile bytes.
+   */
+  public ByteBuffer getTileBuffer (
+    TilePosition pos
+  ) {
+
+    int[] start = pos.getStart();
+    int[] length = pos.getDimensions();
+    return (getRowBuffer (start[ROWS], length[ROWS]));
+
+  } // getTileBuffer
+
+  ////////////////////////////////////////////////////////////
+
+  /** Copies values from a buffer into a primitive array. */
+  private static void copyValues (
+    ByteBuffer buffer,
+    Object data,
+    int offset,
+    int length
+  ) {
+
+    if (data instanceof byte[]) buffer.get ((byte[]) data, offset, length);
+    else if (data instanceof short[]) buffer.asShortBuffer().get ((short[]) data, offset, length);
+    else if (data instanceof int[]) buffer.asIntBuffer().get ((int[]) data, offset, length);
+    else if (data instanceof long[]) buffer.asLongBuffer().get ((long[]) data, offset, length);
+    else if (data instanceof float[]) buffer.asFloatBuffer().get ((float[]) data, offset, length);
+    else if (data instanceof double[]) buffer.asDoubleBuffer().get ((double[]) data, offset, length);
+
+  } // copyValues
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a subset of grid data values directly from the mapping,
+   * bypassing the tile cache.  This method may be called concurrently
+   * from multiple threads.
+   *
+   * @param start the subset starting [row, column].
+   * @param count the subset dimension [rows, columns].
+   *
+   * @return an array containing the unscaled data values.
+   *
+   * @throws IndexOutOfBoundsException if the subset falls outside the
+   * grid dimensions.
+   */
+  public Object getSubsetData (
+    int[] start,
+    int[] count
+  ) {
+
+    if (!checkSubset (start, count))
+      throw new IndexOutOfBoundsException ("Invalid subset");
+
+    Object data = Array.newInstance (getDataClass(), count[ROWS]*count[COLS]);
+    for (int i = 0; i < count[ROWS]; i++) {
+      ByteBuffer buffer = getRowBuffer (start[ROWS] + i, 1);
+      buffer.position (start[COLS]*valueBytes);
+      copyValues (buffer.slice().order (order), data, i*count[COLS], count[COLS]);
+    } // for
+
+    return (data);
+
+  } // getSubsetData
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected Tile readTile (
+    TilePosition pos
+  ) throws IOException {
+
+    int[] length = pos.getDimensions();
+    int values = length[ROWS]*length[COLS];
+    Object data = Array.newInstance (getDataClass(), values);
+    copyValues (getTileBuffer (pos), data, 0, values);
+
+    return (tiling.new Tile (pos, data));
+
+  } // readTile
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected void writeTile (
+    Tile tile
+  ) throws IOException {
+
+    throw new IOException ("Cannot write tile to read-only dataset");
+
+  } // writeTile
+
+  ////////////////////////////////////////////////////////////
+
+} // MappedBinaryGrid class
+
+////////////////////////////////////////////////////////////////////////
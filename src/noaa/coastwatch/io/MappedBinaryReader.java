@@ -0,0 +1,433 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: MappedBinaryReader.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.File;
+import java.io.IOException;
+import java.lang.reflect.Array;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.channels.FileChannel;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.nio.file.StandardOpenOption;
+import java.text.DecimalFormat;
+import java.text.NumberFormat;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.List;
+import java.util.Map;
+import noaa.coastwatch.io.BinaryWriter;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.FloatWriter;
+import noaa.coastwatch.io.MappedBinaryGrid;
+import noaa.coastwatch.io.ShortWriter;
+import noaa.coastwatch.io.JSONMetadataServices;
+import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.TimePeriod;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkProducer;
+import noaa.coastwatch.util.chunk.DataChunk;
+import noaa.coastwatch.util.chunk.DataChunkFactory;
+import noaa.coastwatch.util.chunk.GridChunkProducer;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.MapProjection;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+import noaa.coastwatch.util.trans.ProjectionConstants;
+import noaa.coastwatch.util.trans.SpheroidConstants;
+
+/**
+ * The <code>MappedBinaryReader</code> class reads raw binary grid files
+ * written by {@link BinaryWriter} with a JSON sidecar file.  The sidecar
+ * describes the data type, byte order, scaling, variable layout, and
+ * earth transform of the binary file.  Variable data is accessed by
+ * memory mapping the binary file, so that opening a variable does not
+ * read any data, and tiles and chunks are copied directly from the
+ * mapping without any stream decoding or locking.  The reader name
+ * passed to the constructor is the binary file name, not the sidecar.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class MappedBinaryReader
+  extends EarthDataReader {
+
+  // Constants
+  // ---------
+
+  /** The data format description. */
+  private static final String DATA_FORMAT = "CoastWatch binary";
+
+  // Variables
+  // ---------
+
+  /** The sidecar attributes. */
+  private Map<String,Object> attributes;
+
+  /** The variable layout entries from the sidecar. */
+  private List<Map<String,Object>> layouts;
+
+  /** The byte order of the data values. */
+  private ByteOrder order;
+
+  /** The channel open to the binary file. */
+  private FileChannel channel;
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public String getDataFormat () { return (DATA_FORMAT); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Constructs a reader from the specified binary file.
+   *
+   * @param name the binary file name to read.  The sidecar file name
+   * is determined using {@link BinaryWriter#getSidecarFile}.
+   *
+   * @throws IOException if an error occurred reading the sidecar
+   * file, or the file has no sidecar.
+   */
+  public MappedBinaryReader (
+    String name
+  ) throws IOException {
+
+    super (name);
+
+    // Read sidecar
+    // ------------
+    File sidecarFile = new File (BinaryWriter.getSidecarFile (name));
+    if (!sidecarFile.isFile())
+      throw new IOException ("Cannot find sidecar file for " + name);
+    attributes = JSONMetadataServices.readMetadata (sidecarFile);
+    if (!BinaryWriter.SIDECAR_FORMAT.equals (attributes.get ("format")))
+      throw new IOException ("Invalid sidecar file format for " + name);
+    rawMetadataMap.putAll (attributes);
+    rawMetadataMap.remove ("variables");
+
+    // Get byte order
+    // --------------
+    order = ("lsb".equals (attributes.get ("byte_order")) ?
+      ByteOrder.LITTLE_ENDIAN : ByteOrder.BIG_ENDIAN);
+
+    // Find 2D variables
+    // -----------------
+    layouts = new ArrayList<>();
+    List<String> nameList = new ArrayList<>();
+    Object varList = attributes.get ("variables");
+    if (varList instanceof List) {
+      for (Object obj : (List) varList) {
+        Map<String,Object> layout = (Map<String,Object>) obj;
+        Object dims = layout.get ("dims");
+        if (dims instanceof List && ((List) dims).size() == 2) {
+          layouts.add (layout);
+          nameList.add (layout.get ("name").toString());
+        } // if
+      } // for
+    } // if
+    variables = nameList.toArray (new String[0]);
+
+    // Create info
+    // -----------
+    if (!MapProjection.DESCRIPTION.equals (attributes.get ("projection_type")))
+      throw new IOException ("Unsupported projection type " + attributes.get ("projection_type"));
+    info = JSONMetadataServices.createInfo (attributes, JSONMetadataServices.createMapProjection (attributes));
+
+    // Open file
+    // ---------
+    channel = FileChannel.open (new File (name).toPath(), StandardOpenOption.READ);
+
+  } // MappedBinaryReader constructor
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected DataVariable getPreviewImpl (
+    int index
+  ) throws IOException {
+
+    Map<String,Object> layout = layouts.get (index);
+    String name = variables[index];
+
+    // Get data type and dimensions
+    // ----------------------------
+    String type = String.valueOf (attributes.get ("data_type"));
+    Class dataClass;
+    if (type.equals ("ubyte")) dataClass = Byte.TYPE;
+    else if (type.equals ("short")) dataClass = Short.TYPE;
+    else if (type.equals ("float")) dataClass = Float.TYPE;
+    else throw new IOException ("Unsupported data type " + type);
+    List dims = (List) layout.get ("dims");
+    int rows = ((Number) dims.get (Grid.ROWS)).intValue();
+    int cols = ((Number) dims.get (Grid.COLS)).intValue();
+
+    // Get scaling and missing value
+    // -----------------------------
+    Object scalingValue = attributes.get ("scaling");
+    double[] scaling = (scalingValue == null ? null : JSONMetadataServices.toDoubleArray (scalingValue));
+    if (scaling != null && scaling[0] == 1 && scaling[1] == 0) scaling = null;
+    Object missing = JSONMetadataServices.toMissing (attributes.get ("missing_value"), dataClass);
+
+    // Get format
+    // ----------
+    Object digitsValue = layout.get ("fraction_digits");
+    int digits = (digitsValue instanceof Number ? ((Number) digitsValue).intValue() : 0);
+    String decFormat = "0";
+    for (int i = 0; i < digits; i++) {
+      if (i == 0) decFormat += ".";
+      decFormat += "#";
+    } // for
+    NumberFormat format = new DecimalFormat (decFormat);
+
+    // Create grid
+    // -----------
+    Object longName = layout.get ("long_name");
+    Object units = layout.get ("units");
+    Grid grid = new Grid (
+      name,
+      (longName == null ? name : longName.toString()),
+      (units == null ? "" : units.toString()),
+      rows, cols,
+      Array.newInstance (dataClass, 1),
+      format,
+      scaling,
+      missing
+    );
+    grid.setUnsigned (type.equals ("ubyte"));
+
+    return (grid);
+
+  } // getPreviewImpl
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public DataVariable getVariable (
+    int index
+  ) throws IOException {
+
+    Grid preview = (Grid) getPreview (index);
+    long offset = ((Number) layouts.get (index).get ("offset")).longValue();
+    return (new MappedBinaryGrid (preview, channel, offset, order));
+
+  } // getVariable
+
+  ////////////////////////////////////////////////////////////
+
+  /** Produces data chunks directly from the file mapping. */
+  private static class MappedChunkProducer extends GridChunkProducer {
+
+    public MappedChunkProducer (MappedBinaryGrid grid) { super (grid); }
+
+    @Override
+    public DataChunk getChunk (ChunkPosition pos) {
+
+      Object data = ((MappedBinaryGrid) grid).getSubsetData (pos.start, pos.length);
+      return (DataChunkFactory.getInstance().create (data,
+        grid.getUnsigned(), grid.getMissing(), packing, scaling));
+
+    } // getChunk
+
+  } // MappedChunkProducer class
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public ChunkProducer getChunkProducer (
+    String name
+  ) throws IOException {
+
+    return (new MappedChunkProducer ((MappedBinaryGrid) getVariable (name)));
+
+  } // getChunkProducer
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public void close () throws IOException { channel.close(); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (MappedBinaryReader.class);
+
+    // ------------------------->
+
+    logger.test ("Framework");
+
+    int rows = 300, cols = 250;
+    EarthTransform trans = MapProjectionFactory.getInstance().create (
+      ProjectionConstants.MERCAT,
+      0,
+      new double[15],
+      SpheroidConstants.WGS84,
+      new int[] {rows, cols},
+      new EarthLocation (48, -125),
+      new double[] {2000, 2000}
+    );
+    SatelliteDataInfo info = new SatelliteDataInfo (
+      "petros-1",
+      "java-19",
+      Arrays.asList (new TimePeriod (new Date (86400000L*20000 + 3600000L), 12*60*1000)),
+      trans,
+      "Petros RS Inc.",
+      "Created by unit test"
+    );
+
+    float[] sstData = new float[rows*cols];
+    for (int i = 0; i < sstData.length; i++) sstData[i] = (i % 3000 - 1000)*0.01f;
+    sstData[17] = Float.NaN;
+    Grid sst = new Grid ("sst", "Sea surface temperature", "degrees_Celsius",
+      rows, cols, sstData, new DecimalFormat ("0.00"), null, Float.NaN);
+    Grid cloud = new Grid ("cloud", "Cloud fraction", "",
+      rows, cols, sstData.clone(), new DecimalFormat ("0.00"), null, Float.NaN);
+
+    Path dir = Files.createTempDirectory ("MappedBinaryReaderTest");
+    String shortPath = new File (dir.toFile(), "test_short.dat").getPath();
+    String floatPath = new File (dir.toFile(), "test_float.dat").getPath();
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("BinaryWriter sidecar");
+
+    BinaryWriter writer = new ShortWriter (info, shortPath);
+    writer.setOrder (BinaryWriter.LSB);
+    writer.setHeader (true);
+    writer.setScaling (new double[] {0.01, 0});
+    writer.setSidecar (true);
+    writer.addVariable (sst);
+    writer.addVariable (cloud);
+    writer.close();
+    assert (new File (BinaryWriter.getSidecarFile (shortPath)).isFile());
+
+    writer = new FloatWriter (info, floatPath);
+    writer.setOrder (BinaryWriter.MSB);
+    writer.setSidecar (true);
+    writer.addVariable (sst);
+    writer.close();
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("constructor, getInfo");
+
+    EarthDataReader reader = EarthDataReaderFactory.create (shortPath);
+    assert (reader instanceof MappedBinaryReader);
+    assert (reader.getVariables() == 2);
+    EarthDataInfo readInfo = reader.getInfo();
+    assert (readInfo instanceof SatelliteDataInfo);
+    assert (readInfo.getStartDate().equals (info.getStartDate()));
+    assert (readInfo.getTransform().equals (trans));
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getVariable, getTileBuffer");
+
+    Grid readCloud = (Grid) reader.getVariable ("cloud");
+    assert (readCloud instanceof MappedBinaryGrid);
+    assert (readCloud.getDataClass().equals (Short.TYPE));
+    for (int i = 0; i < sstData.length; i += 97) {
+      DataLocation loc = new DataLocation (i/cols, i%cols);
+      double expected = sstData[i];
+      double actual = readCloud.getValue (loc);
+      if (Double.isNaN (expected)) assert (Double.isNaN (actual));
+      else assert (Math.abs (expected - actual) < 1e-4);
+    } // for
+
+    MappedBinaryGrid mapped = (MappedBinaryGrid) readCloud;
+    TilePosition pos = mapped.getTilingScheme().new TilePosition (0, 0);
+    ByteBuffer buffer = mapped.getTileBuffer (pos);
+    assert (buffer.order().equals (ByteOrder.LITTLE_ENDIAN));
+    assert (buffer.getShort (2*20) == (short) -980);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getChunkProducer");
+
+    ChunkProducer producer = reader.getChunkProducer ("sst");
+    ChunkPosition chunkPos = new ChunkPosition (2);
+    chunkPos.start[Grid.ROWS] = 10;
+    chunkPos.start[Grid.COLS] = 5;
+    chunkPos.length[Grid.ROWS] = 7;
+    chunkPos.length[Grid.COLS] = 11;
+    DataChunk chunk = producer.getChunk (chunkPos);
+    short[] chunkData = (short[]) chunk.getPrimitiveData();
+    assert (chunkData[0] == (short) Math.round (sstData[10*cols + 5]*100));
+    assert (chunkData[6*11 + 10] == (short) Math.round (sstData[16*cols + 15]*100));
+    reader.close();
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("big endian float data");
+
+    reader = EarthDataReaderFactory.create (floatPath);
+    Grid readSst = (Grid) reader.getVariable ("sst");
+    assert (readSst.getDataClass().equals (Float.TYPE));
+    assert (readSst.getScaling() == null);
+    for (int i = 0; i < sstData.length; i += 89) {
+      DataLocation loc = new DataLocation (i/cols, i%cols);
+      assert (Double.compare (sstData[i], readSst.getValue (loc)) == 0);
+    } // for
+    assert (Double.isNaN (readSst.getValue (new DataLocation (0, 17))));
+    reader.close();
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // MappedBinaryReader class
+
+////////////////////////////////////////////////////////////////////////
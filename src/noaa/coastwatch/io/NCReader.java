@@ -38,6 +38,7 @@ import noaa.coastwatch.io.IOServices;
 import noaa.coastwatch.io.NCSD;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
 import ucar.ma2.InvalidRangeException;
 import ucar.nc2.Attribute;
 import ucar.nc2.NetcdfFile;
@@ -302,6 +303,32 @@ public abstract class NCReader
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Copies any statistics summary attributes of a NetCDF variable to
+   * the metadata of a data variable.
+   *
+   * @param var the variable to access.
+   * @param dataVar the data variable to copy the attributes to.
+   *
+   * @see Statistics#fromAttributes
+   *
+   * @since 3.7.0
+   */
+  protected static void getStatisticsAttributes (
+    Variable var, 
+    DataVariable dataVar
+  ) {
+
+    for (Attribute att : var.getAttributes()) {
+      String attName = att.getShortName();
+      if (attName.startsWith (Statistics.ATTRIBUTE_PREFIX))
+        dataVar.getMetadataMap().put (attName, convertAttributeValue (att, false));
+    } // for
+
+  } // getStatisticsAttributes
+
+  ////////////////////////////////////////////////////////////
+
   /** Returns true if this reader is network-connected. */
   public boolean isNetwork () { return (isNetwork); }
 
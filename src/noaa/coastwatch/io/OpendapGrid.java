@@ -30,6 +30,7 @@ import java.io.IOException;
 import java.util.Arrays;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
 import opendap.dap.DConnect2;
 import opendap.dap.DVector;
 import opendap.dap.DataDDS;
@@ -84,6 +85,7 @@ public class OpendapGrid
     // Initialize
     // ----------
     super (grid);
+    Statistics.copyAttributes (grid.getMetadataMap(), getMetadataMap());
     connect = new DConnect2 (url, true);
 
     // Create zero size start and end
@@ -216,6 +218,19 @@ public class OpendapGrid
 
   ////////////////////////////////////////////////////////////
 
+  public void getValues (
+    int row,
+    int startCol,
+    int count,
+    double[] values
+  ) {
+
+    for (int i = 0; i < count; i++) values[i] = getValue (row, startCol + i);
+
+  } // getValues
+
+  ////////////////////////////////////////////////////////////
+
   public double getValue (
     int row,
     int col
@@ -0,0 +1,779 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: PNGWriter.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.awt.image.BufferedImage;
+import java.awt.image.IndexColorModel;
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.DataOutputStream;
+import java.io.IOException;
+import java.io.OutputStream;
+import java.nio.charset.StandardCharsets;
+import java.util.LinkedList;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.zip.Adler32;
+import java.util.zip.CRC32;
+import java.util.zip.Deflater;
+import javax.imageio.ImageIO;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>PNGWriter</code> class writes 8-bit RGB or indexed color PNG
+ * images that are delivered as a series of horizontal strips.  Each strip
+ * is filtered and compressed in a pool of threads as an independent
+ * section of the zlib data stream, and the strips are written to the
+ * output in order as they complete.  Only a few strips are held in memory
+ * at any one time, so very large images can be written without holding
+ * the entire image in memory, and the compression scales with the number
+ * of processors.<p>
+ *
+ * Each strip except the last is compressed with a deflate sync flush so
+ * that the compressed strips may be concatenated, and the Adler-32
+ * checksums of the strips are combined to form the checksum for the zlib
+ * stream trailer.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class PNGWriter {
+
+  // Constants
+  // ---------
+
+  /** The PNG file signature. */
+  private static final byte[] SIGNATURE = new byte[] {
+    (byte) 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n'
+  };
+
+  /** The zlib stream header for deflate with a 32k window. */
+  private static final byte[] ZLIB_HEADER = new byte[] {0x78, (byte) 0x9c};
+
+  /** The modulus used in Adler-32 checksums. */
+  private static final long ADLER_BASE = 65521;
+
+  /** The PNG filter types. */
+  private static final int FILTER_NONE = 0;
+  private static final int FILTER_SUB = 1;
+  private static final int FILTER_UP = 2;
+  private static final int FILTER_AVERAGE = 3;
+  private static final int FILTER_PAETH = 4;
+
+  // Variables
+  // ---------
+
+  /** The output stream for writing. */
+  private DataOutputStream output;
+
+  /** The image width in pixels. */
+  private int width;
+
+  /** The image height in pixels. */
+  private int height;
+
+  /** The color model for indexed images, or null for RGB. */
+  private IndexColorModel colorModel;
+
+  /** The bytes per pixel, 3 for RGB and 1 for indexed. */
+  private int bytesPerPixel;
+
+  /** The next row to be delivered in a strip. */
+  private int nextRow;
+
+  /** The last row of the previous strip, used for filtering. */
+  private byte[] lastRow;
+
+  /** The running Adler-32 checksum of the uncompressed data. */
+  private long adler;
+
+  /** The header written flag, true if the header chunks were written. */
+  private boolean headerWritten;
+
+  /** The pending strip compression tasks in strip order. */
+  private LinkedList<Future<CompressedStrip>> pendingList;
+
+  /** The pool of compression threads, or null if not started. */
+  private ExecutorService pool;
+
+  /** The maximum number of strips to compress in parallel. */
+  private int maxOperations = Runtime.getRuntime().availableProcessors();
+
+  /** The maximum number of strips waiting to be written. */
+  private int maxPending = 2*Math.max (1, maxOperations);
+
+  /** The deflate compression level. */
+  private int level = Deflater.DEFAULT_COMPRESSION;
+
+  /** The list of text keyword and value pairs. */
+  private LinkedList<String[]> textList;
+
+  ////////////////////////////////////////////////////////////
+
+  /** Holds the compressed data for one strip. */
+  private static class CompressedStrip {
+    public byte[] data;
+    public long adler;
+    public long length;
+  } // CompressedStrip class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new writer using the specified output stream.
+   *
+   * @param output the output stream for writing.
+   * @param width the image width in pixels.
+   * @param height the image height in pixels.
+   * @param colorModel the color model for an indexed color image with
+   * 256 colors or less, or null to write a 24-bit RGB image.
+   */
+  public PNGWriter (
+    OutputStream output,
+    int width,
+    int height,
+    IndexColorModel colorModel
+  ) {
+
+    if (colorModel != null && colorModel.getMapSize() > 256)
+      throw new IllegalArgumentException ("Index color model has too many colors");
+
+    this.output = new DataOutputStream (output);
+    this.width = width;
+    this.height = height;
+    this.colorModel = colorModel;
+    this.bytesPerPixel = (colorModel == null ? 3 : 1);
+    this.adler = 1;
+    this.pendingList = new LinkedList<>();
+    this.textList = new LinkedList<>();
+
+  } // PNGWriter constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the maximum number of strips to compress in parallel.  The
+   * default is to use the number of available processors reported by the
+   * Java runtime.  Up to twice this number of strips may be waiting to be
+   * written at any time.
+   *
+   * @param ops the maximum number of parallel operations.
+   */
+  public void setMaxOperations (
+    int ops
+  ) {
+
+    this.maxOperations = ops;
+    this.maxPending = 2*Math.max (1, ops);
+
+  } // setMaxOperations
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the deflate compression level.
+   *
+   * @param level the compression level in the range [0..9], or -1 for
+   * the default level.
+   */
+  public void setCompressionLevel (
+    int level
+  ) {
+
+    this.level = level;
+
+  } // setCompressionLevel
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Adds a text entry to the file.  Text entries must be added before
+   * the first strip is written.
+   *
+   * @param keyword the text keyword, 1 to 79 Latin-1 characters.
+   * @param value the text value.
+   */
+  public void addText (
+    String keyword,
+    String value
+  ) {
+
+    if (headerWritten) throw new IllegalStateException ("Header already written");
+    textList.add (new String[] {keyword, value});
+
+  } // addText
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the recommended number of rows for each strip.  The strip height
+   * is chosen so that a strip holds about 4 million pixels, small enough
+   * that a few strips may be held in memory while still giving the
+   * compression threads enough work.
+   *
+   * @param width the image width in pixels.
+   * @param height the image height in pixels.
+   *
+   * @return the strip height in rows.
+   */
+  public static int getStripRows (
+    int width,
+    int height
+  ) {
+
+    int rows = (1 << 22) / Math.max (width, 1);
+    return (Math.max (1, Math.min (height, rows)));
+
+  } // getStripRows
+
+  ////////////////////////////////////////////////////////////
+
+  /** Writes a PNG chunk with the specified type and data. */
+  private void writeChunk (
+    String type,
+    byte[] data,
+    int length
+  ) throws IOException {
+
+    byte[] typeBytes = type.getBytes (StandardCharsets.US_ASCII);
+    CRC32 crc = new CRC32();
+    crc.update (typeBytes);
+    crc.update (data, 0, length);
+    output.writeInt (length);
+    output.write (typeBytes);
+    output.write (data, 0, length);
+    output.writeInt ((int) crc.getValue());
+
+  } // writeChunk
+
+  ////////////////////////////////////////////////////////////
+
+  /** Writes the PNG signature and header chunks. */
+  private void writeHeader () throws IOException {
+
+    output.write (SIGNATURE);
+
+    // Write image header
+    // ------------------
+    ByteArrayOutputStream byteStream = new ByteArrayOutputStream();
+    DataOutputStream dataStream = new DataOutputStream (byteStream);
+    dataStream.writeInt (width);
+    dataStream.writeInt (height);
+    dataStream.writeByte (8);
+    dataStream.writeByte (colorModel == null ? 2 : 3);
+    dataStream.writeByte (0);
+    dataStream.writeByte (0);
+    dataStream.writeByte (0);
+    byte[] data = byteStream.toByteArray();
+    writeChunk ("IHDR", data, data.length);
+
+    // Write palette
+    // -------------
+    if (colorModel != null) {
+      int colors = colorModel.getMapSize();
+      data = new byte[colors*3];
+      for (int i = 0; i < colors; i++) {
+        data[i*3] = (byte) colorModel.getRed (i);
+        data[i*3+1] = (byte) colorModel.getGreen (i);
+        data[i*3+2] = (byte) colorModel.getBlue (i);
+      } // for
+      writeChunk ("PLTE", data, data.length);
+    } // if
+
+    // Write text entries
+    // ------------------
+    for (String[] entry : textList) {
+      byteStream.reset();
+      byteStream.write (entry[0].getBytes (StandardCharsets.ISO_8859_1));
+      byteStream.write (0);
+      byteStream.write (entry[1].getBytes (StandardCharsets.ISO_8859_1));
+      data = byteStream.toByteArray();
+      writeChunk ("tEXt", data, data.length);
+    } // for
+
+    // Write zlib header
+    // -----------------
+    writeChunk ("IDAT", ZLIB_HEADER, ZLIB_HEADER.length);
+    headerWritten = true;
+
+  } // writeHeader
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Writes a strip of the image.  Strips must be written in order from
+   * the top of the image, and the strip must be the same width as the
+   * image.
+   *
+   * @param strip the strip image.  For RGB output the strip colors are
+   * retrieved using the image RGB values, and for indexed color output
+   * the strip must be a <code>TYPE_BYTE_INDEXED</code> image that uses
+   * the same color model as this writer.
+   *
+   * @throws IOException if an error occurred writing to the output
+   * stream, or compressing a previous strip.
+   */
+  public void writeStrip (
+    BufferedImage strip
+  ) throws IOException {
+
+    // Check strip
+    // -----------
+    int rows = strip.getHeight();
+    if (strip.getWidth() != width)
+      throw new IllegalArgumentException ("Strip width " + strip.getWidth() + " does not match image width " + width);
+    if (nextRow + rows > height)
+      throw new IllegalArgumentException ("Strip extends past last image row");
+
+    // Start writing
+    // -------------
+    if (!headerWritten) writeHeader();
+    if (pool == null) {
+      pool = Executors.newFixedThreadPool (Math.max (1, maxOperations), runnable -> {
+        Thread thread = new Thread (runnable, "PNGWriter");
+        thread.setDaemon (true);
+        return (thread);
+      });
+    } // if
+
+    // Get strip data
+    // --------------
+    int rowBytes = width*bytesPerPixel;
+    byte[] data = new byte[rows*rowBytes];
+    if (colorModel == null) {
+      int[] rgbRow = new int[width];
+      for (int y = 0; y < rows; y++) {
+        strip.getRGB (0, y, width, 1, rgbRow, 0, width);
+        int index = y*rowBytes;
+        for (int x = 0; x < width; x++) {
+          int rgb = rgbRow[x];
+          data[index++] = (byte) (rgb >>> 16);
+          data[index++] = (byte) (rgb >>> 8);
+          data[index++] = (byte) rgb;
+        } // for
+      } // for
+    } // if
+    else {
+      strip.getRaster().getDataElements (0, 0, width, rows, data);
+    } // else
+
+    // Submit compression task
+    // -----------------------
+    byte[] previousRow = lastRow;
+    lastRow = new byte[rowBytes];
+    System.arraycopy (data, (rows-1)*rowBytes, lastRow, 0, rowBytes);
+    nextRow += rows;
+    boolean isLast = (nextRow == height);
+    pendingList.add (pool.submit (() -> compressStrip (data, rows, previousRow, isLast)));
+
+    // Write completed strips
+    // ----------------------
+    /**
+     * We limit the number of strips waiting to be written to twice the
+     * number of compression threads.  This keeps every thread busy while
+     * the next strips are rendered, and bounds memory use even if strips
+     * are delivered faster than they can be compressed.
+     */
+    while (!pendingList.isEmpty() &&
+      (pendingList.size() > maxPending || pendingList.getFirst().isDone()))
+      writePending();
+
+  } // writeStrip
+
+  ////////////////////////////////////////////////////////////
+
+  /** Writes the first pending strip, waiting for it if needed. */
+  private void writePending () throws IOException {
+
+    CompressedStrip compressed;
+    try { compressed = pendingList.removeFirst().get(); }
+    catch (Exception e) {
+      pool.shutdownNow();
+      throw new IOException ("Error compressing PNG strip: " + e.getMessage());
+    } // catch
+    writeChunk ("IDAT", compressed.data, compressed.data.length);
+    adler = combineAdler (adler, compressed.adler, compressed.length);
+
+  } // writePending
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finishes writing the image and flushes the output stream.  The
+   * output stream is not closed.
+   *
+   * @throws IOException if an error occurred writing to the output
+   * stream, or if not all image rows have been written.
+   */
+  public void finish () throws IOException {
+
+    try {
+
+      // Write remaining strips
+      // ----------------------
+      if (nextRow != height)
+        throw new IOException ("Only " + nextRow + " of " + height + " image rows written");
+      while (!pendingList.isEmpty()) writePending();
+
+      // Write trailer
+      // -------------
+      byte[] trailer = new byte[] {
+        (byte) (adler >>> 24),
+        (byte) (adler >>> 16),
+        (byte) (adler >>> 8),
+        (byte) adler
+      };
+      writeChunk ("IDAT", trailer, trailer.length);
+      writeChunk ("IEND", new byte[0], 0);
+      output.flush();
+
+    } // try
+
+    finally {
+      if (pool != null) pool.shutdown();
+    } // finally
+
+  } // finish
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Disposes of the resources used by this writer.  Any strips still
+   * being compressed are abandoned.  This method should be called in a
+   * finally block after writing, so that the compression threads are
+   * stopped even if the image could not be completed.
+   */
+  public void dispose () {
+
+    if (pool != null) pool.shutdownNow();
+    pendingList.clear();
+
+  } // dispose
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Filters and compresses a strip of image data.
+   *
+   * @param data the unfiltered strip data.
+   * @param rows the number of rows in the strip.
+   * @param previousRow the unfiltered row just above the strip, or null if
+   * this is the first strip.
+   * @param isLast the last strip flag, true if the strip should finish
+   * the deflate stream.
+   *
+   * @return the compressed strip.
+   */
+  private CompressedStrip compressStrip (
+    byte[] data,
+    int rows,
+    byte[] previousRow,
+    boolean isLast
+  ) {
+
+    // Filter rows
+    // -----------
+    int rowBytes = width*bytesPerPixel;
+    byte[] filtered = new byte[rows*(rowBytes+1)];
+    byte[] zeroRow = new byte[rowBytes];
+    byte[] candidate = new byte[rowBytes];
+    for (int y = 0; y < rows; y++) {
+      byte[] prior;
+      int priorOffset;
+      if (y == 0) {
+        prior = (previousRow == null ? zeroRow : previousRow);
+        priorOffset = 0;
+      } // if
+      else {
+        prior = data;
+        priorOffset = (y-1)*rowBytes;
+      } // else
+      filterRow (data, y*rowBytes, prior, priorOffset, filtered,
+        y*(rowBytes+1), candidate);
+    } // for
+
+    // Compress data
+    // -------------
+    CompressedStrip compressed = new CompressedStrip();
+    Adler32 checksum = new Adler32();
+    checksum.update (filtered);
+    compressed.adler = checksum.getValue();
+    compressed.length = filtered.length;
+
+    Deflater deflater = new Deflater (level, true);
+    ByteArrayOutputStream byteStream = new ByteArrayOutputStream (filtered.length/4 + 64);
+    byte[] buffer = new byte[65536];
+    try {
+      deflater.setInput (filtered);
+      if (isLast) {
+        deflater.finish();
+        while (!deflater.finished()) {
+          int count = deflater.deflate (buffer);
+          byteStream.write (buffer, 0, count);
+        } // while
+      } // if
+      else {
+        int count;
+        do {
+          count = deflater.deflate (buffer, 0, buffer.length, Deflater.SYNC_FLUSH);
+          byteStream.write (buffer, 0, count);
+        } while (count == buffer.length);
+      } // else
+    } // try
+    finally {
+      deflater.end();
+    } // finally
+    compressed.data = byteStream.toByteArray();
+
+    return (compressed);
+
+  } // compressStrip
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Filters a row of image data.  Indexed color rows are not filtered,
+   * as recommended by the PNG specification.  For RGB rows, the filter
+   * type with the minimum sum of absolute differences is used.
+   *
+   * @param data the unfiltered data array.
+   * @param offset the offset of the row in the data array.
+   * @param prior the unfiltered prior row data array.
+   * @param priorOffset the offset of the prior row.
+   * @param filtered the filtered output array.
+   * @param filteredOffset the offset of the filter type byte in the output.
+   * @param candidate a temporary row for testing filter types.
+   */
+  private void filterRow (
+    byte[] data,
+    int offset,
+    byte[] prior,
+    int priorOffset,
+    byte[] filtered,
+    int filteredOffset,
+    byte[] candidate
+  ) {
+
+    int rowBytes = width*bytesPerPixel;
+    int bpp = bytesPerPixel;
+
+    // Copy unfiltered
+    // ---------------
+    filtered[filteredOffset] = FILTER_NONE;
+    System.arraycopy (data, offset, filtered, filteredOffset+1, rowBytes);
+    if (colorModel != null) return;
+    long bestSum = 0;
+    for (int i = 0; i < rowBytes; i++) bestSum += Math.abs (data[offset+i]);
+
+    // Try other filter types
+    // ----------------------
+    for (int type = FILTER_SUB; type <= FILTER_PAETH; type++) {
+      long sum = 0;
+      for (int i = 0; i < rowBytes; i++) {
+        int raw = data[offset+i] & 0xff;
+        int left = (i < bpp ? 0 : data[offset+i-bpp] & 0xff);
+        int up = prior[priorOffset+i] & 0xff;
+        int upLeft = (i < bpp ? 0 : prior[priorOffset+i-bpp] & 0xff);
+        int predict;
+        switch (type) {
+        case FILTER_SUB: predict = left; break;
+        case FILTER_UP: predict = up; break;
+        case FILTER_AVERAGE: predict = (left + up) >>> 1; break;
+        default: predict = paeth (left, up, upLeft); break;
+        } // switch
+        byte value = (byte) (raw - predict);
+        candidate[i] = value;
+        sum += Math.abs (value);
+      } // for
+      if (sum < bestSum) {
+        bestSum = sum;
+        filtered[filteredOffset] = (byte) type;
+        System.arraycopy (candidate, 0, filtered, filteredOffset+1, rowBytes);
+      } // if
+    } // for
+
+  } // filterRow
+
+  ////////////////////////////////////////////////////////////
+
+  /** Computes the PNG Paeth predictor. */
+  private static int paeth (
+    int left,
+    int up,
+    int upLeft
+  ) {
+
+    int p = left + up - upLeft;
+    int pa = Math.abs (p - left);
+    int pb = Math.abs (p - up);
+    int pc = Math.abs (p - upLeft);
+    if (pa <= pb && pa <= pc) return (left);
+    else if (pb <= pc) return (up);
+    else return (upLeft);
+
+  } // paeth
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Combines two Adler-32 checksums into the checksum of the
+   * concatenated data, using the same method as the zlib
+   * <code>adler32_combine</code> function.
+   *
+   * @param adler1 the checksum of the first data block.
+   * @param adler2 the checksum of the second data block.
+   * @param length2 the length of the second data block in bytes.
+   *
+   * @return the checksum of the first block followed by the second.
+   */
+  public static long combineAdler (
+    long adler1,
+    long adler2,
+    long length2
+  ) {
+
+    long rem = length2 % ADLER_BASE;
+    long sum1 = adler1 & 0xffff;
+    long sum2 = (rem * sum1) % ADLER_BASE;
+    sum1 += (adler2 & 0xffff) + ADLER_BASE - 1;
+    sum2 += ((adler1 >>> 16) & 0xffff) + ((adler2 >>> 16) & 0xffff) + ADLER_BASE - rem;
+    if (sum1 >= ADLER_BASE) sum1 -= ADLER_BASE;
+    if (sum1 >= ADLER_BASE) sum1 -= ADLER_BASE;
+    if (sum2 >= (ADLER_BASE << 1)) sum2 -= (ADLER_BASE << 1);
+    if (sum2 >= ADLER_BASE) sum2 -= ADLER_BASE;
+
+    return (sum1 | (sum2 << 16));
+
+  } // combineAdler
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (PNGWriter.class);
+
+    // ------------------------->
+
+    logger.test ("combineAdler");
+
+    byte[] testData = new byte[100000];
+    java.util.Random random = new java.util.Random (0);
+    random.nextBytes (testData);
+    Adler32 total = new Adler32();
+    total.update (testData);
+    long combined = 1;
+    int split = 0;
+    for (int length : new int[] {1, 65520, 65521, 30000, 4458}) {
+      Adler32 part = new Adler32();
+      part.update (testData, split, length);
+      combined = combineAdler (combined, part.getValue(), length);
+      split += length;
+    } // for
+    assert (split == testData.length);
+    assert (combined == total.getValue());
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("writeStrip, finish (RGB)");
+
+    int width = 173, height = 211;
+    BufferedImage image = new BufferedImage (width, height, BufferedImage.TYPE_INT_RGB);
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        int rgb = (y < height/2 ? random.nextInt() : (x*7) << 16 | (y*3) << 8 | (x+y));
+        image.setRGB (x, y, rgb & 0xffffff);
+      } // for
+    } // for
+
+    ByteArrayOutputStream byteStream = new ByteArrayOutputStream();
+    PNGWriter writer = new PNGWriter (byteStream, width, height, null);
+    writer.setMaxOperations (3);
+    writer.addText ("Software", "PNGWriter test");
+    for (int y = 0; y < height; y += 20) {
+      int rows = Math.min (20, height - y);
+      writer.writeStrip (image.getSubimage (0, y, width, rows));
+    } // for
+    writer.finish();
+
+    BufferedImage readImage = ImageIO.read (new ByteArrayInputStream (byteStream.toByteArray()));
+    assert (readImage.getWidth() == width);
+    assert (readImage.getHeight() == height);
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        assert ((readImage.getRGB (x, y) & 0xffffff) == (image.getRGB (x, y) & 0xffffff));
+      } // for
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("writeStrip, finish (indexed)");
+
+    byte[] levels = new byte[256];
+    for (int i = 0; i < 256; i++) levels[i] = (byte) (255-i);
+    IndexColorModel model = new IndexColorModel (8, 256, levels, levels, levels);
+    image = new BufferedImage (width, height, BufferedImage.TYPE_BYTE_INDEXED, model);
+    byte[] byteRow = new byte[width];
+    for (int y = 0; y < height; y++) {
+      random.nextBytes (byteRow);
+      image.getRaster().setDataElements (0, y, width, 1, byteRow);
+    } // for
+
+    byteStream = new ByteArrayOutputStream();
+    writer = new PNGWriter (byteStream, width, height, model);
+    writer.writeStrip (image.getSubimage (0, 0, width, 100));
+    writer.writeStrip (image.getSubimage (0, 100, width, height-100));
+    writer.finish();
+
+    readImage = ImageIO.read (new ByteArrayInputStream (byteStream.toByteArray()));
+    for (int y = 0; y < height; y++) {
+      for (int x = 0; x < width; x++) {
+        assert ((readImage.getRGB (x, y) & 0xffffff) == (image.getRGB (x, y) & 0xffffff));
+      } // for
+    } // for
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // PNGWriter class
+
+////////////////////////////////////////////////////////////////////////
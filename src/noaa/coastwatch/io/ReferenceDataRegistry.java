@@ -0,0 +1,337 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: ReferenceDataRegistry.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.lang.reflect.Array;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.logging.Logger;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.io.IOServices;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
+import noaa.coastwatch.util.LandMask;
+import noaa.coastwatch.util.trans.EarthTransform;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>ReferenceDataRegistry</code> class holds the bundled reference
+ * datasets used by overlays and tools, such as topography and land
+ * masks, so that each one is loaded only once per process no matter how
+ * many views or objects use it.  A dataset variable is read in full and
+ * decoded into an in-memory grid the first time it's requested, and the
+ * data file is then closed.  The same grid is returned to all later
+ * requests.  The shared grids are read-only, and are safe for concurrent
+ * reads from multiple threads since they hold no file or tile cache
+ * state.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class ReferenceDataRegistry {
+
+  private static final Logger LOGGER = Logger.getLogger (ReferenceDataRegistry.class.getName());
+
+  // Variables
+  // ---------
+
+  /** The single instance of this class. */
+  private static ReferenceDataRegistry instance;
+
+  /** The map of resource path and variable name to loaded data. */
+  private Map<String, ReferenceData> dataMap = new ConcurrentHashMap<>();
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>ReferenceData</code> class holds a shared read-only grid
+   * and its earth transform.
+   */
+  public static class ReferenceData {
+
+    /** The shared grid. */
+    private final Grid grid;
+
+    /** The grid earth transform. */
+    private final EarthTransform trans;
+
+    /** The memory used by the grid data in bytes. */
+    private final long memory;
+
+    ////////////////////////////////////////////////////////
+
+    /** Creates a new reference data object. */
+    private ReferenceData (
+      Grid grid,
+      EarthTransform trans,
+      long memory
+    ) {
+
+      this.grid = grid;
+      this.trans = trans;
+      this.memory = memory;
+
+    } // ReferenceData constructor
+
+    ////////////////////////////////////////////////////////
+
+    /** Gets the shared read-only grid. */
+    public Grid getGrid () { return (grid); }
+
+    ////////////////////////////////////////////////////////
+
+    /** Gets the grid earth transform. */
+    public EarthTransform getTransform () { return (trans); }
+
+    ////////////////////////////////////////////////////////
+
+    /** Gets the memory used by the grid data in bytes. */
+    public long getMemoryUsage () { return (memory); }
+
+    ////////////////////////////////////////////////////////
+
+  } // ReferenceData class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>ReadOnlyGrid</code> class is an in-memory grid whose data
+   * values may not be modified.
+   */
+  private static class ReadOnlyGrid extends Grid {
+
+    /** Creates a new read-only grid with the properties of a grid. */
+    public ReadOnlyGrid (
+      Grid grid,
+      Object data
+    ) {
+
+      super (grid);
+      Statistics.copyAttributes (grid.getMetadataMap(), getMetadataMap());
+      super.setData (data);
+
+    } // ReadOnlyGrid constructor
+
+    @Override
+    public void setData (Object data) { throw new UnsupportedOperationException(); }
+
+    @Override
+    public void setData (Object subset, int[] start, int[] count) { throw new UnsupportedOperationException(); }
+
+    @Override
+    public void setValue (int index, double val) { throw new UnsupportedOperationException(); }
+
+    @Override
+    public void setValue (int row, int col, double val) { throw new UnsupportedOperationException(); }
+
+    @Override
+    public void setValue (DataLocation loc, double val) { throw new UnsupportedOperationException(); }
+
+  } // ReadOnlyGrid class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the singleton instance of this class.
+   *
+   * @return the singleton instance.
+   */
+  public static synchronized ReferenceDataRegistry getInstance () {
+
+    if (instance == null) instance = new ReferenceDataRegistry();
+    return (instance);
+
+  } // getInstance
+
+  ////////////////////////////////////////////////////////////
+
+  private ReferenceDataRegistry () { }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a bundled reference dataset variable, loading it if needed.
+   * Concurrent requests for the same variable wait for a single load.
+   *
+   * @param resourceClass the class used to locate the dataset resource
+   * file, as for {@link IOServices#getFilePath}.
+   * @param resourceName the dataset resource file name.
+   * @param varName the grid variable name.
+   *
+   * @return the shared reference data.
+   *
+   * @throws IOException if an error occurred loading the dataset.
+   */
+  public ReferenceData getData (
+    Class resourceClass,
+    String resourceName,
+    String varName
+  ) throws IOException {
+
+    String path = IOServices.getFilePath (resourceClass, resourceName);
+    String key = path + "#" + varName;
+    try {
+      return (dataMap.computeIfAbsent (key, k -> {
+        try { return (load (path, varName)); }
+        catch (IOException e) { throw new UncheckedIOException (e); }
+      }));
+    } // try
+    catch (UncheckedIOException e) {
+      throw e.getCause();
+    } // catch
+
+  } // getData
+
+  ////////////////////////////////////////////////////////////
+
+  /** Loads a dataset variable into memory. */
+  private static ReferenceData load (
+    String path,
+    String varName
+  ) throws IOException {
+
+    EarthDataReader reader = EarthDataReaderFactory.create (path);
+    try {
+
+      // Read and decode all data
+      // ------------------------
+      Grid source = (Grid) reader.getVariable (varName);
+      int[] dims = source.getDimensions();
+      Object data = source.getData (new int[] {0, 0}, dims);
+      Grid grid = new ReadOnlyGrid (source, data);
+      EarthTransform trans = reader.getInfo().getTransform();
+
+      // Compute memory usage
+      // --------------------
+      Class dataClass = source.getDataClass();
+      int bytes;
+      if (dataClass.equals (Byte.TYPE)) bytes = 1;
+      else if (dataClass.equals (Short.TYPE)) bytes = 2;
+      else if (dataClass.equals (Integer.TYPE) || dataClass.equals (Float.TYPE)) bytes = 4;
+      else bytes = 8;
+      long memory = (long) Array.getLength (data) * bytes;
+
+      LOGGER.fine ("Loaded reference data " + varName + " from " + path +
+        " using " + memory + " bytes");
+
+      return (new ReferenceData (grid, trans, memory));
+
+    } // try
+    finally {
+      reader.close();
+    } // finally
+
+  } // load
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the total memory used by the loaded reference data.
+   *
+   * @return the memory used in bytes.
+   */
+  public long getMemoryUsage () {
+
+    long memory = 0;
+    for (ReferenceData data : dataMap.values()) memory += data.getMemoryUsage();
+    return (memory);
+
+  } // getMemoryUsage
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the keys of the loaded reference data.
+   *
+   * @return the list of keys as resource path and variable name
+   * separated by '#'.
+   */
+  public List<String> getLoaded () { return (new ArrayList<> (dataMap.keySet())); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (ReferenceDataRegistry.class);
+
+    // ------------------------->
+
+    logger.test ("getData");
+
+    ReferenceDataRegistry registry = ReferenceDataRegistry.getInstance();
+    ReferenceData first = registry.getData (LandMask.class, "north.hdf", "land");
+    ReferenceData second = registry.getData (LandMask.class, "north.hdf", "land");
+    assert (first == second);
+    assert (first.getGrid() == second.getGrid());
+    assert (registry.getLoaded().size() == 1);
+    int[] dims = first.getGrid().getDimensions();
+    assert (first.getMemoryUsage() == (long) dims[0]*dims[1]);
+    assert (registry.getMemoryUsage() == first.getMemoryUsage());
+
+    boolean isFailed = false;
+    try { registry.getData (LandMask.class, "north.hdf", "nothing"); }
+    catch (IOException e) { isFailed = true; }
+    catch (RuntimeException e) { isFailed = true; }
+    assert (isFailed);
+    assert (registry.getLoaded().size() == 1);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("read-only grid");
+
+    isFailed = false;
+    try { first.getGrid().setValue (0, 0, 1); }
+    catch (UnsupportedOperationException e) { isFailed = true; }
+    assert (isFailed);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // ReferenceDataRegistry class
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,627 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: TimeSeriesExtractor.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.File;
+import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.text.DecimalFormat;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.Date;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import java.util.concurrent.atomic.AtomicInteger;
+import noaa.coastwatch.io.CachedGrid;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.io.ZarrWriter;
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.TimePeriod;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.MapProjection;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+import noaa.coastwatch.util.trans.ProjectionConstants;
+import noaa.coastwatch.util.trans.SpheroidConstants;
+
+import java.util.logging.Logger;
+
+/**
+ * The <code>TimeSeriesExtractor</code> class extracts the time series of
+ * data values at a set of earth locations from a list of data files.
+ * Each file contributes one time slice of values for every location and
+ * variable.  The extraction is designed for many locations across a
+ * large number of files:
+ * <ul>
+ *   <li>Files are opened and sampled in parallel by a bounded number of
+ *   threads, and each file is closed as soon as it has been sampled.</li>
+ *   <li>Within each file, locations are sampled in order of the tiles
+ *   that contain them, so that each tile of a cached grid is read at
+ *   most once.</li>
+ *   <li>The data coordinates of the locations are computed once for each
+ *   distinct map projection and reused for all files that share it.</li>
+ *   <li>Slices are passed to a {@link SliceConsumer} as each file is
+ *   finished, so that results are streamed rather than held in
+ *   memory.</li>
+ * </ul>
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class TimeSeriesExtractor {
+
+  private static final Logger LOGGER = Logger.getLogger (TimeSeriesExtractor.class.getName());
+
+  // Variables
+  // ---------
+
+  /** The earth locations to sample. */
+  private List<EarthLocation> locations;
+
+  /** The variable names to sample. */
+  private List<String> variables;
+
+  /** The maximum number of files to process at once. */
+  private int threads = 1;
+
+  /** The cached projections and location coordinates. */
+  private List<ProjectionEntry> projectionCache = new ArrayList<ProjectionEntry>();
+
+  /** The number of files that reused cached location coordinates. */
+  private AtomicInteger cacheHits = new AtomicInteger();
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>SliceConsumer</code> interface receives the time slices of
+   * extracted values.  The consumer may be called from multiple threads
+   * and in any order of slice index, so implementations must be thread
+   * safe.
+   */
+  public interface SliceConsumer {
+
+    /**
+     * Accepts a slice of extracted values.
+     *
+     * @param index the slice index, the same as the file index in the
+     * list of files.
+     * @param date the slice date, or null if the file could not be read.
+     * @param values the values as [variable][location], with
+     * <code>Double.NaN</code> for missing data.
+     *
+     * @throws IOException if an error occurred storing the slice.
+     */
+    public void accept (
+      int index,
+      Date date,
+      double[][] values
+    ) throws IOException;
+
+  } // SliceConsumer interface
+
+  ////////////////////////////////////////////////////////////
+
+  /** Holds the data coordinates of the locations for a projection. */
+  private static class ProjectionEntry {
+
+    /** The projection. */
+    public EarthTransform trans;
+
+    /** The data location for each earth location, or null if outside. */
+    public DataLocation[] dataLocs;
+
+  } // ProjectionEntry class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new extractor.
+   *
+   * @param locations the earth locations to sample.
+   * @param variables the names of the 2D variables to sample.
+   */
+  public TimeSeriesExtractor (
+    List<EarthLocation> locations,
+    List<String> variables
+  ) {
+
+    this.locations = new ArrayList<EarthLocation> (locations);
+    this.variables = new ArrayList<String> (variables);
+
+  } // TimeSeriesExtractor constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the maximum number of files to open and process at once.
+   *
+   * @param threads the number of threads, by default 1.
+   */
+  public void setThreads (int threads) { this.threads = Math.max (1, threads); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of files that reused cached location coordinates. */
+  public int getCacheHits () { return (cacheHits.get()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the data locations of the earth locations in a transform.
+   * Map projections are cached so that files with the same projection
+   * share the computed locations.
+   *
+   * @param trans the earth transform of the file.
+   *
+   * @return the data location for each earth location, or null if the
+   * earth location falls outside the transform.
+   */
+  private DataLocation[] getDataLocations (
+    EarthTransform trans
+  ) {
+
+    // Check cache
+    // -----------
+    boolean isCacheable = (trans instanceof MapProjection);
+    if (isCacheable) {
+      synchronized (projectionCache) {
+        for (ProjectionEntry entry : projectionCache) {
+          if (entry.trans.equals (trans) &&
+            Arrays.equals (entry.trans.getDimensions(), trans.getDimensions())) {
+            cacheHits.incrementAndGet();
+            return (entry.dataLocs);
+          } // if
+        } // for
+      } // synchronized
+    } // if
+
+    // Compute locations
+    // -----------------
+    int[] dims = trans.getDimensions();
+    DataLocation[] dataLocs = new DataLocation[locations.size()];
+    for (int i = 0; i < dataLocs.length; i++) {
+      EarthLocation earthLoc = (EarthLocation) locations.get (i).clone();
+      earthLoc.setDatum (trans.getDatum());
+      DataLocation dataLoc = trans.transform (earthLoc);
+      if (dataLoc.isValid() && dataLoc.round().isContained (dims))
+        dataLocs[i] = dataLoc;
+    } // for
+
+    // Add to cache
+    // ------------
+    if (isCacheable) {
+      ProjectionEntry entry = new ProjectionEntry();
+      entry.trans = trans;
+      entry.dataLocs = dataLocs;
+      synchronized (projectionCache) { projectionCache.add (entry); }
+    } // if
+
+    return (dataLocs);
+
+  } // getDataLocations
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the order in which to sample locations from a grid.  For a
+   * cached grid, locations are grouped by tile, and otherwise they are
+   * sorted by data offset.
+   *
+   * @param grid the grid to sample.
+   * @param dataLocs the data locations, some possibly null.
+   *
+   * @return the indices of the non-null locations in sampling order.
+   */
+  private static int[] getSampleOrder (
+    Grid grid,
+    DataLocation[] dataLocs
+  ) {
+
+    int[] dims = grid.getDimensions();
+    int[] tileDims = (grid instanceof CachedGrid ?
+      ((CachedGrid) grid).getTilingScheme().getTileDimensions() : new int[] {1, dims[Grid.COLS]});
+    int tileCols = (dims[Grid.COLS] + tileDims[Grid.COLS] - 1) / tileDims[Grid.COLS];
+
+    /**
+     * We pack the tile index into the upper bits of a long and the
+     * location index into the lower bits so that a primitive sort
+     * orders the locations by tile without any boxing.
+     */
+    long[] keys = new long[dataLocs.length];
+    int count = 0;
+    for (int i = 0; i < dataLocs.length; i++) {
+      if (dataLocs[i] == null) continue;
+      int row = (int) Math.round (dataLocs[i].get (Grid.ROWS));
+      int col = (int) Math.round (dataLocs[i].get (Grid.COLS));
+      long tile = (long) (row / tileDims[Grid.ROWS]) * tileCols + col / tileDims[Grid.COLS];
+      keys[count++] = (tile << 32) | i;
+    } // for
+    Arrays.sort (keys, 0, count);
+
+    int[] order = new int[count];
+    for (int i = 0; i < count; i++) order[i] = (int) (keys[i] & 0xffffffffL);
+
+    return (order);
+
+  } // getSampleOrder
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the representative date of a file, the start date for
+   * instantaneous data or the midpoint of the time range otherwise.
+   */
+  private static Date getDate (
+    EarthDataInfo info
+  ) {
+
+    Date date;
+    if (info.isInstantaneous()) date = info.getStartDate();
+    else date = new Date ((info.getStartDate().getTime() + info.getEndDate().getTime())/2);
+
+    return (date);
+
+  } // getDate
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Extracts the values from a single file.
+   *
+   * @param file the file to read.
+   * @param values the values array to fill as [variable][location],
+   * initialized to <code>Double.NaN</code>.
+   *
+   * @return the file date.
+   *
+   * @throws IOException if an error occurred reading the file.
+   */
+  public Date extractFile (
+    String file,
+    double[][] values
+  ) throws IOException {
+
+    EarthDataReader reader = EarthDataReaderFactory.create (file);
+    try {
+
+      // Get locations
+      // -------------
+      EarthDataInfo info = reader.getInfo();
+      DataLocation[] dataLocs = getDataLocations (info.getTransform());
+
+      // Sample variables
+      // ----------------
+      for (int var = 0; var < variables.size(); var++) {
+        String name = variables.get (var);
+        if (!reader.containsVariable (name)) {
+          LOGGER.warning ("Variable " + name + " not found in " + file);
+          continue;
+        } // if
+        DataVariable preview = reader.getPreview (name);
+        if (!(preview instanceof Grid)) {
+          LOGGER.warning ("Variable " + name + " in " + file + " is not a 2D grid");
+          continue;
+        } // if
+        Grid grid = (Grid) reader.getVariable (name);
+        int[] order = getSampleOrder (grid, dataLocs);
+        for (int i = 0; i < order.length; i++) {
+          int loc = order[i];
+          values[var][loc] = grid.getValue (dataLocs[loc]);
+        } // for
+      } // for
+
+      return (getDate (info));
+
+    } // try
+    finally {
+      reader.close();
+    } // finally
+
+  } // extractFile
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates a new values array filled with missing values. */
+  private double[][] createValues () {
+
+    double[][] values = new double[variables.size()][locations.size()];
+    for (int i = 0; i < values.length; i++) Arrays.fill (values[i], Double.NaN);
+    return (values);
+
+  } // createValues
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Extracts the time series from a list of files.  Files that cannot be
+   * read, or whose reader fails with any other exception, are reported
+   * with a warning and passed to the consumer as a slice of missing
+   * values with a null date.
+   *
+   * @param files the list of files, one time slice each.
+   * @param consumer the consumer of extracted slices.
+   *
+   * @throws IOException if the consumer had an error storing a slice.
+   */
+  public void extract (
+    List<String> files,
+    SliceConsumer consumer
+  ) throws IOException {
+
+    ExecutorService pool = Executors.newFixedThreadPool (threads);
+    List<Future<Object>> futures = new ArrayList<Future<Object>>();
+    try {
+
+      // Submit files
+      // ------------
+      for (int i = 0; i < files.size(); i++) {
+        final int index = i;
+        final String file = files.get (i);
+        futures.add (pool.submit (() -> {
+          double[][] values = createValues();
+          Date date = null;
+          /**
+           * Any error from the reader only affects its own file, so we
+           * catch runtime exceptions here as well as I/O errors.  The
+           * file then becomes a slice of missing values rather than
+           * failing the whole extraction.
+           */
+          try { date = extractFile (file, values); }
+          catch (Exception e) {
+            String message = (e.getMessage() != null ? e.getMessage() : e.toString());
+            LOGGER.warning ("Error reading " + file + ": " + message + ", skipping file");
+            date = null;
+            values = createValues();
+          } // catch
+          consumer.accept (index, date, values);
+          return (null);
+        }));
+      } // for
+
+      // Wait for completion
+      // -------------------
+      for (Future<Object> future : futures) {
+        try { future.get(); }
+        catch (Exception e) {
+          Throwable cause = (e.getCause() != null ? e.getCause() : e);
+          throw new IOException ("Error extracting time series: " + cause.getMessage(), cause);
+        } // catch
+      } // for
+
+    } // try
+    finally {
+      pool.shutdownNow();
+    } // finally
+
+  } // extract
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a test file with a single float variable whose values encode
+   * the file number, row, and column.
+   *
+   * @param dir the directory for the file.
+   * @param fileIndex the file number.
+   * @param trans the file earth transform.
+   *
+   * @return the file path.
+   */
+  private static String createTestFile (
+    File dir,
+    int fileIndex,
+    EarthTransform trans
+  ) throws Exception {
+
+    int[] dims = trans.getDimensions();
+    SatelliteDataInfo info = new SatelliteDataInfo (
+      "petros-1",
+      "java-19",
+      Arrays.asList (new TimePeriod (new Date (86400000L*(20000 + fileIndex)), 12*60*1000)),
+      trans,
+      "Petros RS Inc.",
+      "Created by unit test"
+    );
+    float[] data = new float[dims[Grid.ROWS]*dims[Grid.COLS]];
+    for (int i = 0; i < data.length; i++)
+      data[i] = getTestValue (fileIndex, i / dims[Grid.COLS], i % dims[Grid.COLS]);
+    Grid sst = new Grid ("sst", "Sea surface temperature", "degrees_Celsius",
+      dims[Grid.ROWS], dims[Grid.COLS], data, new DecimalFormat ("0"), null, Float.NaN);
+
+    String path = new File (dir, "file" + fileIndex + ".zarr").getPath();
+    ZarrWriter writer = new ZarrWriter (info, path);
+    writer.setChunkDims (new int[] {16, 16});
+    writer.addVariable (sst);
+    writer.close();
+
+    return (path);
+
+  } // createTestFile
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the test file value for a file number, row, and column. */
+  private static float getTestValue (int fileIndex, int row, int col) {
+
+    return (fileIndex*10000 + row*100 + col);
+
+  } // getTestValue
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the command line arguments (unused).
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (TimeSeriesExtractor.class);
+
+    // ------------------------->
+
+    logger.test ("Framework");
+
+    int rows = 60, cols = 50;
+    EarthTransform trans = MapProjectionFactory.getInstance().create (
+      ProjectionConstants.MERCAT,
+      0,
+      new double[15],
+      SpheroidConstants.WGS84,
+      new int[] {rows, cols},
+      new EarthLocation (48, -125),
+      new double[] {2000, 2000}
+    );
+
+    Path dir = Files.createTempDirectory ("TimeSeriesExtractorTest");
+    String file0 = createTestFile (dir.toFile(), 0, trans);
+    String file1 = createTestFile (dir.toFile(), 1, trans);
+    String badFile = createTestFile (dir.toFile(), 2, trans);
+    String missingFile = new File (dir.toFile(), "missing.zarr").getPath();
+
+    /**
+     * The locations alternate between tiles so that the sampling order
+     * has to regroup them, and the last location is outside the data.
+     */
+    int[][] coords = new int[][] {
+      {0, 0}, {40, 40}, {1, 1}, {41, 41}, {20, 5}, {5, 20}, {59, 49}, {17, 3}
+    };
+    List<EarthLocation> locations = new ArrayList<EarthLocation>();
+    for (int[] coord : coords)
+      locations.add (trans.transform (new DataLocation (coord[0], coord[1])));
+    locations.add (new EarthLocation (0, 0));
+    int outside = locations.size() - 1;
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getSampleOrder");
+
+    TimeSeriesExtractor extractor = new TimeSeriesExtractor (locations, Arrays.asList ("sst"));
+    EarthDataReader reader = EarthDataReaderFactory.create (file0);
+    DataLocation[] dataLocs = extractor.getDataLocations (reader.getInfo().getTransform());
+    assert (dataLocs[outside] == null);
+    for (int i = 0; i < coords.length; i++) {
+      assert (Math.round (dataLocs[i].get (Grid.ROWS)) == coords[i][0]);
+      assert (Math.round (dataLocs[i].get (Grid.COLS)) == coords[i][1]);
+    } // for
+
+    Grid grid = (Grid) reader.getVariable ("sst");
+    assert (grid instanceof CachedGrid);
+    int[] tileDims = ((CachedGrid) grid).getTilingScheme().getTileDimensions();
+    int[] order = getSampleOrder (grid, dataLocs);
+    assert (order.length == coords.length);
+    boolean[] seen = new boolean[coords.length];
+    int lastTile = -1;
+    for (int loc : order) {
+      assert (!seen[loc]);
+      seen[loc] = true;
+      int tile = (coords[loc][0] / tileDims[Grid.ROWS]) * 1000 + coords[loc][1] / tileDims[Grid.COLS];
+      assert (tile >= lastTile);
+      lastTile = tile;
+    } // for
+    reader.close();
+
+    int[] rowOrder = getSampleOrder (new Grid (grid), dataLocs);
+    for (int i = 1; i < rowOrder.length; i++)
+      assert (coords[rowOrder[i-1]][0] <= coords[rowOrder[i]][0]);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("extract");
+
+    TimeSeriesExtractor failing = new TimeSeriesExtractor (locations,
+      Arrays.asList ("sst", "chlor")) {
+      @Override
+      public Date extractFile (String file, double[][] values) throws IOException {
+        if (file.equals (badFile)) {
+          values[0][0] = 1;
+          throw new IllegalStateException ("Reader failure for unit test");
+        } // if
+        return (super.extractFile (file, values));
+      } // extractFile
+    };
+    failing.setThreads (2);
+
+    List<String> files = Arrays.asList (file0, missingFile, badFile, file1);
+    Date[] dates = new Date[files.size()];
+    double[][][] slices = new double[files.size()][][];
+    boolean[] accepted = new boolean[files.size()];
+    failing.extract (files, (index, date, values) -> {
+      synchronized (slices) {
+        assert (!accepted[index]);
+        accepted[index] = true;
+        dates[index] = date;
+        slices[index] = values;
+      } // synchronized
+    });
+
+    for (int i = 0; i < files.size(); i++) assert (accepted[i]);
+    for (int slice : new int[] {1, 2}) {
+      assert (dates[slice] == null);
+      for (double[] varValues : slices[slice])
+        for (double value : varValues) assert (Double.isNaN (value));
+    } // for
+
+    int[] fileIndex = new int[] {0, -1, -1, 1};
+    for (int slice : new int[] {0, 3}) {
+      reader = EarthDataReaderFactory.create (files.get (slice));
+      assert (dates[slice].equals (getDate (reader.getInfo())));
+      reader.close();
+      for (int i = 0; i < coords.length; i++) {
+        double expected = getTestValue (fileIndex[slice], coords[i][0], coords[i][1]);
+        assert (slices[slice][0][i] == expected);
+        assert (Double.isNaN (slices[slice][1][i]));
+      } // for
+      assert (Double.isNaN (slices[slice][0][outside]));
+    } // for
+
+    Files.walk (dir).sorted (Comparator.reverseOrder()).forEach (p -> p.toFile().delete());
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // TimeSeriesExtractor class
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,342 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: TimeSeriesNCWriter.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.File;
+import java.io.IOException;
+import java.text.DecimalFormat;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.List;
+import noaa.coastwatch.io.TimeSeriesExtractor;
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.tools.ToolServices;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.Grid;
+
+import ucar.ma2.Array;
+import ucar.ma2.DataType;
+import ucar.ma2.InvalidRangeException;
+import ucar.nc2.Attribute;
+import ucar.nc2.Dimension;
+import ucar.nc2.Group;
+import ucar.nc2.NetcdfFile;
+import ucar.nc2.NetcdfFileWriter;
+import ucar.nc2.Variable;
+
+/**
+ * The <code>TimeSeriesNCWriter</code> class writes extracted time series
+ * to a NetCDF 3 file following the CF discrete sampling geometry
+ * conventions for a time series feature type.  The file has a time
+ * dimension with one entry per input file and a station dimension with
+ * one entry per location.  Each variable is stored as a 32-bit float
+ * array of [time, station], so that the values at a location over time
+ * and all locations at a time are both compact to read.  Slices may be
+ * written in any order and from multiple threads.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class TimeSeriesNCWriter
+  implements TimeSeriesExtractor.SliceConsumer {
+
+  // Constants
+  // ---------
+
+  /** The time dimension and variable name. */
+  public static final String TIME = "time";
+
+  /** The station dimension name. */
+  public static final String STATION = "station";
+
+  // Variables
+  // ---------
+
+  /** The NetCDF file writer. */
+  private NetcdfFileWriter ncFileWriter;
+
+  /** The time variable. */
+  private Variable timeVar;
+
+  /** The data variables. */
+  private List<Variable> dataVars;
+
+  /** The closed flag, true if the file is closed. */
+  private boolean closed;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new writer.
+   *
+   * @param file the output file name.
+   * @param times the number of time slices.
+   * @param locations the station locations.
+   * @param variables the variable previews used for variable names,
+   * units, and long names.
+   *
+   * @throws IOException if an error occurred creating the file.
+   */
+  public TimeSeriesNCWriter (
+    String file,
+    int times,
+    List<EarthLocation> locations,
+    List<DataVariable> variables
+  ) throws IOException {
+
+    ncFileWriter = NetcdfFileWriter.createNew (NetcdfFileWriter.Version.netcdf3, file);
+    Group root = null;
+
+    // Create global attributes
+    // ------------------------
+    ncFileWriter.addGroupAttribute (root, new Attribute ("Conventions", "CF-1.6"));
+    ncFileWriter.addGroupAttribute (root, new Attribute ("featureType", "timeSeries"));
+    ncFileWriter.addGroupAttribute (root, new Attribute ("history", ToolServices.getCommandLine()));
+
+    // Create coordinate variables
+    // ---------------------------
+    Dimension timeDim = ncFileWriter.addDimension (root, TIME, times);
+    Dimension stationDim = ncFileWriter.addDimension (root, STATION, locations.size());
+    timeVar = ncFileWriter.addVariable (root, TIME, DataType.DOUBLE, TIME);
+    ncFileWriter.addVariableAttribute (timeVar, new Attribute ("standard_name", "time"));
+    ncFileWriter.addVariableAttribute (timeVar, new Attribute ("units", "seconds since 1970-01-01 00:00:00 UTC"));
+    ncFileWriter.addVariableAttribute (timeVar, new Attribute ("_FillValue", Double.NaN));
+    Variable latVar = ncFileWriter.addVariable (root, "lat", DataType.DOUBLE, STATION);
+    ncFileWriter.addVariableAttribute (latVar, new Attribute ("standard_name", "latitude"));
+    ncFileWriter.addVariableAttribute (latVar, new Attribute ("units", "degrees_north"));
+    Variable lonVar = ncFileWriter.addVariable (root, "lon", DataType.DOUBLE, STATION);
+    ncFileWriter.addVariableAttribute (lonVar, new Attribute ("standard_name", "longitude"));
+    ncFileWriter.addVariableAttribute (lonVar, new Attribute ("units", "degrees_east"));
+    Variable stationVar = ncFileWriter.addVariable (root, "station_id", DataType.INT, STATION);
+    ncFileWriter.addVariableAttribute (stationVar, new Attribute ("cf_role", "timeseries_id"));
+
+    // Create data variables
+    // ---------------------
+    List<Dimension> dataDims = new ArrayList<Dimension>();
+    dataDims.add (timeDim);
+    dataDims.add (stationDim);
+    dataVars = new ArrayList<Variable>();
+    for (DataVariable var : variables) {
+      Variable ncVar = ncFileWriter.addVariable (root, var.getName(), DataType.FLOAT, dataDims);
+      String longName = var.getLongName();
+      if (longName != null && !longName.equals (""))
+        ncFileWriter.addVariableAttribute (ncVar, new Attribute ("long_name", longName));
+      String units = var.getUnits();
+      if (units != null && !units.equals (""))
+        ncFileWriter.addVariableAttribute (ncVar, new Attribute ("units", units));
+      ncFileWriter.addVariableAttribute (ncVar, new Attribute ("_FillValue", Float.NaN));
+      ncFileWriter.addVariableAttribute (ncVar, new Attribute ("coordinates", "time lat lon"));
+      dataVars.add (ncVar);
+    } // for
+    ncFileWriter.create();
+
+    // Write station coordinates
+    // -------------------------
+    int count = locations.size();
+    Array latArray = Array.factory (DataType.DOUBLE, new int[] {count});
+    Array lonArray = Array.factory (DataType.DOUBLE, new int[] {count});
+    Array stationArray = Array.factory (DataType.INT, new int[] {count});
+    for (int i = 0; i < count; i++) {
+      EarthLocation loc = locations.get (i);
+      latArray.setDouble (i, loc.lat);
+      lonArray.setDouble (i, loc.lon);
+      stationArray.setInt (i, i);
+    } // for
+    try {
+      ncFileWriter.write (latVar, latArray);
+      ncFileWriter.write (lonVar, lonArray);
+      ncFileWriter.write (stationVar, stationArray);
+    } // try
+    catch (InvalidRangeException e) {
+      throw new IOException (e.getMessage());
+    } // catch
+
+  } // TimeSeriesNCWriter constructor
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public synchronized void accept (
+    int index,
+    Date date,
+    double[][] values
+  ) throws IOException {
+
+    try {
+
+      // Write time
+      // ----------
+      Array timeArray = Array.factory (DataType.DOUBLE, new int[] {1});
+      timeArray.setDouble (0, (date == null ? Double.NaN : date.getTime()/1000.0));
+      ncFileWriter.write (timeVar, new int[] {index}, timeArray);
+
+      // Write values
+      // ------------
+      int[] start = new int[] {index, 0};
+      for (int var = 0; var < dataVars.size(); var++) {
+        double[] varValues = values[var];
+        float[] floatValues = new float[varValues.length];
+        for (int i = 0; i < varValues.length; i++) floatValues[i] = (float) varValues[i];
+        Array array = Array.factory (float.class, new int[] {1, floatValues.length}, floatValues);
+        ncFileWriter.write (dataVars.get (var), start, array);
+      } // for
+
+    } // try
+    catch (InvalidRangeException e) {
+      throw new IOException (e.getMessage());
+    } // catch
+
+  } // accept
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Closes the file.
+   *
+   * @throws IOException if an error occurred closing the file.
+   */
+  public synchronized void close () throws IOException {
+
+    if (!closed) {
+      ncFileWriter.close();
+      closed = true;
+    } // if
+
+  } // close
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the command line arguments (unused).
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (TimeSeriesNCWriter.class);
+
+    // ------------------------->
+
+    logger.test ("Framework");
+
+    ToolServices.setCommandLine (TimeSeriesNCWriter.class.getName(), new String[0]);
+    List<EarthLocation> locations = Arrays.asList (
+      new EarthLocation (48, -125),
+      new EarthLocation (-10.5, 170.25)
+    );
+    List<DataVariable> variables = new ArrayList<DataVariable>();
+    variables.add (new Grid ("sst", "Sea surface temperature", "degrees_Celsius",
+      1, 1, new float[1], new DecimalFormat ("0"), null, Float.NaN));
+    variables.add (new Grid ("chlor", "", "", 1, 1, new float[1],
+      new DecimalFormat ("0"), null, Float.NaN));
+
+    File file = File.createTempFile ("TimeSeriesNCWriterTest", ".nc");
+    file.deleteOnExit();
+    int times = 3;
+    Date[] dates = new Date[] {
+      new Date (86400000L*20000),
+      null,
+      new Date (86400000L*20001 + 500)
+    };
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("accept, close");
+
+    /**
+     * The slices are written out of time order, with a missing slice in
+     * the middle, to check that each lands at its own time index.
+     */
+    TimeSeriesNCWriter writer = new TimeSeriesNCWriter (file.getPath(), times,
+      locations, variables);
+    for (int index : new int[] {2, 1, 0}) {
+      double[][] values = new double[variables.size()][locations.size()];
+      for (int var = 0; var < values.length; var++) {
+        for (int loc = 0; loc < values[var].length; loc++) {
+          values[var][loc] = (dates[index] == null ? Double.NaN : index*100 + var*10 + loc);
+        } // for
+      } // for
+      writer.accept (index, dates[index], values);
+    } // for
+    writer.close();
+    writer.close();
+
+    NetcdfFile ncFile = NetcdfFile.open (file.getPath());
+    try {
+
+      assert (ncFile.findGlobalAttribute ("featureType").getStringValue().equals ("timeSeries"));
+      assert (ncFile.findDimension (TIME).getLength() == times);
+      assert (ncFile.findDimension (STATION).getLength() == locations.size());
+
+      Array timeArray = ncFile.findVariable (TIME).read();
+      for (int index = 0; index < times; index++) {
+        if (dates[index] == null) assert (Double.isNaN (timeArray.getDouble (index)));
+        else assert (timeArray.getDouble (index) == dates[index].getTime()/1000.0);
+      } // for
+
+      Array latArray = ncFile.findVariable ("lat").read();
+      Array lonArray = ncFile.findVariable ("lon").read();
+      for (int loc = 0; loc < locations.size(); loc++) {
+        assert (latArray.getDouble (loc) == locations.get (loc).lat);
+        assert (lonArray.getDouble (loc) == locations.get (loc).lon);
+      } // for
+
+      for (int var = 0; var < variables.size(); var++) {
+        Variable ncVar = ncFile.findVariable (variables.get (var).getName());
+        assert (Arrays.equals (ncVar.getShape(), new int[] {times, locations.size()}));
+        float[] data = (float[]) ncVar.read().copyTo1DJavaArray();
+        for (int index = 0; index < times; index++) {
+          for (int loc = 0; loc < locations.size(); loc++) {
+            float value = data[index*locations.size() + loc];
+            if (dates[index] == null) assert (Float.isNaN (value));
+            else assert (value == index*100 + var*10 + loc);
+          } // for
+        } // for
+      } // for
+      assert (ncFile.findVariable ("sst").findAttribute ("units").getStringValue().equals ("degrees_Celsius"));
+      assert (ncFile.findVariable ("chlor").findAttribute ("units") == null);
+
+    } // try
+    finally {
+      ncFile.close();
+    } // finally
+    file.delete();
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // TimeSeriesNCWriter class
+
+////////////////////////////////////////////////////////////////////////
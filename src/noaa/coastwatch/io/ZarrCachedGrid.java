@@ -0,0 +1,646 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: ZarrCachedGrid.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.io.ByteArrayInputStream;
+import java.io.ByteArrayOutputStream;
+import java.io.File;
+import java.io.IOException;
+import java.io.InputStream;
+import java.lang.reflect.Array;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.file.AtomicMoveNotSupportedException;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.StandardCopyOption;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Map;
+import java.util.zip.DataFormatException;
+import java.util.zip.Deflater;
+import java.util.zip.GZIPInputStream;
+import java.util.zip.Inflater;
+import noaa.coastwatch.io.CachedGrid;
+import noaa.coastwatch.io.JSONServices;
+import noaa.coastwatch.io.tile.TilingScheme;
+import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
+import noaa.coastwatch.io.tile.TilingScheme.Tile;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.chunk.DirectChunkSink;
+
+/**
+ * The <code>ZarrCachedGrid</code> class is a cached grid that reads and
+ * writes variable data stored as a Zarr version 2 array: a directory
+ * containing a <code>.zarray</code> metadata file and one independently
+ * compressed file per chunk.  The cache tiles are identical to the array
+ * chunks, so each tile maps to exactly one file.<p>
+ *
+ * Since no two chunks share a file, chunk-aligned subsets may be read and
+ * written concurrently from multiple threads using
+ * {@link #getChunkData} and {@link #putChunkData} without passing through
+ * the (unsynchronized) tile cache.  Chunk consumers in
+ * {@link noaa.coastwatch.util.chunk} use the {@link DirectChunkSink}
+ * interface to avoid locking on the grid when the chunk positions match
+ * the array chunks.  A direct chunk write discards any cached copy of the
+ * chunk, including unwritten changes, but a direct chunk read does not see
+ * changes in the cache that have not yet been flushed.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public class ZarrCachedGrid
+  extends CachedGrid
+  implements DirectChunkSink {
+
+  // Constants
+  // ---------
+
+  /** Default cache size in bytes. */
+  public final static int DEFAULT_CACHE_SIZE = (4*1024)*1024;
+
+  /** The array metadata file name. */
+  public final static String ARRAY_FILE = ".zarray";
+
+  /** The attributes metadata file name. */
+  public final static String ATTRIBUTES_FILE = ".zattrs";
+
+  // Variables
+  // ---------
+
+  /** The array directory. */
+  private File arrayDir;
+
+  /** The byte order of the stored data. */
+  private ByteOrder order;
+
+  /** The compressor ID, either "zlib", "gzip", or null for none. */
+  private String compressor;
+
+  /** The compression level for writing. */
+  private int level;
+
+  /** The separator between chunk indices in chunk file names. */
+  private String separator;
+
+  /** The fill value for chunks or parts of chunks with no data. */
+  private Object fillData;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the Zarr data type string for a variable data type.
+   *
+   * @param dataClass the variable primitive data class.
+   * @param isUnsigned the unsigned flag, true if the integer data is
+   * unsigned.
+   *
+   * @return the data type string, for example "&lt;f4".
+   *
+   * @throws IOException if the data class is not supported.
+   */
+  public static String getDataType (
+    Class dataClass,
+    boolean isUnsigned
+  ) throws IOException {
+
+    String type;
+    String sign = (isUnsigned ? "u" : "i");
+    if (dataClass.equals (Byte.TYPE)) type = "|" + sign + "1";
+    else if (dataClass.equals (Short.TYPE)) type = "<" + sign + "2";
+    else if (dataClass.equals (Integer.TYPE)) type = "<" + sign + "4";
+    else if (dataClass.equals (Long.TYPE)) type = "<" + sign + "8";
+    else if (dataClass.equals (Float.TYPE)) type = "<f4";
+    else if (dataClass.equals (Double.TYPE)) type = "<f8";
+    else throw new IOException ("Unsupported data class " + dataClass);
+
+    return (type);
+
+  } // getDataType
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the variable data class for a Zarr data type string.
+   *
+   * @param type the data type string, for example "&lt;f4".
+   *
+   * @return the primitive data class.
+   *
+   * @throws IOException if the data type is not supported.
+   */
+  public static Class getDataClass (
+    String type
+  ) throws IOException {
+
+    Class dataClass = null;
+    if (type.length() == 3) {
+      char kind = type.charAt (1);
+      int bytes = Character.digit (type.charAt (2), 10);
+      if (kind == 'i' || kind == 'u') {
+        switch (bytes) {
+        case 1: dataClass = Byte.TYPE; break;
+        case 2: dataClass = Short.TYPE; break;
+        case 4: dataClass = Integer.TYPE; break;
+        case 8: dataClass = Long.TYPE; break;
+        } // switch
+      } // if
+      else if (kind == 'f') {
+        if (bytes == 4) dataClass = Float.TYPE;
+        else if (bytes == 8) dataClass = Double.TYPE;
+      } // else if
+    } // if
+    if (dataClass == null)
+      throw new IOException ("Unsupported Zarr data type " + type);
+
+    return (dataClass);
+
+  } // getDataClass
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Constructs a new read-write Zarr cached grid and adds it to a writer.
+   * The array directory and metadata are created by the writer.
+   *
+   * @param grid the grid to use for attributes.
+   * @param writer the Zarr writer data destination.
+   *
+   * @throws IOException if a problem occurred creating the array.
+   */
+  public ZarrCachedGrid (
+    Grid grid,
+    ZarrWriter writer
+  ) throws IOException {
+
+    this (grid, writer.createArray (grid), true);
+    writer.addVariable (this);
+
+  } // ZarrCachedGrid constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Constructs a new Zarr cached grid for an existing array directory.
+   *
+   * @param grid the grid to use for attributes.
+   * @param arrayDir the array directory containing the array metadata.
+   * @param isWritable the writable flag, true if the grid data may be
+   * modified or false if read-only.
+   *
+   * @throws IOException if a problem occurred reading the array metadata.
+   */
+  ZarrCachedGrid (
+    Grid grid,
+    File arrayDir,
+    boolean isWritable
+  ) throws IOException {
+
+    super (grid, isWritable ? READ_WRITE : READ_ONLY);
+    this.arrayDir = arrayDir;
+
+    // Read array metadata
+    // -------------------
+    Map<String,Object> meta = JSONMetadataServices.readMetadata (new File (arrayDir, ARRAY_FILE));
+    List shape = (List) meta.get ("shape");
+    List chunks = (List) meta.get ("chunks");
+    if (shape == null || chunks == null || shape.size() != 2 || chunks.size() != 2)
+      throw new IOException ("Invalid shape or chunks for 2D array in " + arrayDir);
+    for (int i = 0; i < 2; i++) {
+      if (((Number) shape.get (i)).intValue() != dims[i])
+        throw new IOException ("Array shape does not match grid in " + arrayDir);
+    } // for
+    if ("F".equals (meta.get ("order")))
+      throw new IOException ("Unsupported Fortran array order in " + arrayDir);
+    if (meta.get ("filters") != null)
+      throw new IOException ("Unsupported array filters in " + arrayDir);
+
+    // Check data type
+    // ---------------
+    String type = (String) meta.get ("dtype");
+    if (!getDataClass (type).equals (getDataClass()))
+      throw new IOException ("Array data type " + type + " does not match grid in " + arrayDir);
+    order = (type.charAt (0) == '>' ? ByteOrder.BIG_ENDIAN : ByteOrder.LITTLE_ENDIAN);
+
+    // Get compressor
+    // --------------
+    Map comp = (Map) meta.get ("compressor");
+    if (comp != null) {
+      compressor = (String) comp.get ("id");
+      if (!compressor.equals ("zlib") && !compressor.equals ("gzip"))
+        throw new IOException ("Unsupported compressor " + compressor + " in " + arrayDir);
+      Object levelObj = comp.get ("level");
+      level = (levelObj == null ? Deflater.DEFAULT_COMPRESSION : ((Number) levelObj).intValue());
+    } // if
+    separator = (String) meta.getOrDefault ("dimension_separator", ".");
+
+    // Create fill data
+    // ----------------
+    int[] chunkDims = new int[] {((Number) chunks.get (ROWS)).intValue(),
+      ((Number) chunks.get (COLS)).intValue()};
+    fillData = Array.newInstance (getDataClass(), chunkDims[ROWS]*chunkDims[COLS]);
+    Object fillValue = meta.get ("fill_value");
+    if (fillValue != null) {
+      double fill = JSONServices.toDouble (fillValue);
+      if (fill != 0) {
+        Class dataClass = getDataClass();
+        if (dataClass.equals (Float.TYPE)) Arrays.fill ((float[]) fillData, (float) fill);
+        else if (dataClass.equals (Double.TYPE)) Arrays.fill ((double[]) fillData, fill);
+        else if (dataClass.equals (Byte.TYPE)) Arrays.fill ((byte[]) fillData, (byte) (long) fill);
+        else if (dataClass.equals (Short.TYPE)) Arrays.fill ((short[]) fillData, (short) (long) fill);
+        else if (dataClass.equals (Integer.TYPE)) Arrays.fill ((int[]) fillData, (int) (long) fill);
+        else if (dataClass.equals (Long.TYPE)) Arrays.fill ((long[]) fillData, (long) fill);
+      } // if
+    } // if
+
+    // Set tile and cache sizes
+    // ------------------------
+    super.setTileDims (chunkDims);
+    setOptimizedCacheSize (DEFAULT_CACHE_SIZE);
+
+  } // ZarrCachedGrid constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Has no effect.  The tile dimensions of a Zarr grid are always the
+   * array chunk dimensions.
+   *
+   * @param dims the tile dimensions as [rows, columns].
+   */
+  @Override
+  public void setTileDims (
+    int[] dims
+  ) {
+
+    // do nothing
+
+  } // setTileDims
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public Object getDataStream () { return (arrayDir); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the file for the chunk at the specified chunk coordinates. */
+  private File getChunkFile (int[] coords) {
+
+    return (new File (arrayDir, coords[ROWS] + separator + coords[COLS]));
+
+  } // getChunkFile
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Determines if a data subset coincides exactly with one array chunk.
+   *
+   * @param start the subset starting [row, column].
+   * @param length the subset dimensions [rows, columns].
+   *
+   * @return true if the subset is exactly one chunk, or false if not.
+   */
+  @Override
+  public boolean isChunkAligned (
+    int[] start,
+    int[] length
+  ) {
+
+    boolean isAligned = false;
+    if (start[ROWS] >= 0 && start[ROWS] < dims[ROWS] &&
+      start[COLS] >= 0 && start[COLS] < dims[COLS]) {
+      TilePosition pos = tiling.createTilePosition (start[ROWS], start[COLS]);
+      isAligned = Arrays.equals (pos.getStart(), start) &&
+        Arrays.equals (pos.getDimensions(), length);
+    } // if
+
+    return (isAligned);
+
+  } // isChunkAligned
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Reads the data for one chunk directly from its file, bypassing the
+   * cache.  This method may be called concurrently from multiple threads.
+   *
+   * @param start the chunk starting [row, column].
+   * @param length the chunk dimensions [rows, columns].
+   *
+   * @return the chunk data array of unscaled values.
+   *
+   * @throws IOException if an error occurred reading the chunk data.
+   * @throws IllegalArgumentException if the subset is not chunk-aligned.
+   *
+   * @see #isChunkAligned
+   */
+  public Object getChunkData (
+    int[] start,
+    int[] length
+  ) throws IOException {
+
+    if (!isChunkAligned (start, length))
+      throw new IllegalArgumentException ("Subset is not aligned to an array chunk");
+    TilePosition pos = tiling.createTilePosition (start[ROWS], start[COLS]);
+    return (readChunk (pos));
+
+  } // getChunkData
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Writes the data for one chunk directly to its file, bypassing the
+   * cache.  Any copy of the chunk in the cache is discarded.  This method
+   * may be called concurrently from multiple threads for different chunks.
+   *
+   * @param data the chunk data array of unscaled values.
+   * @param start the chunk starting [row, column].
+   * @param length the chunk dimensions [rows, columns].
+   *
+   * @throws IOException if an error occurred writing the chunk data.
+   * @throws IllegalArgumentException if the subset is not chunk-aligned.
+   *
+   * @see #isChunkAligned
+   */
+  @Override
+  public void putChunkData (
+    Object data,
+    int[] start,
+    int[] length
+  ) throws IOException {
+
+    if (accessMode == READ_ONLY)
+      throw new IOException ("Cannot write chunk to read-only dataset");
+    if (!isChunkAligned (start, length))
+      throw new IllegalArgumentException ("Subset is not aligned to an array chunk");
+    TilePosition pos = tiling.createTilePosition (start[ROWS], start[COLS]);
+
+    /**
+     * The cached tile is removed both before and after writing, under the
+     * same lock used by chunk consumers for cached access.  The first
+     * removal stops a modified tile from being flushed over the new chunk
+     * file, and the second drops any tile read back while the file was
+     * being written.
+     */
+    synchronized (this) { removeTile (pos); }
+    writeChunk (pos, data);
+    synchronized (this) { removeTile (pos); }
+
+  } // putChunkData
+
+  ////////////////////////////////////////////////////////////
+
+  /** Reads the data for the chunk at the specified position. */
+  private Object readChunk (
+    TilePosition pos
+  ) throws IOException {
+
+    // Read chunk file
+    // ---------------
+    byte[] bytes;
+    try { bytes = Files.readAllBytes (getChunkFile (pos.getCoords()).toPath()); }
+    catch (NoSuchFileException e) { bytes = null; }
+
+    // Decode chunk data
+    // -----------------
+    int[] tileDims = tiling.getTileDimensions();
+    int values = tileDims[ROWS]*tileDims[COLS];
+    Object data;
+    if (bytes == null) {
+      data = Array.newInstance (getDataClass(), values);
+      System.arraycopy (fillData, 0, data, 0, values);
+    } // if
+    else {
+      int valueBytes = DataVariable.getClassBits (getDataClass())/8;
+      bytes = decompress (bytes, values*valueBytes);
+      data = fromBytes (bytes, values);
+    } // else
+
+    // Rearrange truncated chunk data
+    // ------------------------------
+    int[] dataDims = pos.getDimensions();
+    if (dataDims[ROWS] != tileDims[ROWS] || dataDims[COLS] != tileDims[COLS]) {
+      Object newData = Array.newInstance (getDataClass(), dataDims[ROWS]*dataDims[COLS]);
+      Grid.arraycopy (data, tileDims, new int[] {0,0}, newData,
+        dataDims, new int[] {0,0}, dataDims);
+      data = newData;
+    } // if
+
+    return (data);
+
+  } // readChunk
+
+  ////////////////////////////////////////////////////////////
+
+  /** Writes the data for the chunk at the specified position. */
+  private void writeChunk (
+    TilePosition pos,
+    Object data
+  ) throws IOException {
+
+    /**
+     * Zarr chunks at the edges of the array are always stored at the full
+     * chunk size, so we pad truncated data with the fill value.
+     */
+    int[] tileDims = tiling.getTileDimensions();
+    int[] dataDims = pos.getDimensions();
+    if (dataDims[ROWS] != tileDims[ROWS] || dataDims[COLS] != tileDims[COLS]) {
+      int values = tileDims[ROWS]*tileDims[COLS];
+      Object newData = Array.newInstance (getDataClass(), values);
+      System.arraycopy (fillData, 0, newData, 0, values);
+      Grid.arraycopy (data, dataDims, new int[] {0,0}, newData,
+        tileDims, new int[] {0,0}, dataDims);
+      data = newData;
+    } // if
+
+    /**
+     * We write to a temporary file first and then move it into place, so
+     * that a concurrent reader never sees a partially written chunk.
+     */
+    byte[] bytes = compress (toBytes (data));
+    File file = getChunkFile (pos.getCoords());
+    File dir = file.getParentFile();
+    if (!dir.isDirectory() && !dir.mkdirs() && !dir.isDirectory())
+      throw new IOException ("Cannot create chunk directory " + dir);
+    File tmpFile = new File (dir, file.getName() + ".tmp");
+    Files.write (tmpFile.toPath(), bytes);
+    try {
+      Files.move (tmpFile.toPath(), file.toPath(), StandardCopyOption.REPLACE_EXISTING,
+        StandardCopyOption.ATOMIC_MOVE);
+    } // try
+    catch (AtomicMoveNotSupportedException e) {
+      Files.move (tmpFile.toPath(), file.toPath(), StandardCopyOption.REPLACE_EXISTING);
+    } // catch
+
+  } // writeChunk
+
+  ////////////////////////////////////////////////////////////
+
+  /** Converts a primitive data array to bytes in the stored byte order. */
+  private byte[] toBytes (Object data) {
+
+    int values = Array.getLength (data);
+    int valueBytes = DataVariable.getClassBits (getDataClass())/8;
+    ByteBuffer buffer = ByteBuffer.allocate (values*valueBytes).order (order);
+    if (data instanceof byte[]) buffer.put ((byte[]) data);
+    else if (data instanceof short[]) buffer.asShortBuffer().put ((short[]) data);
+    else if (data instanceof int[]) buffer.asIntBuffer().put ((int[]) data);
+    else if (data instanceof long[]) buffer.asLongBuffer().put ((long[]) data);
+    else if (data instanceof float[]) buffer.asFloatBuffer().put ((float[]) data);
+    else if (data instanceof double[]) buffer.asDoubleBuffer().put ((double[]) data);
+
+    return (buffer.array());
+
+  } // toBytes
+
+  ////////////////////////////////////////////////////////////
+
+  /** Converts bytes in the stored byte order to a primitive data array. */
+  private Object fromBytes (byte[] bytes, int values) throws IOException {
+
+    int valueBytes = DataVariable.getClassBits (getDataClass())/8;
+    if (bytes.length != values*valueBytes)
+      throw new IOException ("Chunk data has " + bytes.length + " bytes, expected " +
+        values*valueBytes + " in " + arrayDir);
+
+    ByteBuffer buffer = ByteBuffer.wrap (bytes).order (order);
+    Object data = Array.newInstance (getDataClass(), values);
+    if (data instanceof byte[]) buffer.get ((byte[]) data);
+    else if (data instanceof short[]) buffer.asShortBuffer().get ((short[]) data);
+    else if (data instanceof int[]) buffer.asIntBuffer().get ((int[]) data);
+    else if (data instanceof long[]) buffer.asLongBuffer().get ((long[]) data);
+    else if (data instanceof float[]) buffer.asFloatBuffer().get ((float[]) data);
+    else if (data instanceof double[]) buffer.asDoubleBuffer().get ((double[]) data);
+
+    return (data);
+
+  } // fromBytes
+
+  ////////////////////////////////////////////////////////////
+
+  /** Compresses chunk bytes using the array compressor. */
+  private byte[] compress (byte[] bytes) throws IOException {
+
+    if (compressor == null) return (bytes);
+    if (!compressor.equals ("zlib"))
+      throw new IOException ("Writing with compressor " + compressor + " is not supported");
+
+    Deflater deflater = new Deflater (level);
+    try {
+      deflater.setInput (bytes);
+      deflater.finish();
+      ByteArrayOutputStream output = new ByteArrayOutputStream (bytes.length/2 + 64);
+      byte[] buffer = new byte[65536];
+      while (!deflater.finished()) {
+        int count = deflater.deflate (buffer);
+        output.write (buffer, 0, count);
+      } // while
+      return (output.toByteArray());
+    } // try
+    finally { deflater.end(); }
+
+  } // compress
+
+  ////////////////////////////////////////////////////////////
+
+  /** Decompresses chunk bytes using the array compressor. */
+  private byte[] decompress (byte[] bytes, int length) throws IOException {
+
+    if (compressor == null) return (bytes);
+
+    byte[] output = new byte[length];
+    int count = 0;
+
+    // Decompress gzip stream
+    // ----------------------
+    if (compressor.equals ("gzip")) {
+      try (InputStream input = new GZIPInputStream (new ByteArrayInputStream (bytes))) {
+        int read;
+        while (count < length && (read = input.read (output, count, length - count)) > 0)
+          count += read;
+      } // try
+    } // if
+
+    // Decompress zlib stream
+    // ----------------------
+    else {
+      Inflater inflater = new Inflater();
+      try {
+        inflater.setInput (bytes);
+        while (count < length && !inflater.finished()) {
+          int read = inflater.inflate (output, count, length - count);
+          if (read == 0 && (inflater.needsInput() || inflater.needsDictionary())) break;
+          count += read;
+        } // while
+      } // try
+      catch (DataFormatException e) {
+        throw new IOException ("Invalid compressed chunk data in " + arrayDir + ": " + e.getMessage());
+      } // catch
+      finally { inflater.end(); }
+    } // else
+
+    if (count != length)
+      throw new IOException ("Chunk data has " + count + " bytes, expected " + length + " in " + arrayDir);
+
+    return (output);
+
+  } // decompress
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected Tile readTile (
+    TilePosition pos
+  ) throws IOException {
+
+    return (tiling.new Tile (pos, readChunk (pos)));
+
+  } // readTile
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected void writeTile (
+    Tile tile
+  ) throws IOException {
+
+    // Check access mode
+    // -----------------
+    if (accessMode == READ_ONLY)
+      throw new IOException ("Cannot write tile to read-only dataset");
+
+    writeChunk (tile.getPosition(), tile.getData());
+    tile.setDirty (false);
+
+  } // writeTile
+
+  ////////////////////////////////////////////////////////////
+
+} // ZarrCachedGrid class
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,523 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: ZarrReader.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.awt.geom.AffineTransform;
+import java.io.File;
+import java.io.IOException;
+import java.lang.reflect.Array;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.text.DecimalFormat;
+import java.text.NumberFormat;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.Date;
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.ZarrCachedGrid;
+import noaa.coastwatch.io.ZarrWriter;
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.TimePeriod;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkProducer;
+import noaa.coastwatch.util.chunk.ChunkingScheme;
+import noaa.coastwatch.util.chunk.DataChunk;
+import noaa.coastwatch.util.chunk.DataChunkFactory;
+import noaa.coastwatch.util.chunk.GridChunkConsumer;
+import noaa.coastwatch.util.chunk.GridChunkProducer;
+import noaa.coastwatch.util.trans.DataProjection;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.MapProjection;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+import noaa.coastwatch.util.trans.ProjectionConstants;
+import noaa.coastwatch.util.trans.SpheroidConstants;
+
+/**
+ * The <code>ZarrReader</code> class reads earth data from a directory
+ * store in the Zarr version 2 layout as written by {@link ZarrWriter}.
+ * Each 2D array in the store is made available as a grid variable, read
+ * through a {@link ZarrCachedGrid}.  Since each chunk is stored in its own
+ * file, the chunk producers returned by {@link #getChunkProducer} read
+ * native chunks in parallel without locking.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class ZarrReader
+  extends EarthDataReader {
+
+  // Constants
+  // ---------
+
+  /** The data format description. */
+  private static final String DATA_FORMAT = "Zarr";
+
+  /** The variable attributes handled explicitly by this reader. */
+  private static final List<String> VARIABLE_ATTRIBUTES = Arrays.asList (
+    "_ARRAY_DIMENSIONS", "long_name", "units", "missing_value",
+    "scale_factor", "add_offset", "fraction_digits", "nav_affine");
+
+  // Variables
+  // ---------
+
+  /** The root directory of the store. */
+  private File rootDir;
+
+  /** The global attributes. */
+  private Map<String,Object> globalAttributes;
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public String getDataFormat () { return (DATA_FORMAT); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Constructs a Zarr reader from the specified store directory.
+   *
+   * @param name the store directory name to read.
+   *
+   * @throws IOException if an error occurred reading the store metadata,
+   * or the directory is not a Zarr store.
+   */
+  public ZarrReader (
+    String name
+  ) throws IOException {
+
+    super (name);
+
+    // Check for group
+    // ---------------
+    rootDir = new File (name);
+    if (!new File (rootDir, ZarrWriter.GROUP_FILE).isFile())
+      throw new IOException ("Cannot find Zarr group metadata in " + name);
+    File attFile = new File (rootDir, ZarrCachedGrid.ATTRIBUTES_FILE);
+    globalAttributes = (attFile.isFile() ? JSONMetadataServices.readMetadata (attFile) :
+      new LinkedHashMap<>());
+    rawMetadataMap.putAll (globalAttributes);
+
+    // Find 2D arrays
+    // --------------
+    File[] files = rootDir.listFiles();
+    List<String> nameList = new ArrayList<>();
+    if (files != null) {
+      for (File file : files) {
+        File arrayFile = new File (file, ZarrCachedGrid.ARRAY_FILE);
+        if (arrayFile.isFile()) {
+          List shape = (List) JSONMetadataServices.readMetadata (arrayFile).get ("shape");
+          if (shape != null && shape.size() == 2) nameList.add (file.getName());
+        } // if
+      } // for
+    } // if
+    nameList.sort (Comparator.naturalOrder());
+    variables = nameList.toArray (new String[0]);
+
+    // Create info
+    // -----------
+    info = JSONMetadataServices.createInfo (globalAttributes, getTransform());
+
+  } // ZarrReader constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Reads the earth transform information.
+   *
+   * @return the earth transform for the store.
+   *
+   * @throws IOException if an error occurred reading the transform, or the
+   * transform type is not supported.
+   */
+  private EarthTransform getTransform () throws IOException {
+
+    String type = JSONMetadataServices.getString (globalAttributes, "projection_type");
+    EarthTransform trans;
+
+    // Read map projection
+    // -------------------
+    if (MapProjection.DESCRIPTION.equals (type)) {
+      trans = JSONMetadataServices.createMapProjection (globalAttributes);
+    } // if
+
+    // Read data projection
+    // --------------------
+    else if (DataProjection.DESCRIPTION.equals (type)) {
+      String coords = JSONMetadataServices.getString (globalAttributes, "coordinates");
+      String[] names = (coords == null ? new String[0] : coords.trim().split ("\\s+"));
+      if (names.length != 2)
+        throw new IOException ("Invalid coordinates attribute for data projection");
+      trans = new DataProjection (getVariable (names[0]), getVariable (names[1]));
+    } // else if
+
+    else
+      throw new IOException ("Unsupported projection type " + type);
+
+    return (trans);
+
+  } // getTransform
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected DataVariable getPreviewImpl (
+    int index
+  ) throws IOException {
+
+    // Read metadata
+    // -------------
+    String name = variables[index];
+    File arrayDir = new File (rootDir, name);
+    Map<String,Object> array = JSONMetadataServices.readMetadata (new File (arrayDir,
+      ZarrCachedGrid.ARRAY_FILE));
+    File attFile = new File (arrayDir, ZarrCachedGrid.ATTRIBUTES_FILE);
+    Map<String,Object> attributes = (attFile.isFile() ?
+      JSONMetadataServices.readMetadata (attFile) : new LinkedHashMap<>());
+
+    // Get data type and dimensions
+    // ----------------------------
+    String type = (String) array.get ("dtype");
+    Class dataClass = ZarrCachedGrid.getDataClass (type);
+    boolean isUnsigned = (type.charAt (1) == 'u');
+    List shape = (List) array.get ("shape");
+    int rows = ((Number) shape.get (Grid.ROWS)).intValue();
+    int cols = ((Number) shape.get (Grid.COLS)).intValue();
+
+    // Get scaling
+    // -----------
+    /**
+     * We re-arrange the CF scaling conventions here into HDF:
+     *
+     *   y = a'x + b'      (CF)
+     *   y = (x - b)*a     (HDF)
+     *   => a = a'
+     *      b = -b'/a'
+     */
+    double[] scaling = null;
+    if (attributes.containsKey ("scale_factor") || attributes.containsKey ("add_offset")) {
+      double scale = (attributes.containsKey ("scale_factor") ?
+        JSONServices.toDouble (attributes.get ("scale_factor")) : 1);
+      double offset = (attributes.containsKey ("add_offset") ?
+        JSONServices.toDouble (attributes.get ("add_offset")) : 0);
+      scaling = new double[] {scale, -offset/scale};
+    } // if
+
+    // Get missing value
+    // -----------------
+    Object missingValue = attributes.get ("missing_value");
+    if (missingValue == null) missingValue = array.get ("fill_value");
+    Object missing = JSONMetadataServices.toMissing (missingValue, dataClass);
+
+    // Get format
+    // ----------
+    int digits;
+    Object digitsValue = attributes.get ("fraction_digits");
+    if (digitsValue instanceof Number) digits = ((Number) digitsValue).intValue();
+    else if (scaling != null) digits = DataVariable.getDecimals (Double.toString (scaling[0]));
+    else if (dataClass.equals (Float.TYPE) || dataClass.equals (Double.TYPE)) digits = 6;
+    else digits = 0;
+    String decFormat = "0";
+    for (int i = 0; i < digits; i++) {
+      if (i == 0) decFormat += ".";
+      decFormat += "#";
+    } // for
+    NumberFormat format = new DecimalFormat (decFormat);
+
+    // Create grid
+    // -----------
+    Object longName = attributes.get ("long_name");
+    Object units = attributes.get ("units");
+    Grid grid = new Grid (
+      name,
+      (longName == null ? name : longName.toString()),
+      (units == null ? "" : units.toString()),
+      rows, cols,
+      Array.newInstance (dataClass, 1),
+      format,
+      scaling,
+      missing
+    );
+    grid.setUnsigned (isUnsigned);
+    if (attributes.containsKey ("nav_affine"))
+      grid.setNavigation (new AffineTransform (JSONMetadataServices.toDoubleArray (attributes.get ("nav_affine"))));
+
+    // Add other metadata
+    // ------------------
+    for (Map.Entry<String,Object> entry : attributes.entrySet()) {
+      if (VARIABLE_ATTRIBUTES.contains (entry.getKey())) continue;
+      Object value = entry.getValue();
+      if (value instanceof List) {
+        try { value = JSONMetadataServices.toDoubleArray (value); }
+        catch (Exception e) { continue; }
+      } // if
+      if (value != null) grid.getMetadataMap().put (entry.getKey(), value);
+    } // for
+
+    return (grid);
+
+  } // getPreviewImpl
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public DataVariable getVariable (
+    int index
+  ) throws IOException {
+
+    Grid preview = (Grid) getPreview (index);
+    return (new ZarrCachedGrid (preview, new File (rootDir, variables[index]), false));
+
+  } // getVariable
+
+  ////////////////////////////////////////////////////////////
+
+  /** Produces data chunks directly from the chunk files. */
+  private static class ZarrChunkProducer extends GridChunkProducer {
+
+    public ZarrChunkProducer (ZarrCachedGrid grid) { super (grid); }
+
+    @Override
+    public DataChunk getChunk (ChunkPosition pos) {
+
+      DataChunk chunk;
+
+      // Get a non-native chunk
+      // ----------------------
+      if (!scheme.isNativePosition (pos)) {
+        chunk = super.getChunk (pos);
+      } // if
+
+      // Get a native chunk
+      // ------------------
+      else {
+        Object data;
+        try { data = ((ZarrCachedGrid) grid).getChunkData (pos.start, pos.length); }
+        catch (IOException e) { throw new RuntimeException (e); }
+        chunk = DataChunkFactory.getInstance().create (data,
+          grid.getUnsigned(), grid.getMissing(), packing, scaling);
+      } // else
+
+      return (chunk);
+
+    } // getChunk
+
+  } // ZarrChunkProducer class
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public ChunkProducer getChunkProducer (
+    String name
+  ) throws IOException {
+
+    DataVariable var = getVariable (name);
+    if (!(var instanceof ZarrCachedGrid))
+      throw new IOException ("Chunk producer not available for variable " + name);
+
+    return (new ZarrChunkProducer ((ZarrCachedGrid) var));
+
+  } // getChunkProducer
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public void close () throws IOException { }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (ZarrReader.class);
+
+    // ------------------------->
+
+    logger.test ("Framework");
+
+    int rows = 300, cols = 250;
+    EarthTransform trans = MapProjectionFactory.getInstance().create (
+      ProjectionConstants.MERCAT,
+      0,
+      new double[15],
+      SpheroidConstants.WGS84,
+      new int[] {rows, cols},
+      new EarthLocation (48, -125),
+      new double[] {2000, 2000}
+    );
+    SatelliteDataInfo info = new SatelliteDataInfo (
+      "petros-1",
+      "java-19",
+      Arrays.asList (new TimePeriod (new Date (86400000L*20000 + 3600000L), 12*60*1000)),
+      trans,
+      "Petros RS Inc.",
+      "Created by unit test"
+    );
+
+    short[] sstData = new short[rows*cols];
+    for (int i = 0; i < sstData.length; i++) sstData[i] = (short) (i % 3000 - 1000);
+    sstData[17] = Short.MIN_VALUE;
+    Grid sst = new Grid ("sst", "Sea surface temperature", "degrees_Celsius",
+      rows, cols, sstData, new DecimalFormat ("0.00"), new double[] {0.01, 0},
+      Short.MIN_VALUE);
+
+    byte[] maskData = new byte[rows*cols];
+    for (int i = 0; i < maskData.length; i++) maskData[i] = (byte) (i % 256);
+    Grid mask = new Grid ("mask", "Cloud mask", "", rows, cols, maskData,
+      new DecimalFormat ("0"), null, null);
+    mask.setUnsigned (true);
+
+    Path dir = Files.createTempDirectory ("ZarrReaderTest");
+    String path = new File (dir.toFile(), "test.zarr").getPath();
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("ZarrWriter, parallel chunk writes");
+
+    ZarrWriter writer = new ZarrWriter (info, path);
+    writer.setChunkDims (new int[] {64, 48});
+    writer.addVariable (sst);
+    ZarrCachedGrid maskOut = new ZarrCachedGrid (mask, writer);
+    GridChunkConsumer consumer = new GridChunkConsumer (maskOut);
+    ChunkingScheme scheme = consumer.getNativeScheme();
+    assert (Arrays.equals (scheme.getChunkSize(), new int[] {64, 48}));
+    GridChunkProducer source = new GridChunkProducer (mask);
+    ExecutorService executor = Executors.newFixedThreadPool (4);
+    List<Future<?>> futureList = new ArrayList<>();
+    for (ChunkPosition pos : scheme) {
+      futureList.add (executor.submit (() -> consumer.putChunk (pos, source.getChunk (pos))));
+    } // for
+    for (Future<?> future : futureList) future.get();
+    executor.shutdown();
+    writer.close();
+
+    assert (new File (path, ".zgroup").isFile());
+    assert (new File (path, "sst/.zarray").isFile());
+    assert (new File (path, "mask/0.0").isFile());
+    assert (new File (path, "mask/4.5").isFile());
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("ZarrCachedGrid, mixed cached and direct writes");
+
+    String mixedPath = new File (dir.toFile(), "mixed.zarr").getPath();
+    ZarrWriter mixedWriter = new ZarrWriter (info, mixedPath);
+    mixedWriter.setChunkDims (new int[] {64, 48});
+    ZarrCachedGrid mixedOut = new ZarrCachedGrid (mask, mixedWriter);
+    int[] chunkStart = new int[] {0, 0};
+    int[] chunkLength = new int[] {64, 48};
+    byte[] chunkData = new byte[chunkLength[0]*chunkLength[1]];
+    Arrays.fill (chunkData, (byte) 3);
+
+    mixedOut.setValue (10, 10, 7);
+    mixedOut.putChunkData (chunkData, chunkStart, chunkLength);
+    assert (mixedOut.getValue (10, 10) == 3);
+    mixedOut.setValue (20, 20, 5);
+    mixedOut.putChunkData (chunkData, chunkStart, chunkLength);
+    mixedOut.setValue (30, 30, 9);
+    mixedWriter.close();
+
+    EarthDataReader mixedReader = EarthDataReaderFactory.create (mixedPath);
+    Grid mixedIn = (Grid) mixedReader.getVariable ("mask");
+    assert (mixedIn.getValue (10, 10) == 3);
+    assert (mixedIn.getValue (20, 20) == 3);
+    assert (mixedIn.getValue (30, 30) == 9);
+    assert (mixedIn.getValue (0, 0) == 3);
+    mixedReader.close();
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("constructor, getInfo");
+
+    EarthDataReader reader = EarthDataReaderFactory.create (path);
+    assert (reader instanceof ZarrReader);
+    assert (reader.getVariables() == 2);
+    EarthDataInfo readInfo = reader.getInfo();
+    assert (readInfo instanceof SatelliteDataInfo);
+    assert (((SatelliteDataInfo) readInfo).getSatellite().equals ("petros-1"));
+    assert (readInfo.getStartDate().equals (info.getStartDate()));
+    assert (readInfo.getTransform().equals (trans));
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getVariable, getChunkProducer");
+
+    Grid sstIn = (Grid) reader.getVariable ("sst");
+    assert (sstIn.getLongName().equals ("Sea surface temperature"));
+    assert (Arrays.equals (sstIn.getScaling(), new double[] {0.01, 0}));
+    assert (sstIn.getMissing().equals (Short.MIN_VALUE));
+    assert (Arrays.equals ((short[]) sstIn.getData(), sstData));
+    assert (Double.isNaN (sstIn.getValue (17)));
+    assert (Math.abs (sstIn.getValue (1) - sst.getValue (1)) < 1e-6);
+
+    Grid maskIn = (Grid) reader.getVariable ("mask");
+    assert (maskIn.getUnsigned());
+    assert (Arrays.equals ((byte[]) maskIn.getData(), maskData));
+
+    ChunkProducer producer = reader.getChunkProducer ("mask");
+    for (ChunkPosition pos : producer.getNativeScheme()) {
+      byte[] chunkData = (byte[]) producer.getChunk (pos).getPrimitiveData();
+      byte[] expected = (byte[]) mask.getData (pos.start, pos.length);
+      assert (Arrays.equals (chunkData, expected));
+    } // for
+    reader.close();
+
+    Files.walk (dir).sorted (Comparator.reverseOrder()).forEach (p -> p.toFile().delete());
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // ZarrReader class
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,400 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: ZarrWriter.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io;
+
+// Imports
+// -------
+import java.awt.geom.AffineTransform;
+import java.io.File;
+import java.io.IOException;
+import java.io.UnsupportedEncodingException;
+import java.util.HashSet;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.Set;
+import java.util.zip.Deflater;
+import noaa.coastwatch.io.EarthDataWriter;
+import noaa.coastwatch.io.ZarrCachedGrid;
+import noaa.coastwatch.io.tile.TilingScheme;
+import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
+import noaa.coastwatch.tools.ToolServices;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.MetadataServices;
+import noaa.coastwatch.util.trans.DataProjection;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.MapProjection;
+
+/**
+ * The <code>ZarrWriter</code> class writes earth data to a directory
+ * store in the Zarr version 2 layout.  The store is a Zarr group with
+ * global attributes in the same style as CoastWatch HDF, and each 2D grid
+ * variable is a Zarr array with CF-style attributes.  Each chunk of each
+ * array is an independently compressed file, so unlike the single file
+ * writers, chunks may be written concurrently by multiple threads with no
+ * locking.  To take advantage of this, create output variables as
+ * {@link ZarrCachedGrid} objects and write data to them through a
+ * {@link noaa.coastwatch.util.chunk.GridChunkConsumer}.  Grids that are not
+ * Zarr cached grids are written chunk by chunk during {@link #flush}.<p>
+ *
+ * The following earth transforms are supported: {@link MapProjection}
+ * using the CoastWatch HDF GCTP attributes, and {@link DataProjection}
+ * using latitude and longitude arrays in the store.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public class ZarrWriter
+  extends EarthDataWriter {
+
+  // Constants
+  // ---------
+
+  /** Default chunk size in bytes. */
+  public final static int DEFAULT_CHUNK_SIZE = 512*1024;
+
+  /** The group metadata file name. */
+  public final static String GROUP_FILE = ".zgroup";
+
+  // Variables
+  // ---------
+
+  /** The root directory of the store. */
+  private File rootDir;
+
+  /** The global attributes. */
+  private Map<String,Object> globalAttributes;
+
+  /** The compression level, or 0 for no compression. */
+  private int level = Deflater.DEFAULT_COMPRESSION;
+
+  /** The chunk size in bytes. */
+  private int chunkSize = DEFAULT_CHUNK_SIZE;
+
+  /** The chunk dimensions or null to use the chunk size. */
+  private int[] chunkDims;
+
+  /** The variables whose data has been completely written. */
+  private Set<DataVariable> writtenSet = new HashSet<>();
+
+  /** The closed flag, true if the writer has been closed. */
+  private boolean closed;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the compression level for arrays created after this call.
+   *
+   * @param level the compression level in the range [0..9], where 0 is
+   * no compression.  The default is the zlib default level.
+   */
+  public void setCompressionLevel (int level) { this.level = level; }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the chunk size for arrays created after this call.  The chunk
+   * dimensions are computed as the largest square chunk that fits the
+   * size.
+   *
+   * @param size the chunk size in bytes.
+   */
+  public void setChunkSize (int size) { chunkSize = size; chunkDims = null; }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the chunk dimensions for arrays created after this call.
+   *
+   * @param dims the chunk dimensions as [rows, columns], or null to use
+   * the chunk size.
+   */
+  public void setChunkDims (int[] dims) {
+
+    chunkDims = (dims == null ? null : (int[]) dims.clone());
+
+  } // setChunkDims
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new Zarr writer.  The store directory is created and the
+   * group metadata and global attributes are written.
+   *
+   * @param info the earth data info object.
+   * @param path the new store directory path.  The directory must not
+   * exist, or be empty.
+   *
+   * @throws UnsupportedEncodingException if the earth transform is not
+   * supported.
+   * @throws IOException if an error occurred creating the store.
+   */
+  public ZarrWriter (
+    EarthDataInfo info,
+    String path
+  ) throws IOException {
+
+    super (path);
+    this.info = info;
+
+    // Create directory
+    // ----------------
+    rootDir = new File (path);
+    if (rootDir.exists()) {
+      String[] files = rootDir.list();
+      if (files == null || files.length != 0)
+        throw new IOException ("Output " + path + " already exists");
+    } // if
+    else if (!rootDir.mkdirs())
+      throw new IOException ("Cannot create directory " + path);
+
+    // Write group
+    // -----------
+    Map<String,Object> group = new LinkedHashMap<>();
+    group.put ("zarr_format", 2);
+    JSONMetadataServices.writeMetadata (new File (rootDir, GROUP_FILE), group);
+
+    // Write global attributes
+    // -----------------------
+    globalAttributes = new LinkedHashMap<>();
+    setGlobalInfo();
+    JSONMetadataServices.writeMetadata (new File (rootDir, ZarrCachedGrid.ATTRIBUTES_FILE),
+      globalAttributes);
+
+  } // ZarrWriter constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates the global attributes from the earth data info. */
+  private void setGlobalInfo () throws IOException {
+
+    JSONMetadataServices.putInfoAttributes (info, globalAttributes);
+
+    // Write data projection coordinates
+    // ---------------------------------
+    EarthTransform trans = info.getTransform();
+    if (trans instanceof DataProjection) {
+      DataVariable lat = ((DataProjection) trans).getLat();
+      DataVariable lon = ((DataProjection) trans).getLon();
+      if (!(lat instanceof Grid) || !(lon instanceof Grid))
+        throw new UnsupportedEncodingException ("Unsupported data projection coordinate variables");
+      globalAttributes.put ("coordinates", lat.getName() + " " + lon.getName());
+      writeGrid ((Grid) lat);
+      writeGrid ((Grid) lon);
+    } // if
+    else if (!(trans instanceof MapProjection)) {
+      throw new UnsupportedEncodingException ("Unsupported earth transform class " +
+        trans.getClass().getName());
+    } // else if
+
+  } // setGlobalInfo
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new array directory and metadata for a grid variable.
+   *
+   * @param grid the grid to create an array for.
+   *
+   * @return the new array directory.
+   *
+   * @throws IOException if the array already exists or an error occurred
+   * writing the metadata.
+   */
+  File createArray (
+    Grid grid
+  ) throws IOException {
+
+    // Create directory
+    // ----------------
+    String name = grid.getName();
+    File arrayDir = new File (rootDir, name);
+    if (name.isEmpty() || name.startsWith (".") || name.contains (File.separator))
+      throw new IOException ("Invalid array name '" + name + "'");
+    if (arrayDir.exists())
+      throw new IOException ("Variable '" + name + "' already exists");
+    if (!arrayDir.mkdir())
+      throw new IOException ("Cannot create directory " + arrayDir);
+
+    // Get fill value
+    // --------------
+    /**
+     * As in the HDF writer, floating point variables with no missing
+     * value are given NaN as a fill so that unwritten chunks in a
+     * reprojection show as missing.
+     */
+    Object missing = grid.getMissing();
+    Class dataClass = grid.getDataClass();
+    if (missing == null) {
+      if (dataClass.equals (Float.TYPE)) missing = Float.valueOf (Float.NaN);
+      else if (dataClass.equals (Double.TYPE)) missing = Double.valueOf (Double.NaN);
+    } // if
+    else if (grid.getUnsigned() && !dataClass.equals (Long.TYPE)) {
+      int bits = DataVariable.getClassBits (dataClass);
+      missing = Long.valueOf (((Number) missing).longValue() & ((1L << bits) - 1));
+    } // else if
+
+    // Write array metadata
+    // --------------------
+    int[] dims = grid.getDimensions();
+    int[] chunks = chunkDims;
+    if (chunks == null) chunks = CachedGrid.getTileDims (chunkSize, grid);
+    chunks = new int[] {Math.min (chunks[Grid.ROWS], dims[Grid.ROWS]),
+      Math.min (chunks[Grid.COLS], dims[Grid.COLS])};
+    Map<String,Object> array = new LinkedHashMap<>();
+    array.put ("zarr_format", 2);
+    array.put ("shape", dims);
+    array.put ("chunks", chunks);
+    array.put ("dtype", ZarrCachedGrid.getDataType (dataClass, grid.getUnsigned()));
+    if (level == 0)
+      array.put ("compressor", null);
+    else {
+      Map<String,Object> compressor = new LinkedHashMap<>();
+      compressor.put ("id", "zlib");
+      compressor.put ("level", level < 0 ? 6 : level);
+      array.put ("compressor", compressor);
+    } // else
+    array.put ("fill_value", missing);
+    array.put ("order", "C");
+    array.put ("filters", null);
+    JSONMetadataServices.writeMetadata (new File (arrayDir, ZarrCachedGrid.ARRAY_FILE), array);
+
+    // Write variable attributes
+    // -------------------------
+    Map<String,Object> attributes = new LinkedHashMap<>();
+    JSONMetadataServices.putMetadata (grid.getMetadataMap(), attributes);
+    attributes.put ("_ARRAY_DIMENSIONS", new String[] {"rows", "cols"});
+    attributes.put ("long_name", grid.getLongName());
+    attributes.put ("units", grid.getUnits());
+    if (missing != null) attributes.put ("missing_value", missing);
+    double[] scaling = grid.getScaling();
+    if (scaling != null && !(scaling[0] == 1 && scaling[1] == 0)) {
+      attributes.put ("scale_factor", scaling[0]);
+      attributes.put ("add_offset", -scaling[0]*scaling[1]);
+    } // if
+    if (scaling != null || dataClass.equals (Float.TYPE) || dataClass.equals (Double.TYPE))
+      attributes.put ("fraction_digits", grid.getFormat().getMaximumFractionDigits());
+    AffineTransform nav = grid.getNavigation();
+    if (!nav.isIdentity()) {
+      double[] matrix = new double[6];
+      nav.getMatrix (matrix);
+      attributes.put ("nav_affine", matrix);
+    } // if
+    else attributes.remove ("nav_affine");
+    JSONMetadataServices.writeMetadata (new File (arrayDir, ZarrCachedGrid.ATTRIBUTES_FILE), attributes);
+
+    return (arrayDir);
+
+  } // createArray
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates and writes the full array data for an in-memory grid. */
+  private void writeGrid (
+    Grid grid
+  ) throws IOException {
+
+    ZarrCachedGrid dest = new ZarrCachedGrid (grid, createArray (grid), true);
+    TilingScheme tiling = dest.getTilingScheme();
+    int[] counts = tiling.getTileCounts();
+    int[] tileDims = tiling.getTileDimensions();
+    int total = counts[Grid.ROWS]*counts[Grid.COLS];
+    for (int i = 0; i < counts[Grid.ROWS] && !isCanceled; i++) {
+      for (int j = 0; j < counts[Grid.COLS] && !isCanceled; j++) {
+        TilePosition pos = tiling.new TilePosition (i, j);
+        int[] start = new int[] {i*tileDims[Grid.ROWS], j*tileDims[Grid.COLS]};
+        int[] length = pos.getDimensions();
+        dest.putChunkData (grid.getData (start, length), start, length);
+        synchronized (this) {
+          writeProgress = ((i*counts[Grid.COLS] + j + 1)*100)/total;
+        } // synchronized
+      } // for
+    } // for
+    writtenSet.add (grid);
+
+  } // writeGrid
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public void flush () throws IOException {
+
+    // Check for canceled
+    // ------------------
+    if (isCanceled) return;
+
+    // Write each variable
+    // -------------------
+    synchronized (this) { writeVariables = 0; }
+    for (DataVariable var : variables) {
+      if (isCanceled) break;
+      synchronized (this) {
+        writeVariableName = var.getName();
+        writeProgress = 0;
+      } // synchronized
+      if (var instanceof ZarrCachedGrid)
+        ((ZarrCachedGrid) var).flush();
+      else if (!writtenSet.contains (var)) {
+        if (!(var instanceof Grid))
+          throw new IOException ("Unsupported variable type for " + var.getName());
+        writeGrid ((Grid) var);
+      } // else if
+      synchronized (this) {
+        writeProgress = 0;
+        writeVariables++;
+      } // synchronized
+    } // for
+    synchronized (this) { writeVariableName = null; }
+
+  } // flush
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public void close () throws IOException {
+
+    // Check if already closed
+    // -----------------------
+    if (closed) return;
+    flush();
+
+    // Add to history
+    // --------------
+    String history = (String) globalAttributes.get ("history");
+    history = MetadataServices.append (history == null ? "" : history,
+      ToolServices.getToolVersion ("") + ToolServices.getCommandLine());
+    globalAttributes.put ("history", history);
+    JSONMetadataServices.writeMetadata (new File (rootDir, ZarrCachedGrid.ATTRIBUTES_FILE),
+      globalAttributes);
+
+    closed = true;
+
+  } // close
+
+  ////////////////////////////////////////////////////////////
+
+} // ZarrWriter class
+
+////////////////////////////////////////////////////////////////////////
@@ -32,6 +32,7 @@ import java.util.Iterator;
 import java.util.LinkedHashMap;
 import java.util.Map;
 import java.util.Set;
+import noaa.coastwatch.io.tile.OffHeapTileStore;
 import noaa.coastwatch.io.tile.TileCache;
 import noaa.coastwatch.io.tile.TileCacheKey;
 import noaa.coastwatch.io.tile.TileSource;
@@ -129,12 +130,21 @@ public class LRUTileCache
   
     // Remove entries if needed
     // ------------------------
+    /**
+     * Evicted tiles are moved to the off-heap store when enabled, so that
+     * a later request can promote them rather than read from the source.
+     */
     if (cacheSize > maxCacheSize) {
+      OffHeapTileStore store = OffHeapTileStore.getInstance();
       Iterator<Map.Entry<TileCacheKey, Tile>> iterator = entrySet().iterator();
       while (iterator.hasNext()) {
         Map.Entry<TileCacheKey, Tile> entry = iterator.next();
         iterator.remove();
         cacheSize = cacheSize - getBytesUsed (entry.getValue().getData());
+        if (store.isEnabled()) {
+          TileCacheKey key = entry.getKey();
+          store.put (new OffHeapTileStore.Key (key.getSource(), key.getPosition()), entry.getValue());
+        } // if
         if (cacheSize <= maxCacheSize) break;
       } // for
     } // if
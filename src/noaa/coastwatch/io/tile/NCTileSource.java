@@ -148,77 +148,71 @@ public class NCTileSource
     } // else
 
     /**
-     * We do this next part as synchronized just in case because the HDF 
-     * library documentation seems to indicate that the JNI layer is not
-     * thread safe.
-     *
-     * TODO: How does this interact with the NCCachedGrid check which is
-     * is similar for HDF 4 files?  Also what if we're using the HDF 5 library
-     * from somewhere else in code?  For now this is the only location (that
-     * we can find).
+     * We first try to detect chunking using the NetCDF layer, which is a
+     * pure Java solution and doesn't need the HDF 5 library lock.  The
+     * NetCDF layer reports the chunk dimensions of an HDF 5 variable as
+     * an attribute, and if present we use them directly as the tile
+     * dimensions, whatever the compression.
      */
     boolean isCompressed = false;
     long[] chunkSize = null;
-    synchronized (HDF5Lib.getInstance()) {
-    
-      // Check for HDF 5 format
-      // ----------------------
-      FileFormat h5Format = FileFormat.getFileFormat (FileFormat.FILE_TYPE_HDF5);
-      String location = file.getLocation();
-      boolean isH5 = h5Format.isThisType (location);
+    ucar.nc2.Attribute chunkSizeAtt = var.findAttribute ("_ChunkSizes");
+    if (chunkSizeAtt != null && chunkSizeAtt.getLength() == shape.length) {
+      chunkSize = (long[]) chunkSizeAtt.getValues().get1DJavaArray (long.class);
+    } // if
 
-      // Get chunking and compression info
-      // ---------------------------------
-      if (isH5) {
+    /**
+     * Otherwise we fall back to checking using the HDF 5 library if
+     * there's compression and chunking, since not knowing the compression
+     * can get us into performance issues below in deciding what tile size
+     * to use.  This is done while holding the library lock because the HDF
+     * library documentation seems to indicate that the JNI layer is not
+     * thread safe.  Only the metadata is read this way -- the tile data
+     * itself is read and decompressed by the NetCDF layer in Java, and only
+     * synchronizes on the NetCDF file.
+     */
+    else {
+      final String location = file.getLocation();
+      final boolean[] compressedFlag = new boolean[1];
+      try {
+        chunkSize = HDF5Lib.getInstance().callLocked (() -> {
 
-        try {
+          // Check for HDF 5 format
+          // ----------------------
+          FileFormat h5Format = FileFormat.getFileFormat (FileFormat.FILE_TYPE_HDF5);
+          if (!h5Format.isThisType (location)) return (null);
 
           // Open as HDF 5
           // -------------
           FileFormat hdfFile = h5Format.createInstance (location, FileFormat.READ);
           hdfFile.open();
+          try {
 
-          // Get chunk dimensions
-          // --------------------
-          Dataset hdfDataset = (Dataset) hdfFile.get (varName);
-          hdfDataset.getMetadata();
-          chunkSize = hdfDataset.getChunkSize();
-
-          // Get compression
-          // ---------------
-          String compression = hdfDataset.getCompression();
-          isCompressed = !compression.startsWith ("NONE");
-
-          // Close file
-          // ----------
-          hdfFile.close();
-
-        } // try
-        catch (Exception e) {
-          throw new IOException (e.toString());
-        } // catch
-        
-      } // if
+            // Get chunk dimensions
+            // --------------------
+            Dataset hdfDataset = (Dataset) hdfFile.get (varName);
+            hdfDataset.getMetadata();
+
+            // Get compression
+            // ---------------
+            String compression = hdfDataset.getCompression();
+            compressedFlag[0] = !compression.startsWith ("NONE");
+
+            return (hdfDataset.getChunkSize());
+
+          } // try
+          finally {
+            hdfFile.close();
+          } // finally
+
+        });
+      } // try
+      catch (Exception e) {
+        throw new IOException (e.toString());
+      } // catch
+      isCompressed = compressedFlag[0];
+    } // else
 
-    } // synchronized
-    
-    /**
-     * We could also do the chunk detection using the NetCDF layer as follows
-     * which is a pure Java solution, but the issue is that we can't
-     * get the compression type using this method.  Not knowing the
-     * compression can get us into performance issues below in deciding
-     * what tile size to use.  So for now, we specifically check using the
-     * HDF 5 library if there's compression and chunking.
-     */
-/*
-    boolean isCompressed = false;
-    long[] chunkSize = null;
-    ucar.nc2.Attribute chunkSizeAtt = var.findAttribute ("_ChunkSizes");
-    if (chunkSizeAtt != null) {
-      chunkSize = (long[]) chunkSizeAtt.getValues().get1DJavaArray (long.class);
-    } // if
-*/
- 
     // Set tile dimensions
     // -------------------
     int[] tileDims;
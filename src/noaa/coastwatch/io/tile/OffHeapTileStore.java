@@ -0,0 +1,792 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: OffHeapTileStore.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.io.tile;
+
+// Imports
+// -------
+import java.lang.ref.WeakReference;
+import java.lang.reflect.Array;
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.util.Arrays;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.zip.DataFormatException;
+import java.util.zip.Deflater;
+import java.util.zip.Inflater;
+import noaa.coastwatch.io.tile.TilingScheme;
+import noaa.coastwatch.io.tile.TilingScheme.Tile;
+import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>OffHeapTileStore</code> class is a second tier tile cache
+ * that holds tiles evicted from an on-heap cache in direct byte buffers
+ * outside the Java heap.  Off-heap tiles do not add to garbage
+ * collection work, so the store can be made much larger than the heap
+ * caches without long collection pauses.  When a tile is needed again,
+ * it is promoted back to the heap with a single memory copy (or a fast
+ * decompression), which is much cheaper than re-reading and
+ * re-decompressing the tile from its source file.<p>
+ *
+ * Tiles are moved between tiers rather than copied: a tile is added when
+ * evicted from a heap cache, and removed when promoted back.  The store
+ * uses a least-recently-used rule to stay within its byte budget.  Tiles
+ * may optionally be compressed with a fast deflate setting, which trades
+ * some promotion speed for holding more tiles.<p>
+ *
+ * Stored tiles are kept in fixed size blocks carved from large direct
+ * buffer slabs.  The slabs are reserved as the store fills up and are
+ * never released, and the blocks of removed tiles are reused for new
+ * tiles.  No direct memory is allocated or freed per tile, so the store
+ * does not depend on garbage collection to reclaim native memory.
+ * Compression is done on the heap into reusable per-thread buffers.<p>
+ *
+ * The shared instance is configured by system properties separately
+ * from the heap cache size: <code>cw.cache.offheap.size</code> gives
+ * the budget in megabytes (by default 0, which disables the store), and
+ * <code>cw.cache.offheap.compress</code> set to true turns on
+ * compression.  The JVM direct memory limit
+ * (<code>-XX:MaxDirectMemorySize</code>) must be large enough for the
+ * budget.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class OffHeapTileStore {
+
+  // Constants
+  // ---------
+
+  /** The store size property in megabytes. */
+  public static final String SIZE_PROP = "cw.cache.offheap.size";
+
+  /** The store compression property. */
+  public static final String COMPRESS_PROP = "cw.cache.offheap.compress";
+
+  /** The smallest block size in bytes. */
+  private static final int MIN_BLOCK_SIZE = 64;
+
+  /** The largest block size in bytes. */
+  private static final int MAX_BLOCK_SIZE = 64*1024;
+
+  /** The target number of blocks in the budget, used to pick a block size. */
+  private static final int TARGET_BLOCKS = 64;
+
+  /** The slab size in bytes. */
+  private static final int SLAB_SIZE = 64*1024*1024;
+
+  // Variables
+  // ---------
+
+  /** The shared instance of the store. */
+  private static OffHeapTileStore instance;
+
+  /** The maximum store size in bytes. */
+  private long maxBytes;
+
+  /** The current store size in bytes. */
+  private long bytes;
+
+  /** The compression flag. */
+  private boolean compress;
+
+  /** The stored entries in least recently used order. */
+  private LinkedHashMap<Key, Entry> entries;
+
+  /** The number of tiles promoted from the store. */
+  private long hits;
+
+  /** The number of tile requests not found in the store. */
+  private long misses;
+
+  /** The block size in bytes. */
+  private int blockSize;
+
+  /** The maximum number of blocks within the budget. */
+  private int maxBlocks;
+
+  /** The number of blocks in each slab. */
+  private int slabBlocks;
+
+  /** The direct buffer slabs, allocated as needed. */
+  private ByteBuffer[] slabs;
+
+  /** The number of blocks used so far from the slabs, free or not. */
+  private int nextBlock;
+
+  /** The stack of free block indices below the next block. */
+  private int[] freeBlocks = new int[16];
+
+  /** The number of free block indices in the stack. */
+  private int freeCount;
+
+  /** The per-thread buffers for copying and compression. */
+  private static final ThreadLocal<Staging> stagingLocal =
+    ThreadLocal.withInitial (Staging::new);
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Holds the reusable heap buffers and compression objects for one
+   * thread, so that no temporary buffers are created per tile.
+   */
+  private static class Staging {
+
+    /** The raw tile bytes in native order. */
+    public ByteBuffer raw = ByteBuffer.allocate (0);
+
+    /** The compressed tile bytes. */
+    public byte[] packed = new byte[0];
+
+    /** The deflater for compression. */
+    public Deflater deflater = new Deflater (Deflater.BEST_SPEED);
+
+    /** The inflater for decompression. */
+    public Inflater inflater = new Inflater();
+
+    /** Makes sure that the buffers can hold the specified bytes. */
+    public void ensureCapacity (int bytes) {
+      if (raw.capacity() < bytes) {
+        raw = ByteBuffer.allocate (bytes).order (ByteOrder.nativeOrder());
+        packed = new byte[bytes];
+      } // if
+      raw.clear();
+      raw.limit (bytes);
+    } // ensureCapacity
+
+  } // Staging class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * The <code>Key</code> class identifies a tile in the store by its
+   * owner, tiling scheme, and position.  The owner is the cached grid or
+   * tile source that evicted the tile.  The owner is weakly referenced so
+   * that stored tiles do not keep it from being collected; tiles of a
+   * collected owner are never found again and age out of the store.
+   */
+  public static class Key {
+
+    /** The tile owner. */
+    private WeakReference<Object> owner;
+
+    /** The identity hash code of the owner. */
+    private int ownerHash;
+
+    /** The tile position. */
+    private TilePosition pos;
+
+    /**
+     * Creates a new key.
+     *
+     * @param owner the tile owner, compared by identity.
+     * @param pos the tile position.  The position scheme is compared by
+     * identity, so that tiles from a previous tiling of the same owner
+     * do not match.
+     */
+    public Key (
+      Object owner,
+      TilePosition pos
+    ) {
+
+      this.owner = new WeakReference<Object> (owner);
+      this.ownerHash = System.identityHashCode (owner);
+      this.pos = pos;
+
+    } // Key constructor
+
+    /** Gets the tile owner, or null if collected. */
+    public Object getOwner () { return (owner.get()); }
+
+    @Override
+    public boolean equals (Object obj) {
+
+      boolean isEqual = false;
+      if (obj instanceof Key) {
+        Key key = (Key) obj;
+        Object thisOwner = this.owner.get();
+        isEqual = (
+          thisOwner != null &&
+          thisOwner == key.owner.get() &&
+          this.pos.getScheme() == key.pos.getScheme() &&
+          this.pos.equals (key.pos)
+        );
+      } // if
+
+      return (isEqual);
+
+    } // equals
+
+    @Override
+    public int hashCode () { return (ownerHash*1009 ^ pos.hashCode()*1013); }
+
+  } // Key class
+
+  ////////////////////////////////////////////////////////////
+
+  /** Holds the data for a stored tile. */
+  private static class Entry {
+
+    /** The tile position. */
+    public TilePosition pos;
+
+    /** The tile data array class. */
+    public Class dataClass;
+
+    /** The number of values in the tile. */
+    public int values;
+
+    /** The uncompressed size of the tile data in bytes. */
+    public int rawBytes;
+
+    /** The size of the stored tile data in bytes. */
+    public int storedBytes;
+
+    /** The compressed flag, true if the blocks hold deflated data. */
+    public boolean isCompressed;
+
+    /** The indices of the blocks holding the stored data. */
+    public int[] blocks;
+
+  } // Entry class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the shared instance of the store, configured from system
+   * properties.
+   *
+   * @return the shared store, which may be disabled.
+   */
+  public static synchronized OffHeapTileStore getInstance () {
+
+    if (instance == null) {
+      long megabytes = Long.parseLong (System.getProperty (SIZE_PROP, "0"));
+      boolean compress = Boolean.parseBoolean (System.getProperty (COMPRESS_PROP, "false"));
+      instance = new OffHeapTileStore (megabytes*1024*1024, compress);
+    } // if
+
+    return (instance);
+
+  } // getInstance
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new store.
+   *
+   * @param maxBytes the maximum store size in bytes, or 0 to disable.
+   * @param compress the compression flag, true to compress tiles.
+   */
+  public OffHeapTileStore (
+    long maxBytes,
+    boolean compress
+  ) {
+
+    this.maxBytes = maxBytes;
+    this.compress = compress;
+    this.entries = new LinkedHashMap<Key, Entry> (16, 0.75f, true);
+
+    /**
+     * The block size is chosen so that the budget holds a reasonable
+     * number of blocks, within limits.  Small blocks waste less space at
+     * the end of each tile, and large blocks need fewer copies.
+     */
+    long size = Math.max (MIN_BLOCK_SIZE, Math.min (MAX_BLOCK_SIZE, maxBytes/TARGET_BLOCKS));
+    blockSize = (int) Long.highestOneBit (size);
+    maxBlocks = (int) Math.min (Integer.MAX_VALUE, maxBytes/blockSize);
+    slabBlocks = Math.max (1, Math.min (maxBlocks, SLAB_SIZE/blockSize));
+    slabs = new ByteBuffer[(maxBlocks + slabBlocks - 1)/slabBlocks];
+
+  } // OffHeapTileStore constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /** Determines if the store is enabled, ie: has a non-zero budget. */
+  public boolean isEnabled () { return (maxBytes > 0); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the maximum store size in bytes. */
+  public long getSizeLimit () { return (maxBytes); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the current store size in bytes. */
+  public synchronized long getSize () { return (bytes); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of tiles currently stored. */
+  public synchronized int getTiles () { return (entries.size()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of tiles promoted from the store. */
+  public synchronized long getHits () { return (hits); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of tile requests not found in the store. */
+  public synchronized long getMisses () { return (misses); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the direct memory reserved for slabs in bytes. */
+  public synchronized long getReservedSize () {
+
+    long reserved = 0;
+    for (ByteBuffer slab : slabs) if (slab != null) reserved += slab.capacity();
+    return (reserved);
+
+  } // getReservedSize
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of blocks needed for the specified bytes. */
+  private int getBlocks (int bytes) { return ((bytes + blockSize - 1)/blockSize); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of blocks in use by entries. */
+  private int getUsedBlocks () { return (nextBlock - freeCount); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets a free block index, reserving a new slab if needed. */
+  private int allocateBlock () {
+
+    if (freeCount != 0) return (freeBlocks[--freeCount]);
+    int block = nextBlock++;
+    int slab = block/slabBlocks;
+    if (slabs[slab] == null) {
+      int blocks = Math.min (slabBlocks, maxBlocks - slab*slabBlocks);
+      slabs[slab] = ByteBuffer.allocateDirect (blocks*blockSize);
+    } // if
+
+    return (block);
+
+  } // allocateBlock
+
+  ////////////////////////////////////////////////////////////
+
+  /** Returns the blocks of an entry to the free stack. */
+  private void freeBlocks (
+    Entry entry
+  ) {
+
+    if (freeCount + entry.blocks.length > freeBlocks.length)
+      freeBlocks = Arrays.copyOf (freeBlocks, Math.max (freeBlocks.length*2,
+        freeCount + entry.blocks.length));
+    for (int block : entry.blocks) freeBlocks[freeCount++] = block;
+    bytes -= entry.storedBytes;
+
+  } // freeBlocks
+
+  ////////////////////////////////////////////////////////////
+
+  /** Copies bytes between an array and the blocks of an entry. */
+  private void copyBlocks (
+    Entry entry,
+    byte[] array,
+    boolean toBlocks
+  ) {
+
+    int offset = 0;
+    for (int block : entry.blocks) {
+      ByteBuffer slab = slabs[block/slabBlocks];
+      slab.position ((block % slabBlocks)*blockSize);
+      int length = Math.min (blockSize, entry.storedBytes - offset);
+      if (toBlocks) slab.put (array, offset, length);
+      else slab.get (array, offset, length);
+      offset += length;
+    } // for
+
+  } // copyBlocks
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of bytes per value for a primitive array class. */
+  private static int getValueBytes (
+    Class dataClass
+  ) {
+
+    int valueBytes;
+    if (dataClass.equals (byte[].class)) valueBytes = 1;
+    else if (dataClass.equals (short[].class)) valueBytes = 2;
+    else if (dataClass.equals (int[].class)) valueBytes = 4;
+    else if (dataClass.equals (long[].class)) valueBytes = 8;
+    else if (dataClass.equals (float[].class)) valueBytes = 4;
+    else if (dataClass.equals (double[].class)) valueBytes = 8;
+    else valueBytes = 0;
+
+    return (valueBytes);
+
+  } // getValueBytes
+
+  ////////////////////////////////////////////////////////////
+
+  /** Copies values from a primitive array into a buffer. */
+  private static void putValues (
+    ByteBuffer buffer,
+    Object data
+  ) {
+
+    if (data instanceof byte[]) buffer.put ((byte[]) data);
+    else if (data instanceof short[]) buffer.asShortBuffer().put ((short[]) data);
+    else if (data instanceof int[]) buffer.asIntBuffer().put ((int[]) data);
+    else if (data instanceof long[]) buffer.asLongBuffer().put ((long[]) data);
+    else if (data instanceof float[]) buffer.asFloatBuffer().put ((float[]) data);
+    else if (data instanceof double[]) buffer.asDoubleBuffer().put ((double[]) data);
+
+  } // putValues
+
+  ////////////////////////////////////////////////////////////
+
+  /** Copies values from a buffer into a primitive array. */
+  private static void getValues (
+    ByteBuffer buffer,
+    Object data
+  ) {
+
+    if (data instanceof byte[]) buffer.get ((byte[]) data);
+    else if (data instanceof short[]) buffer.asShortBuffer().get ((short[]) data);
+    else if (data instanceof int[]) buffer.asIntBuffer().get ((int[]) data);
+    else if (data instanceof long[]) buffer.asLongBuffer().get ((long[]) data);
+    else if (data instanceof float[]) buffer.asFloatBuffer().get ((float[]) data);
+    else if (data instanceof double[]) buffer.asDoubleBuffer().get ((double[]) data);
+
+  } // getValues
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Adds a tile to the store.  The tile data is copied off-heap, and the
+   * least recently used tiles are removed if needed to stay within the
+   * budget.  Tiles with an unsupported data type or larger than the
+   * budget are ignored.  The tile should not be dirty, since the store
+   * never writes tiles back to their source.
+   *
+   * @param key the tile key.
+   * @param tile the tile to add.
+   */
+  public void put (
+    Key key,
+    Tile tile
+  ) {
+
+    if (!isEnabled()) return;
+
+    // Check data
+    // ----------
+    Object data = tile.getData();
+    Class dataClass = data.getClass();
+    int valueBytes = getValueBytes (dataClass);
+    if (valueBytes == 0) return;
+    int values = Array.getLength (data);
+    int rawBytes = values*valueBytes;
+    if (rawBytes > maxBytes) return;
+
+    // Create entry
+    // ------------
+    /**
+     * The tile is converted to bytes and optionally compressed in the
+     * per-thread buffers outside the lock, so that threads evicting tiles
+     * from different grids do not wait on each other's compression.  Only
+     * the copy into the blocks is done while holding the lock.
+     */
+    Entry entry = new Entry();
+    entry.pos = tile.getPosition();
+    entry.dataClass = dataClass;
+    entry.values = values;
+    entry.rawBytes = rawBytes;
+    entry.storedBytes = rawBytes;
+    Staging staging = stagingLocal.get();
+    staging.ensureCapacity (rawBytes);
+    putValues (staging.raw, data);
+    byte[] stored = staging.raw.array();
+
+    if (compress) {
+      Deflater deflater = staging.deflater;
+      deflater.reset();
+      deflater.setInput (stored, 0, rawBytes);
+      deflater.finish();
+      int packedBytes = deflater.deflate (staging.packed, 0, rawBytes);
+      if (deflater.finished()) {
+        stored = staging.packed;
+        entry.storedBytes = packedBytes;
+        entry.isCompressed = true;
+      } // if
+    } // if
+
+    // Add to store
+    // ------------
+    synchronized (this) {
+      Entry previous = entries.remove (key);
+      if (previous != null) freeBlocks (previous);
+      int needed = getBlocks (entry.storedBytes);
+      Iterator<Entry> iter = entries.values().iterator();
+      while ((bytes + entry.storedBytes > maxBytes ||
+        getUsedBlocks() + needed > maxBlocks) && iter.hasNext()) {
+        Entry eldest = iter.next();
+        iter.remove();
+        freeBlocks (eldest);
+      } // while
+      if (getUsedBlocks() + needed > maxBlocks) return;
+      entry.blocks = new int[needed];
+      for (int i = 0; i < needed; i++) entry.blocks[i] = allocateBlock();
+      copyBlocks (entry, stored, true);
+      entries.put (key, entry);
+      bytes += entry.storedBytes;
+    } // synchronized
+
+  } // put
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Removes a tile from the store and promotes it back to the heap.
+   *
+   * @param key the tile key.
+   *
+   * @return the tile with a new data array, or null if the tile is not
+   * in the store.
+   */
+  public Tile remove (
+    Key key
+  ) {
+
+    if (!isEnabled()) return (null);
+
+    // Remove entry
+    // ------------
+    Entry entry;
+    Staging staging = stagingLocal.get();
+    synchronized (this) {
+      entry = entries.remove (key);
+      if (entry == null) { misses++; return (null); }
+      staging.ensureCapacity (entry.rawBytes);
+      copyBlocks (entry, entry.isCompressed ? staging.packed :
+        staging.raw.array(), false);
+      freeBlocks (entry);
+      hits++;
+    } // synchronized
+
+    // Copy data to heap
+    // -----------------
+    if (entry.isCompressed) {
+      Inflater inflater = staging.inflater;
+      inflater.reset();
+      inflater.setInput (staging.packed, 0, entry.storedBytes);
+      try { inflater.inflate (staging.raw.array(), 0, entry.rawBytes); }
+      catch (DataFormatException e) { throw new IllegalStateException (e.getMessage()); }
+    } // if
+    Object data = Array.newInstance (entry.dataClass.getComponentType(), entry.values);
+    getValues (staging.raw, data);
+
+    return (entry.pos.getScheme().new Tile (entry.pos, data));
+
+  } // remove
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Removes all tiles for an owner from the store, for example when
+   * the owner is closed and its tiles will never be needed again.
+   *
+   * @param owner the owner to remove tiles.
+   */
+  public synchronized void removeAll (
+    Object owner
+  ) {
+
+    if (entries.isEmpty()) return;
+    Iterator<Map.Entry<Key, Entry>> iter = entries.entrySet().iterator();
+    while (iter.hasNext()) {
+      Map.Entry<Key, Entry> mapEntry = iter.next();
+      Object keyOwner = mapEntry.getKey().getOwner();
+      if (keyOwner == owner || keyOwner == null) {
+        iter.remove();
+        freeBlocks (mapEntry.getValue());
+      } // if
+    } // while
+
+  } // removeAll
+
+  ////////////////////////////////////////////////////////////
+
+  /** Removes all tiles from the store, keeping the slabs for reuse. */
+  public synchronized void clear () {
+
+    entries.clear();
+    bytes = 0;
+    nextBlock = 0;
+    freeCount = 0;
+
+  } // clear
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (OffHeapTileStore.class);
+
+    TilingScheme scheme = new TilingScheme (new int[] {100, 200}, new int[] {40, 40});
+    Object owner = new Object();
+
+    // ------------------------->
+
+    logger.test ("put and remove");
+
+    for (int mode = 0; mode < 2; mode++) {
+      OffHeapTileStore store = new OffHeapTileStore (1024*1024, mode == 1);
+      assert (store.isEnabled());
+
+      TilePosition pos1 = scheme.new TilePosition (0, 0);
+      short[] shortData = new short[40*40];
+      for (int i = 0; i < shortData.length; i++) shortData[i] = (short) (i % 100 - 50);
+      store.put (new Key (owner, pos1), scheme.new Tile (pos1, shortData.clone()));
+
+      TilePosition pos2 = scheme.new TilePosition (2, 4);
+      float[] floatData = new float[20*40];
+      for (int i = 0; i < floatData.length; i++) floatData[i] = (float) Math.sin (i);
+      store.put (new Key (owner, pos2), scheme.new Tile (pos2, floatData.clone()));
+
+      assert (store.getTiles() == 2);
+      if (mode == 0) assert (store.getSize() == 40*40*2 + 20*40*4);
+      else assert (store.getSize() < 40*40*2 + 20*40*4);
+
+      Tile tile = store.remove (new Key (owner, scheme.new TilePosition (0, 0)));
+      assert (tile != null);
+      assert (tile.getPosition().equals (pos1));
+      assert (java.util.Arrays.equals ((short[]) tile.getData(), shortData));
+
+      tile = store.remove (new Key (owner, scheme.new TilePosition (2, 4)));
+      assert (java.util.Arrays.equals ((float[]) tile.getData(), floatData));
+
+      assert (store.remove (new Key (owner, pos1)) == null);
+      assert (store.getTiles() == 0);
+      assert (store.getSize() == 0);
+      assert (store.getHits() == 2);
+      assert (store.getMisses() == 1);
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("keys");
+
+    OffHeapTileStore store = new OffHeapTileStore (1024*1024, false);
+    TilePosition pos = scheme.new TilePosition (1, 1);
+    store.put (new Key (owner, pos), scheme.new Tile (pos, new byte[40*40]));
+    assert (store.remove (new Key (new Object(), pos)) == null);
+    TilingScheme otherScheme = new TilingScheme (new int[] {100, 200}, new int[] {40, 40});
+    assert (store.remove (new Key (owner, otherScheme.new TilePosition (1, 1))) == null);
+    assert (store.remove (new Key (owner, pos)) != null);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("budget and removeAll");
+
+    store = new OffHeapTileStore (40*40*3, false);
+    for (int col = 0; col < 4; col++) {
+      pos = scheme.new TilePosition (0, col);
+      store.put (new Key (owner, pos), scheme.new Tile (pos, new byte[40*40]));
+    } // for
+    assert (store.getTiles() == 3);
+    assert (store.getSize() == 40*40*3);
+    assert (store.remove (new Key (owner, scheme.new TilePosition (0, 0))) == null);
+    assert (store.remove (new Key (owner, scheme.new TilePosition (0, 3))) != null);
+
+    store.removeAll (owner);
+    assert (store.getTiles() == 0);
+    assert (store.getSize() == 0);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("block reuse");
+
+    for (int mode = 0; mode < 2; mode++) {
+      store = new OffHeapTileStore (40*40*4*3, mode == 1);
+      int[][] tileData = new int[4][40*40];
+      for (int k = 0; k < tileData.length; k++)
+        for (int i = 0; i < tileData[k].length; i++) tileData[k][i] = (i*(k+3)) % 1000;
+      for (int cycle = 0; cycle < 50; cycle++) {
+        for (int k = 0; k < 3; k++) {
+          pos = scheme.new TilePosition (1, k);
+          store.put (new Key (owner, pos), scheme.new Tile (pos, tileData[(k + cycle) % 4].clone()));
+        } // for
+        Tile tile = store.remove (new Key (owner, scheme.new TilePosition (1, 1)));
+        assert (java.util.Arrays.equals ((int[]) tile.getData(), tileData[(1 + cycle) % 4]));
+        pos = scheme.new TilePosition (2, 2);
+        store.put (new Key (owner, pos), scheme.new Tile (pos, tileData[cycle % 4].clone()));
+        tile = store.remove (new Key (owner, scheme.new TilePosition (1, 2)));
+        if (tile != null)
+          assert (java.util.Arrays.equals ((int[]) tile.getData(), tileData[(2 + cycle) % 4]));
+        tile = store.remove (new Key (owner, pos));
+        assert (java.util.Arrays.equals ((int[]) tile.getData(), tileData[cycle % 4]));
+      } // for
+      assert (store.getReservedSize() <= store.getSizeLimit());
+      store.clear();
+      assert (store.getTiles() == 0 && store.getSize() == 0);
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("disabled");
+
+    OffHeapTileStore disabled = new OffHeapTileStore (0, false);
+    assert (!disabled.isEnabled());
+    disabled.put (new Key (owner, pos), scheme.new Tile (pos, new byte[40*40]));
+    assert (disabled.getTiles() == 0);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // OffHeapTileStore class
+
+////////////////////////////////////////////////////////////////////////
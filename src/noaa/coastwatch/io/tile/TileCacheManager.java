@@ -34,6 +34,7 @@ import java.util.Observable;
 import java.util.Observer;
 import java.util.Set;
 import noaa.coastwatch.io.tile.LRUTileCache;
+import noaa.coastwatch.io.tile.OffHeapTileStore;
 import noaa.coastwatch.io.tile.TileCache;
 import noaa.coastwatch.io.tile.TileCacheKey;
 import noaa.coastwatch.io.tile.TileDeliveryOperation;
@@ -153,7 +154,8 @@ public class TileCacheManager {
     TileCacheKey key = new TileCacheKey (source, pos);
     Tile tile = cache.get (key);
     if (tile == null) {
-      tile = source.readTile (pos);
+      tile = promoteTile (source, pos);
+      if (tile == null) tile = source.readTile (pos);
       cache.put (key, tile);
     } // if
     
@@ -163,6 +165,31 @@ public class TileCacheManager {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets a tile from the off-heap tile store if available.
+   *
+   * @param source the source for the tile data.
+   * @param pos the position of the tile in the scheme.
+   *
+   * @return the tile promoted from the store, or null if the store
+   * is disabled or does not contain the tile.
+   */
+  private Tile promoteTile (
+    TileSource source,
+    TilePosition pos
+  ) {
+
+    OffHeapTileStore store = OffHeapTileStore.getInstance();
+    Tile tile = null;
+    if (store.isEnabled())
+      tile = store.remove (new OffHeapTileStore.Key (source, pos));
+
+    return (tile);
+
+  } // promoteTile
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Starts a delivery operation for the specified tiles.  If any tiles are
    * not already in the cache, they are read asynchronously.
@@ -206,6 +233,10 @@ public class TileCacheManager {
     for (TilePosition pos : positions) {
       TileCacheKey key = new TileCacheKey (source, pos);
       Tile tile = cache.get (key);
+      if (tile == null) {
+        tile = promoteTile (source, pos);
+        if (tile != null) cache.put (key, tile);
+      } // if
       if (tile != null)
         observer.update (null, tile);
       else
@@ -250,6 +281,8 @@ public class TileCacheManager {
       if (key.getSource() == source) keysToRemove.add (key);
     } // for
     for (TileCacheKey key : keysToRemove) cache.remove (key);
+    OffHeapTileStore store = OffHeapTileStore.getInstance();
+    if (store.isEnabled()) store.removeAll (source);
 
   } // removeTilesForSource
 
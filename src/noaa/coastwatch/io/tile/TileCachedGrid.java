@@ -40,6 +40,7 @@ import noaa.coastwatch.io.tile.TilingScheme;
 import noaa.coastwatch.io.tile.TilingScheme.Tile;
 import noaa.coastwatch.io.tile.TilingScheme.TilePosition;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
 
 // Testing
 import noaa.coastwatch.test.TestLogger;
@@ -118,6 +119,7 @@ public class TileCachedGrid
     // Initialize
     // ----------
     super (grid);
+    Statistics.copyAttributes (grid.getMetadataMap(), getMetadataMap());
     this.source = source;
     this.dataClass = grid.getDataClass();
     /**
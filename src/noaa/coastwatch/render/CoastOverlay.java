@@ -200,26 +200,33 @@ public class CoastOverlay extends PolygonOverlay {
 
     // Check if coastline reload required
     // ----------------------------------
+    boolean isReload = true;
     if (coast != null && prepared) {
       EarthArea selectedArea = coast.getArea();
       String selectedDatabase = coast.getDatabase();
       if (viewDatabase.equals (selectedDatabase)) {
         if (viewArea.equals (selectedArea))
-          return;
+          isReload = false;
       } // if
       else coast = null;
     } // if
 
     // Load coastline data
     // -------------------
-    try {
-      if (coast == null) 
-        coast = readerFactory.getPolygonReader (viewDatabase);
-      coast.setMinArea ((smallPolygons ? -1 : Math.pow (3*res, 2)));
-      coast.setPolygonRendering (getFillColor() != null);
-      coast.select (viewArea);
-    } // try
-    catch (Exception e) { e.printStackTrace(); coast = null; }
+    if (isReload) {
+      try {
+        if (coast == null) 
+          coast = readerFactory.getPolygonReader (viewDatabase);
+        coast.setMinArea ((smallPolygons ? -1 : Math.pow (3*res, 2)));
+        coast.setPolygonRendering (getFillColor() != null);
+        coast.select (viewArea);
+      } // try
+      catch (Exception e) { e.printStackTrace(); coast = null; }
+    } // if
+
+    // Project coastline data
+    // ----------------------
+    if (coast != null) coast.project (view.getTransform());
 
   } // prepare
 
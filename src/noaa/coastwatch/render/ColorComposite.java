@@ -31,6 +31,12 @@ import java.awt.Point;
 import java.awt.geom.AffineTransform;
 import java.awt.geom.NoninvertibleTransformException;
 import java.awt.image.BufferedImage;
+import java.awt.image.DataBufferInt;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.CountDownLatch;
+import java.util.concurrent.TimeUnit;
 import java.util.function.Function;
 
 import noaa.coastwatch.render.EarthDataView;
@@ -43,6 +49,10 @@ import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.trans.EarthTransform;
 import noaa.coastwatch.util.DataLocationConstraints;
 import noaa.coastwatch.util.VariableStatisticsGenerator;
+import noaa.coastwatch.util.chunk.ChunkOperation;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkingScheme;
+import noaa.coastwatch.util.chunk.PoolProcessor;
 
 /**
  * A color composite is a data view that creates an image based on
@@ -53,7 +63,8 @@ import noaa.coastwatch.util.VariableStatisticsGenerator;
  * values to byte data in the range [0..255].  Each byte is then used
  * as either the red, green, or blue component of a 24-bit color
  * value.  This is repeated for each pixel to form the overall
- * composite image.
+ * composite image.  The image is rendered in horizontal bands using
+ * multiple threads.
  *
  * @author Peter Hollemans
  * @since 3.1.1
@@ -72,6 +83,15 @@ public class ColorComposite
   /** The blue component. */
   public final static int BLUE = 2;
 
+  /** The number of image rows in each band rendered in parallel. */
+  private final static int BAND_HEIGHT = 64;
+
+  /** The time in milliseconds between rendering progress checks. */
+  private final static long PROGRESS_INTERVAL = 100;
+
+  /** The RGB value for missing data. */
+  private final static int BLACK = 0xff000000;
+
   // Variables
   // ---------
   /** The data grid variables for the composite. */
@@ -156,30 +176,122 @@ public class ColorComposite
   ////////////////////////////////////////////////////////////
 
   /**
-   * Gets the RGB value for a set of data values.
+   * Gets the RGB component bits for a data value.
+   *
+   * @param component the component, either <code>RED</code>,
+   * <code>GREEN</code>, or <code>BLUE</code>.
+   * @param value the data value.
+   *
+   * @return the component value in the range [0..255] shifted to the
+   * component position in a 24-bit color value.
+   */
+  private int getComponent (
+    int component,
+    double value
+  ) {
+
+    double norm;
+    if (Double.isNaN (value)) norm = 0;
+    else norm = funcs[component].getValue (value);
+    if (norm < 0) norm = 0;
+    else if (norm > 1) norm = 1;
+    int intVal = (int) (norm * 255);
+
+    return (intVal << ((2-component)*8));
+
+  } // getComponent
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a lookup table of RGB component bits for an integer-typed
+   * grid.  The table is indexed by the unsigned raw data value and takes
+   * into account the grid missing value, scaling, and lookup table.
+   *
+   * @param component the component to create the table for.
    *
-   * @param values the data values.
+   * @return the component lookup table, or null if the grid data type
+   * does not fit in a table.
+   */
+  private int[] createLookup (
+    int component
+  ) {
+
+    // Create array of all raw values
+    // ------------------------------
+    Grid grid = grids[component];
+    Class dataClass = grid.getDataClass();
+    Object raw;
+    int size;
+    if (dataClass.equals (Byte.TYPE)) {
+      size = 256;
+      byte[] rawBytes = new byte[size];
+      for (int i = 0; i < size; i++) rawBytes[i] = (byte) i;
+      raw = rawBytes;
+    } // if
+    else if (dataClass.equals (Short.TYPE)) {
+      size = 65536;
+      short[] rawShorts = new short[size];
+      for (int i = 0; i < size; i++) rawShorts[i] = (short) i;
+      raw = rawShorts;
+    } // else if
+    else return (null);
+
+    // Map raw values to components
+    // ----------------------------
+    Grid converter = new Grid (grid);
+    converter.setData (raw);
+    int[] lookup = new int[size];
+    for (int i = 0; i < size; i++)
+      lookup[i] = getComponent (component, converter.getValue (i));
+
+    return (lookup);
+
+  } // createLookup
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the RGB component bits for a set of raw data values.
    *
-   * @return an RGB value based on the data values and enhancement 
-   * functions.
+   * @param component the component to compute.
+   * @param raw the raw data array.
+   * @param converter the grid to use for converting raw data values
+   * to scaled values when no lookup table is available.
+   * @param lookup the component lookup table or null for none.
+   * @param indices the indices into the raw data array to compute.
+   * @param count the number of indices to compute.
+   * @param bits the output component bits.
    */
-  private int getRGB (
-    double[] values
+  private void getComponents (
+    int component,
+    Object raw,
+    Grid converter,
+    int[] lookup,
+    int[] indices,
+    int count,
+    int[] bits
   ) {
 
-    int rgbVal = 0xff000000;
-    for (int i = 0; i < 3; i++) {
-      double norm;
-      if (Double.isNaN (values[i])) norm = 0;
-      else norm = funcs[i].getValue(values[i]);
-      if (norm < 0) norm = 0;
-      else if (norm > 1) norm = 1;
-      int intVal = (int) (norm * 255);
-      rgbVal |= intVal << ((2-i)*8);
+    if (lookup != null && raw instanceof byte[]) {
+      byte[] rawBytes = (byte[]) raw;
+      for (int i = 0; i < count; i++) 
+        bits[i] = lookup[rawBytes[indices[i]] & 0xff];
     } // if
-    return (rgbVal);
 
-  } // getRGB
+    else if (lookup != null && raw instanceof short[]) {
+      short[] rawShorts = (short[]) raw;
+      for (int i = 0; i < count; i++) 
+        bits[i] = lookup[rawShorts[indices[i]] & 0xffff];
+    } // else if
+
+    else {
+      converter.setData (raw);
+      for (int i = 0; i < count; i++) 
+        bits[i] = getComponent (component, converter.getValue (indices[i]));
+    } // else
+
+  } // getComponents
 
   ////////////////////////////////////////////////////////////
 
@@ -191,6 +303,7 @@ public class ColorComposite
     // ----------------
     image = new BufferedImage (imageDims.width, imageDims.height,
       BufferedImage.TYPE_INT_RGB);
+    int[] pixels = ((DataBufferInt) image.getRaster().getDataBuffer()).getData();
 
     // Create coordinate caches
     // ------------------------
@@ -201,95 +314,251 @@ public class ColorComposite
         computeCaches (grids[0]);
     } // if
 
-    // Set update lines
-    // ----------------
-    int updateLines = (int) (imageDims.height * UPDATE_FRACTION);
-    int lines = 0;
-
-    // Create RGB row and values array
-    // -------------------------------
-    int[] rgbRow = new int[imageDims.width];
-    double[] values = new double[3];
+    // Create band operation
+    // ---------------------
+    /**
+     * The image is rendered in horizontal bands in parallel.  The grids
+     * may be cached grids that are not thread-safe, so data values are
+     * read while holding a lock over all the grids.  When the
+     * coordinate caches are available, each distinct grid row needed by
+     * a band is read as a raw data segment spanning the visible columns,
+     * which the cached grids copy a tile at a time, and integer data is
+     * converted to color components using lookup tables.  Otherwise
+     * each pixel location is transformed once and shared between the
+     * three grids.
+     */
+    ChunkOperation op;
+    if (hasCoordinateCaches())
+      op = createCachedBandOperation (pixels);
+    else
+      op = createTransformBandOperation (pixels);
+
+    ChunkingScheme scheme = new ChunkingScheme (
+      new int[] {imageDims.height, imageDims.width},
+      new int[] {BAND_HEIGHT, imageDims.width});
+    List<ChunkPosition> positions = new ArrayList<ChunkPosition>();
+    for (ChunkPosition pos : scheme) positions.add (pos);
+    int bands = positions.size();
+    CountDownLatch latch = new CountDownLatch (bands);
+    ChunkOperation countingOp = new ChunkOperation() {
+      public void perform (ChunkPosition pos) {
+        try { op.perform (pos); }
+        finally { latch.countDown(); }
+      } // perform
+    };
+
+    // Render bands
+    // ------------
+    PoolProcessor processor = new PoolProcessor();
+    processor.init (positions, countingOp);
+    processor.start();
+    int updateBands = Math.max (1, (int) (bands * UPDATE_FRACTION));
+    long lastDrawn = bands;
+    try {
+      while (!latch.await (PROGRESS_INTERVAL, TimeUnit.MILLISECONDS)) {
 
-    // Render using image transform
-    // ----------------------------
-    if (!hasCoordinateCaches()) {
-      ImageTransform imageTrans = trans.getImageTransform();
-      Point point = new Point();
-      for (point.y = 0; point.y < imageDims.height; point.y++) {
-
-        // Render line
-        // -----------
-        for (point.x = 0; point.x < imageDims.width; point.x++) {
-          DataLocation loc = imageTrans.transform (point);
-          values[0] = grids[0].getValue (loc);
-          values[1] = grids[1].getValue (loc);
-          values[2] = grids[2].getValue (loc);
-          rgbRow[point.x] = getRGB (values);
-        } // for
-        image.setRGB (0, point.y, imageDims.width, 1, rgbRow, 0, 
-          imageDims.width);
+        // Detect rendering stop
+        // ---------------------
+        if (stopRendering) {
+          processor.cancel();
+          return;
+        } // if
 
         // Show rendering progress
         // -----------------------
-        if (progress) {
-          lines++;
-          if (lines >= updateLines) {
-            g.drawImage (image, 0, 0, null);
-            lines = 0;
-          } // if
+        if (progress && lastDrawn - latch.getCount() >= updateBands) {
+          g.drawImage (image, 0, 0, null);
+          lastDrawn = latch.getCount();
         } // if
 
-        // Detect rendering stop
-        // ---------------------
-        if (stopRendering) return;
+      } // while
+    } // try
+    catch (InterruptedException e) {
+      processor.cancel();
+      return;
+    } // catch
+    processor.waitForCompletion();
 
-      } // for
-    } // if
+  } // prepare
 
-    // Render using cached coordinates
-    // -------------------------------
-    else {
-      int lastGridRow = Integer.MIN_VALUE;
-      for (int y = 0; y < imageDims.height; y++) {
-
-        // Render line
-        // -----------
-        if (rowCache[y] != lastGridRow) {
-          int lastGridCol = Integer.MIN_VALUE;
-          int rgbValue = 0;
-          for (int x = 0; x < imageDims.width; x++) {
-            if (colCache[x] != lastGridCol) {
-              values[0] = grids[0].getValue (rowCache[y], colCache[x]);
-              values[1] = grids[1].getValue (rowCache[y], colCache[x]);
-              values[2] = grids[2].getValue (rowCache[y], colCache[x]);
-              rgbValue = getRGB (values);
-              lastGridCol = colCache[x];
-            } // if
-            rgbRow[x] = rgbValue;
-          } // for
-          lastGridRow = rowCache[y];
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates an operation to render a band of the image using the
+   * coordinate caches.
+   *
+   * @param pixels the image pixels to write.
+   *
+   * @return the band operation.
+   */
+  private ChunkOperation createCachedBandOperation (
+    int[] pixels
+  ) {
+
+    // Find visible column range
+    // -------------------------
+    int width = imageDims.width;
+    int[] gridDims = grids[0].getDimensions();
+    int gridRows = gridDims[Grid.ROWS];
+    int gridCols = gridDims[Grid.COLS];
+    int colMin = Integer.MAX_VALUE, colMax = Integer.MIN_VALUE;
+    for (int x = 0; x < width; x++) {
+      int col = colCache[x];
+      if (col >= 0 && col < gridCols) {
+        if (col < colMin) colMin = col;
+        if (col > colMax) colMax = col;
+      } // if
+    } // for
+
+    // Map image columns to distinct grid columns
+    // ------------------------------------------
+    /**
+     * Many image columns may share the same grid column when the view
+     * is magnified, so the color is only computed once for each
+     * distinct grid column and copied to the others.
+     */
+    int[] distinct = new int[width];
+    int[] segmentIndices = new int[width];
+    int distinctCount = 0;
+    int lastCol = Integer.MIN_VALUE;
+    for (int x = 0; x < width; x++) {
+      int col = colCache[x];
+      if (col < 0 || col >= gridCols) distinct[x] = -1;
+      else {
+        if (col != lastCol) {
+          segmentIndices[distinctCount] = col - colMin;
+          distinctCount++;
+          lastCol = col;
         } // if
-        image.setRGB (0, y, imageDims.width, 1, rgbRow, 0, imageDims.width);
+        distinct[x] = distinctCount-1;
+      } // else
+    } // for
+    int colCount = (colMax >= colMin ? colMax - colMin + 1 : 0);
+    int indexCount = distinctCount;
+    int colStart = colMin;
+
+    // Create lookup tables
+    // --------------------
+    int[][] lookups = new int[3][];
+    for (int i = 0; i < 3; i++) lookups[i] = createLookup (i);
+
+    Object gridLock = new Object();
+    return (new ChunkOperation() {
+      public void perform (ChunkPosition pos) {
+
+        int startRow = pos.start[Grid.ROWS];
+        int endRow = startRow + pos.length[Grid.ROWS];
+        Grid[] converters = new Grid[3];
+        for (int i = 0; i < 3; i++) converters[i] = new Grid (grids[i]);
+        Object[] raw = new Object[3];
+        int[][] bits = new int[3][indexCount];
+        int lastGridRow = Integer.MIN_VALUE;
+
+        for (int y = startRow; y < endRow; y++) {
+          if (stopRendering) return;
+          int gridRow = rowCache[y];
+          int offset = y*width;
+
+          // Copy previous row
+          // -----------------
+          if (y != startRow && gridRow == lastGridRow) {
+            System.arraycopy (pixels, offset - width, pixels, offset, width);
+            continue;
+          } // if
+          lastGridRow = gridRow;
 
-        // Show rendering progress
-        // -----------------------
-        if (progress) {
-          lines++;
-          if (lines >= updateLines) {
-            g.drawImage (image, 0, 0, null);
-            lines = 0;
+          // Fill row outside the grid
+          // -------------------------
+          if (gridRow < 0 || gridRow >= gridRows || colCount == 0) {
+            Arrays.fill (pixels, offset, offset + width, BLACK);
+            continue;
           } // if
-        } // if
 
-        // Detect rendering stop
-        // ---------------------
-        if (stopRendering) return;
+          // Read data and compute colors
+          // ----------------------------
+          synchronized (gridLock) {
+            for (int i = 0; i < 3; i++) {
+              raw[i] = grids[i].getData (new int[] {gridRow, colStart},
+                new int[] {1, colCount});
+            } // for
+          } // synchronized
+          for (int i = 0; i < 3; i++) {
+            getComponents (i, raw[i], converters[i], lookups[i],
+              segmentIndices, indexCount, bits[i]);
+          } // for
+          for (int x = 0; x < width; x++) {
+            int index = distinct[x];
+            pixels[offset + x] = (index < 0 ? BLACK : 
+              BLACK | bits[0][index] | bits[1][index] | bits[2][index]);
+          } // for
 
-      } // for
-    } // else
- 
-  } // prepare
+        } // for
+
+      } // perform
+    });
+
+  } // createCachedBandOperation
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates an operation to render a band of the image using the
+   * image transform.
+   *
+   * @param pixels the image pixels to write.
+   *
+   * @return the band operation.
+   */
+  private ChunkOperation createTransformBandOperation (
+    int[] pixels
+  ) {
+
+    int width = imageDims.width;
+    ImageTransform imageTrans = trans.getImageTransform();
+    imageTrans.transform (new Point (0, 0));
+
+    Object gridLock = new Object();
+    return (new ChunkOperation() {
+      public void perform (ChunkPosition pos) {
+
+        int startRow = pos.start[Grid.ROWS];
+        int endRow = startRow + pos.length[Grid.ROWS];
+        DataLocation[] locs = new DataLocation[width];
+        double[][] values = new double[3][width];
+        Point point = new Point();
+
+        for (point.y = startRow; point.y < endRow; point.y++) {
+          if (stopRendering) return;
+
+          // Transform and read data
+          // -----------------------
+          for (point.x = 0; point.x < width; point.x++)
+            locs[point.x] = imageTrans.transform (point);
+          synchronized (gridLock) {
+            for (int i = 0; i < 3; i++) {
+              Grid grid = grids[i];
+              double[] gridValues = values[i];
+              for (int x = 0; x < width; x++) 
+                gridValues[x] = grid.getValue (locs[x]);
+            } // for
+          } // synchronized
+
+          // Compute colors
+          // --------------
+          int offset = point.y*width;
+          for (int x = 0; x < width; x++) {
+            pixels[offset + x] = BLACK |
+              getComponent (RED, values[RED][x]) |
+              getComponent (GREEN, values[GREEN][x]) |
+              getComponent (BLUE, values[BLUE][x]);
+          } // for
+
+        } // for
+
+      } // perform
+    });
+
+  } // createTransformBandOperation
 
   ////////////////////////////////////////////////////////////
 
@@ -380,9 +380,48 @@ public class ColorEnhancement
       imageGraphics.dispose();
     } // if
 
+    // Render rows
+    // -----------
+    renderRows (image, 0, g);
+ 
+  } // prepare
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  protected BufferedImage prepareStrip (
+    int y,
+    int rows
+  ) {
+
+    BufferedImage strip = new BufferedImage (imageDims.width, rows,
+      BufferedImage.TYPE_BYTE_INDEXED, colorModel);
+    renderRows (strip, y, null);
+
+    return (strip);
+
+  } // prepareStrip
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Renders data values into the rows of an image.
+   *
+   * @param target the target image, holding a range of view rows.
+   * @param startRow the view row of the first image row.
+   * @param g the graphics object to show rendering progress, or null
+   * for none.
+   */
+  private void renderRows (
+    BufferedImage target,
+    int startRow,
+    Graphics2D g
+  ) {
+
     // Get raster
     // ----------
-    WritableRaster raster = image.getRaster();
+    WritableRaster raster = target.getRaster();
+    int endRow = startRow + target.getHeight();
 
     // Create coordinate caches
     // ------------------------
@@ -397,6 +436,7 @@ public class ColorEnhancement
     // ----------------
     int updateLines = (int) (imageDims.height * UPDATE_FRACTION);
     int lines = 0;
+    boolean showProgress = (progress && g != null);
 
     // Create byte data row
     // --------------------
@@ -407,7 +447,7 @@ public class ColorEnhancement
     if (!hasCoordinateCaches()) {
       Point point = new Point();
       ImageTransform imageTrans = trans.getImageTransform();
-      for (point.y = 0; point.y < imageDims.height; point.y++) {
+      for (point.y = startRow; point.y < endRow; point.y++) {
 
         // Render line
         // -----------
@@ -415,14 +455,14 @@ public class ColorEnhancement
           byteRow[point.x] = getByte (grid.getValue (
             imageTrans.transform (point)), func);
         } // for
-        raster.setDataElements (0, point.y, imageDims.width, 1, byteRow);
+        raster.setDataElements (0, point.y - startRow, imageDims.width, 1, byteRow);
 
         // Show rendering progress
         // -----------------------
-        if (progress) {
+        if (showProgress) {
           lines++;
           if (lines >= updateLines) {
-            g.drawImage (image, 0, 0, null);
+            g.drawImage (target, 0, startRow, null);
             lines = 0;
           } // if
         } // if
@@ -438,7 +478,7 @@ public class ColorEnhancement
     // -------------------------------
     else {
       int lastGridRow = Integer.MIN_VALUE;
-      for (int y = 0; y < imageDims.height; y++) {
+      for (int y = startRow; y < endRow; y++) {
 
         // Render line
         // -----------
@@ -455,14 +495,14 @@ public class ColorEnhancement
           } // for
           lastGridRow = rowCache[y];
         } // if
-        raster.setDataElements (0, y, imageDims.width, 1, byteRow);
+        raster.setDataElements (0, y - startRow, imageDims.width, 1, byteRow);
 
         // Show rendering progress
         // -----------------------
-        if (progress) {
+        if (showProgress) {
           lines++;
           if (lines >= updateLines) {
-            g.drawImage (image, 0, 0, null);
+            g.drawImage (target, 0, startRow, null);
             lines = 0;
           } // if
         } // if
@@ -473,8 +513,8 @@ public class ColorEnhancement
 
       } // for
     } // else
- 
-  } // prepare
+
+  } // renderRows
 
   ////////////////////////////////////////////////////////////
 
@@ -299,7 +299,7 @@ public class DataReferenceOverlay
 
     // Create row lines
     // ----------------
-    EarthImageTransform trans = view.getTransform();
+    EarthImageTransform trans = view.getWorkTransform();
     LineCollection lines = new LineCollection();
     for (int i = 0; i < rows.length; i++) {
       if (rows[i] < startRow || rows[i] > endRow) continue;
@@ -285,17 +285,39 @@ public abstract class EarthDataOverlay
 
     // Prepare graphics
     // ----------------
-    if (!isPrepared (view)) {
-      prepare (g, view);
-      prepared = true;
-      lastTrans = view.getTransform();
-    } // if
+    prepareForView (g, view);
 
     // Draw graphics
     // -------------
     draw (g, view);
 
   } // render
+
+  ////////////////////////////////////////////////////////////
+
+  /** 
+   * Prepares the overlay graphics for a view if needed.  This is the
+   * preparation stage of {@link #render} without any drawing, and may
+   * be called ahead of rendering from a thread other than the one that
+   * eventually renders the overlay.
+   * 
+   * @param g the graphics object for drawing.
+   * @param view the earth data view.
+   *
+   * @since 3.7.0
+   */
+  public synchronized void prepareForView (
+    Graphics2D g,
+    EarthDataView view
+  ) {
+
+    if (!isPrepared (view)) {
+      prepare (g, view);
+      prepared = true;
+      lastTrans = view.getTransform();
+    } // if
+
+  } // prepareForView
  
   ////////////////////////////////////////////////////////////
 
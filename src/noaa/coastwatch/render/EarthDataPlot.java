@@ -248,7 +248,7 @@ public class EarthDataPlot
     Rectangle clip = g.getClipBounds();
     Rectangle viewRect = new Rectangle (topLeft.x, topLeft.y, viewSize.width,
       viewSize.height);
-    g.setClip (viewRect);
+    g.clip (viewRect);
     AffineTransform saved = g.getTransform();
     g.translate (topLeft.x, topLeft.y);
     view.render (g);
@@ -29,6 +29,7 @@ import java.awt.Color;
 import java.awt.Dimension;
 import java.awt.Graphics2D;
 import java.awt.Point;
+import java.awt.Rectangle;
 import java.awt.geom.AffineTransform;
 import java.awt.geom.NoninvertibleTransformException;
 import java.awt.geom.Point2D;
@@ -41,9 +42,15 @@ import java.util.Iterator;
 import java.util.LinkedList;
 import java.util.List;
 import java.util.Set;
+import java.util.Queue;
+import java.util.concurrent.ConcurrentLinkedQueue;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import noaa.coastwatch.render.EarthDataOverlay;
 import noaa.coastwatch.render.EarthImageTransform;
 import noaa.coastwatch.render.GraphicsServices;
+import noaa.coastwatch.render.GridContainerOverlay;
 import noaa.coastwatch.render.ImageTransform;
 import noaa.coastwatch.render.Legend;
 import noaa.coastwatch.render.OrientationAffineFactory;
@@ -95,7 +102,13 @@ import noaa.coastwatch.test.TestLogger;
  * the graphics context.  This two-step process may involve delays,
  * both in rendering the main image and the overlays.  For example, a
  * delay may occur when translating data values into image colours, or
- * in translating overlay earth locations to image coordinates.<p>
+ * in translating overlay earth locations to image coordinates.  To
+ * reduce the delay, overlays that need preparation and do not depend
+ * on grid data are prepared in a pool of threads while the data image
+ * is being prepared (see {@link #setMaxPrepareOperations}).  The
+ * overlays are still drawn in order on the rendering thread, so the
+ * rendered output is the same as if all preparation were done
+ * serially.<p>
  *
  * In order to help handle delays, two protected variables are used:
  * <code>changed</code> and <code>progress</code>.  The changed flag
@@ -299,6 +312,21 @@ public abstract class EarthDataView
   /** The default log level for the verbose logger. */
   private Level defaultLevel;
 
+  /** The maximum number of overlays to prepare in parallel. */
+  private int maxPrepareOperations = Runtime.getRuntime().availableProcessors();
+
+  /** The shared pool of threads for preparing overlays. */
+  private static ExecutorService preparePool;
+
+  /**
+   * The earth image transform for computations in a work view, or null
+   * to use the view transform.
+   */
+  private EarthImageTransform workTrans;
+
+  /** The strip rendering flag, true to prepare only the clipped rows. */
+  private boolean stripRendering;
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -414,6 +442,55 @@ public abstract class EarthDataView
 
   ////////////////////////////////////////////////////////////
   
+  /**
+   * Sets the maximum number of overlays to prepare in parallel during
+   * rendering.  Overlays that draw graphics from grid data are always
+   * prepared on the rendering thread after the data image, but other
+   * overlays such as coastlines, grid lines, and shapes are prepared
+   * concurrently with the data image.  The default is to use the number of
+   * available processors reported by the Java runtime.
+   *
+   * @param ops the maximum number of parallel preparation operations, or
+   * 1 to prepare all overlays on the rendering thread.
+   *
+   * @since 3.7.0
+   */
+  public void setMaxPrepareOperations (
+    int ops
+  ) {
+
+    this.maxPrepareOperations = ops;
+
+  } // setMaxPrepareOperations
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the strip rendering mode.  In strip rendering mode, when the
+   * view is rendered to a graphics context whose clip covers only some
+   * of the view rows, only those rows of the data image are prepared and
+   * the data image is not kept after rendering.  This allows a very large
+   * view to be rendered to an image file as a series of strips without
+   * holding the full data image in memory.  Views that do not support
+   * strip preparation prepare and keep the full data image as usual.
+   *
+   * @param flag the strip rendering flag, true to prepare only the
+   * clipped rows of the data image.
+   *
+   * @see #prepareStrip
+   *
+   * @since 3.7.0
+   */
+  public void setStripRendering (
+    boolean flag
+  ) {
+
+    this.stripRendering = flag;
+
+  } // setStripRendering
+
+  ////////////////////////////////////////////////////////////
+
   /** Gets the rendering progress mode flag. */
   public boolean getProgress () { return (progress); }
 
@@ -647,6 +724,27 @@ public abstract class EarthDataView
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the earth image transform to use for computations.  This is
+   * the same as the view transform, except when overlays are being
+   * prepared in parallel, in which case each preparation thread gets its
+   * own equivalent copy.  Overlays should use this transform to convert
+   * locations during preparation, and the view transform from
+   * {@link #getTransform} to identify the view that they were prepared
+   * for.
+   *
+   * @return the transform for computations.
+   *
+   * @since 3.7.0
+   */
+  public EarthImageTransform getWorkTransform () {
+
+    return (workTrans != null ? workTrans : trans);
+
+  } // getWorkTransform
+
+  ////////////////////////////////////////////////////////////
+
   /** 
    * Gets the data corners of this view as [upperLeft, lowerRight]. 
    *
@@ -1128,7 +1226,7 @@ public abstract class EarthDataView
   public double getResolution () {
 
     Point center = new Point ((imageDims.width-1)/2, (imageDims.height-1)/2);
-    return (trans.getResolution (center));
+    return (getWorkTransform().getResolution (center));
 
   } // getResolution
 
@@ -1230,6 +1328,31 @@ public abstract class EarthDataView
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Prepares a strip of rows of the data image for rendering in strip
+   * rendering mode.  By default strips are not supported and null is
+   * returned, in which case the full data image is prepared.
+   *
+   * @param y the first view row of the strip.
+   * @param rows the number of rows in the strip.
+   *
+   * @return the strip image, or null if strips are not supported.
+   *
+   * @see #setStripRendering
+   *
+   * @since 3.7.0
+   */
+  protected BufferedImage prepareStrip (
+    int y,
+    int rows
+  ) {
+
+    return (null);
+
+  } // prepareStrip
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Gets the status of view and overlay preparation. If the view is
    * prepared, a render call will return after almost no delay.  If
@@ -1290,6 +1413,130 @@ public abstract class EarthDataView
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the shared pool of daemon threads used to prepare overlays.
+   *
+   * @return the preparation thread pool.
+   */
+  private static synchronized ExecutorService getPreparePool () {
+
+    if (preparePool == null) {
+      preparePool = Executors.newCachedThreadPool (runnable -> {
+        Thread thread = new Thread (runnable, "EarthDataView-prepare");
+        thread.setDaemon (true);
+        return (thread);
+      });
+    } // if
+
+    return (preparePool);
+
+  } // getPreparePool
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a work view for use by an overlay preparation thread.  The
+   * work view is a shallow copy of this view that returns the same
+   * transform from {@link #getTransform}, so that overlays prepared with
+   * it are prepared for this view, but has its own copy of the earth
+   * transform in {@link #getWorkTransform}.
+   *
+   * @return the work view.
+   */
+  private EarthDataView createWorkView () {
+
+    EarthDataView view;
+    try { view = (EarthDataView) super.clone(); }
+    catch (CloneNotSupportedException e) { throw new RuntimeException (e); }
+    view.workTrans = new EarthImageTransform (
+      (EarthTransform) trans.getEarthTransform().clone(),
+      trans.getImageTransform());
+
+    return (view);
+
+  } // createWorkView
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Starts the preparation of overlays in parallel.  Only overlays that
+   * are visible, not yet prepared, and do not access grid data are
+   * started.  Grid data overlays may share grids and tile caches with
+   * the data image and each other, so they are left to be prepared on
+   * the rendering thread.
+   *
+   * @param g the graphics object for rendering.
+   * @param overlaysArray the overlays to be rendered.
+   * @param futureList the list to append preparation tasks to, left
+   * empty if no overlays were started.
+   */
+  private void startOverlayPreparation (
+    Graphics2D g,
+    EarthDataOverlay[] overlaysArray,
+    List<Future<Void>> futureList
+  ) {
+
+    // Find overlays to prepare
+    // ------------------------
+    List<EarthDataOverlay> prepareList = new ArrayList<>();
+    for (EarthDataOverlay overlay : overlaysArray) {
+      if (!(overlay instanceof GridContainerOverlay) && !overlay.isPrepared (this))
+        prepareList.add (overlay);
+    } // for
+    int threads = Math.min (maxPrepareOperations, prepareList.size());
+    if (threads < 1 || (threads == 1 && image != null)) return;
+
+    // Submit preparation tasks
+    // ------------------------
+    /**
+     * Each task prepares overlays from a shared queue using its own work
+     * view, so that earth transforms that keep intermediate values
+     * between calls are not shared between threads.  The view area is
+     * computed here first so that the work views all share it.
+     */
+    getArea();
+    Queue<EarthDataOverlay> prepareQueue = new ConcurrentLinkedQueue<> (prepareList);
+    ExecutorService pool = getPreparePool();
+    for (int i = 0; i < threads; i++) {
+      Graphics2D taskGraphics = (Graphics2D) g.create();
+      futureList.add (pool.submit (() -> {
+        try {
+          EarthDataView workView = createWorkView();
+          EarthDataOverlay overlay;
+          while (!stopRendering && (overlay = prepareQueue.poll()) != null) {
+            VERBOSE.info ("Preparing overlay " + overlay.getName());
+            overlay.prepareForView (taskGraphics, workView);
+          } // while
+        } // try
+        finally {
+          taskGraphics.dispose();
+        } // finally
+        return (null);
+      }));
+    } // for
+
+  } // startOverlayPreparation
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Waits for the overlay preparation tasks to complete.
+   *
+   * @param futureList the list of overlay preparation tasks.
+   */
+  private void waitForOverlayPreparation (
+    List<Future<Void>> futureList
+  ) {
+
+    futureList.forEach (future -> {
+      try { future.get(); }
+      catch (Exception e) { throw new RuntimeException (e); }
+    });
+
+  } // waitForOverlayPreparation
+
+  ////////////////////////////////////////////////////////////
+
   /** Renders this view using the graphics object. */
   public void render (
     Graphics2D g
@@ -1302,14 +1549,6 @@ public abstract class EarthDataView
       preRendering();
     } // synchronized
 
-    // Prepare data image
-    // ------------------
-    if (image == null) {
-      VERBOSE.info ("Preparing data image");
-      prepare (g);
-      if (stopRendering) { postRendering (true); return; }
-    } // if
-
     // Prepare overlays array
     // ----------------------
     ArrayList visibleOverlays = new ArrayList();
@@ -1321,9 +1560,72 @@ public abstract class EarthDataView
       (EarthDataOverlay[]) visibleOverlays.toArray (new EarthDataOverlay[]{});
     Arrays.sort (overlaysArray);
 
+    // Start overlay preparation
+    // -------------------------
+    /**
+     * Overlays are only prepared ahead of time when the graphics
+     * supports alpha, since otherwise transparent overlays are
+     * pre-drawn into the data image below using the image graphics.
+     */
+    boolean supportsAlpha = GraphicsServices.supportsAlpha (g);
+    List<Future<Void>> futureList = new ArrayList<>();
+    if (supportsAlpha) startOverlayPreparation (g, overlaysArray, futureList);
+
+    /**
+     * Any preparation tasks still running when we leave this block,
+     * either because rendering was stopped or an error occurred, are
+     * cancelled in the finally clause.
+     */
+    boolean isStrip = false;
+    BufferedImage stripImage = null;
+    int stripY = 0;
+    try {
+
+      // Prepare data image strip
+      // ------------------------
+      /**
+       * In strip rendering mode, only the rows within the clip are
+       * prepared.  We skip this when the image must be transformed or
+       * overlays pre-drawn into it, since both need the full image.
+       */
+      Rectangle clip = g.getClipBounds();
+      if (image == null && stripRendering && imageAffine == null &&
+        supportsAlpha && clip != null) {
+        stripY = Math.max (0, clip.y);
+        int stripRows = Math.min (imageDims.height, clip.y + clip.height) - stripY;
+        if (stripRows <= 0) isStrip = true;
+        else {
+          VERBOSE.info ("Preparing data image rows " + stripY + " to " + (stripY+stripRows-1));
+          stripImage = prepareStrip (stripY, stripRows);
+          if (stopRendering) { postRendering (false); return; }
+          isStrip = (stripImage != null);
+        } // else
+      } // if
+
+      // Prepare data image
+      // ------------------
+      if (image == null && !isStrip) {
+        VERBOSE.info ("Preparing data image");
+        prepare (g);
+        if (stopRendering) { postRendering (true); return; }
+      } // if
+
+      // Wait for overlay preparation
+      // ----------------------------
+      if (!futureList.isEmpty()) {
+        try { waitForOverlayPreparation (futureList); }
+        catch (RuntimeException e) { postRendering (false); throw e; }
+        if (stopRendering) { postRendering (false); return; }
+      } // if
+
+    } // try
+
+    finally {
+      for (Future<Void> future : futureList) future.cancel (true);
+    } // finally
+
     // Check if special alpha rendering is needed
     // ------------------------------------------
-    boolean supportsAlpha = GraphicsServices.supportsAlpha (g);
     Set preDrawSet = new HashSet();
     if (!supportsAlpha) {
 
@@ -1390,6 +1692,9 @@ public abstract class EarthDataView
       g.fillRect (0, 0, imageDims.width, imageDims.height);
       g.drawImage (image, imageAffine, null);
     } // if
+    else if (isStrip) {
+      if (stripImage != null) g.drawImage (stripImage, 0, stripY, null);
+    } // else if
     else
       g.drawImage (image, 0, 0, null);
 
@@ -27,6 +27,7 @@ package noaa.coastwatch.render;
 // ------
 import java.awt.Dimension;
 import java.awt.Point;
+import java.awt.geom.AffineTransform;
 import java.awt.geom.NoninvertibleTransformException;
 import java.awt.geom.Point2D;
 import noaa.coastwatch.render.ImageTransform;
@@ -272,6 +273,45 @@ public class EarthImageTransform {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the image offset from another transform that differs from this
+   * one only by a translation in the image space, as happens when a view
+   * is panned without changing its scale or earth transform.  In that
+   * case any image point computed with the other transform may be
+   * converted to this transform by adding the offset, rather than
+   * transforming from the earth location again.
+   *
+   * @param other the other transform to compare.
+   *
+   * @return the offset as an image point, or null if the transforms
+   * have different earth transforms or differ by more than a
+   * translation.
+   *
+   * @since 3.7.0
+   */
+  public Point2D getOffset (
+    EarthImageTransform other
+  ) {
+
+    if (other == null || earthTrans != other.earthTrans) return (null);
+    if (imageTrans == null || other.imageTrans == null) return (null);
+
+    AffineTransform affine = imageTrans.getAffine();
+    AffineTransform otherAffine = other.imageTrans.getAffine();
+    if (affine.getScaleX() != otherAffine.getScaleX() ||
+      affine.getScaleY() != otherAffine.getScaleY() ||
+      affine.getShearX() != otherAffine.getShearX() ||
+      affine.getShearY() != otherAffine.getShearY()) return (null);
+
+    return (new Point2D.Double (
+      affine.getTranslateX() - otherAffine.getTranslateX(),
+      affine.getTranslateY() - otherAffine.getTranslateY()
+    ));
+
+  } // getOffset
+
+  ////////////////////////////////////////////////////////////
+
 } // EarthImageTransform class
 
 ////////////////////////////////////////////////////////////////////////
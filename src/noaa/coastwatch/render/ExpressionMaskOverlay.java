@@ -26,17 +26,37 @@ package noaa.coastwatch.render;
 // Imports
 // -------
 import java.awt.Color;
+import java.io.File;
 import java.io.IOException;
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.text.DecimalFormat;
 import java.util.Arrays;
+import java.util.Comparator;
+import java.util.Date;
 import java.util.HashSet;
 import java.util.List;
 import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.io.ZarrWriter;
 import noaa.coastwatch.render.EarthDataView;
 import noaa.coastwatch.render.GridContainerOverlay;
 import noaa.coastwatch.render.MaskOverlay;
+import noaa.coastwatch.test.TestLogger;
 import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.expression.EvaluateImp;
+import noaa.coastwatch.util.expression.ExpressionParser;
 import noaa.coastwatch.util.expression.ExpressionParserFactory;
+import noaa.coastwatch.util.expression.ExpressionParserFactory.ParserStyle;
+import noaa.coastwatch.util.expression.ParseImp;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.SatelliteDataInfo;
+import noaa.coastwatch.util.TimePeriod;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+import noaa.coastwatch.util.trans.ProjectionConstants;
+import noaa.coastwatch.util.trans.SpheroidConstants;
 import org.nfunk.jep.JEP;
 import org.nfunk.jep.SymbolTable;
 
@@ -52,6 +72,7 @@ import org.nfunk.jep.SymbolTable;
  * @author Peter Hollemans
  * @since 3.2.1
  */
+@noaa.coastwatch.test.Testable
 public class ExpressionMaskOverlay 
   extends MaskOverlay
   implements GridContainerOverlay {
@@ -77,6 +98,96 @@ public class ExpressionMaskOverlay
   /** The input variables for the current expression. */
   private transient Grid[] inputVars;
 
+  /** 
+   * The compiled expression parser, or null if the expression could not
+   * be compiled.
+   */
+  private transient ExpressionParser compiledParser;
+
+  /** The input variable values for a row of distinct columns. */
+  private transient RowValues rowValues;
+
+  ////////////////////////////////////////////////////////////
+
+  /** 
+   * Provides input variable values for the compiled expression from
+   * arrays of values read for a row of data.
+   */
+  private static class RowValues implements EvaluateImp {
+
+    /** The distinct columns in the row. */
+    public int[] cols = new int[0];
+
+    /** The variable values as [variable][column index]. */
+    public double[][] values = new double[0][0];
+
+    /** The values read from one variable for a span of columns. */
+    public double[] span = new double[0];
+
+    /** The current column index for evaluation. */
+    public int index;
+
+    /** Ensures that the arrays can hold a number of columns. */
+    public void ensureCapacity (int vars, int count) {
+      if (cols.length < count || values.length != vars) {
+        cols = new int[count];
+        values = new double[vars][count];
+      } // if
+    } // ensureCapacity
+
+    /** Ensures that the span array can hold a number of columns. */
+    public void ensureSpan (int count) {
+      if (span.length < count) span = new double[count];
+    } // ensureSpan
+
+    @Override
+    public double getDoubleProperty (int varIndex) { return (values[varIndex][index]); }
+
+  } // RowValues class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Compiles an expression that uses the specified variables.
+   *
+   * @param expression the expression to compile.
+   * @param inputVarNames the input variable names, each supplied to
+   * the expression as a double value.
+   *
+   * @return the compiled parser, or null if the expression could not be
+   * compiled.
+   */
+  private static ExpressionParser compile (
+    String expression,
+    String[] inputVarNames
+  ) {
+
+    /**
+     * The expression uses JEP syntax, so we use the parser that translates
+     * JEP to Java and compiles the result to bytecode.  Variables are
+     * typed as double to match the values that JEP sees.  If the
+     * translation fails for some reason, the caller falls back on JEP.
+     */
+    final List<String> names = Arrays.asList (inputVarNames);
+    ParseImp parseImp = new ParseImp() {
+      public int indexOfVariable (String varName) { return (names.indexOf (varName)); }
+      public String typeOfVariable (String varName) { 
+        return (names.contains (varName) ? "Double" : null);
+      } // typeOfVariable
+    };
+
+    ExpressionParser parser = ExpressionParserFactory.getFactoryInstance().create (
+      ParserStyle.LEGACY_EMULATED);
+    try {
+      parser.init (parseImp);
+      parser.parse (expression);
+    } // try
+    catch (RuntimeException e) { parser = null; }
+
+    return (parser);
+
+  } // compile
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -153,6 +264,7 @@ public class ExpressionMaskOverlay
       this.parser = null;
       this.inputVarNames = new String[0];
       this.inputVars = new Grid[0];
+      this.compiledParser = null;
       invalidate();
       return;
     } // if
@@ -192,6 +304,8 @@ public class ExpressionMaskOverlay
     this.parser = parser;
     this.inputVarNames = inputVarNames;
     this.inputVars = inputVars;
+    this.compiledParser = compile (newExpression, inputVarNames);
+    this.rowValues = new RowValues();
     invalidate();
 
   } // setExpression
@@ -236,6 +350,115 @@ public class ExpressionMaskOverlay
 
   ////////////////////////////////////////////////////////////
 
+  /** 
+   * Evaluates the compiled expression for the current row values index.
+   *
+   * @return true if the expression evaluates to true or non-zero.
+   */
+  private boolean evaluateCompiled () {
+
+    boolean result;
+    switch (compiledParser.getResultType()) {
+    case BOOLEAN: result = compiledParser.evaluateToBoolean (rowValues); break;
+    case BYTE: result = (compiledParser.evaluateToByte (rowValues) != 0); break;
+    case SHORT: result = (compiledParser.evaluateToShort (rowValues) != 0); break;
+    case INT: result = (compiledParser.evaluateToInt (rowValues) != 0); break;
+    case LONG: result = (compiledParser.evaluateToLong (rowValues) != 0); break;
+    case FLOAT: result = (compiledParser.evaluateToFloat (rowValues) != 0); break;
+    default: result = (compiledParser.evaluateToDouble (rowValues) != 0); break;
+    } // switch
+
+    return (result);
+
+  } // evaluateCompiled
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Determines the mask for a row of locations using the compiled
+   * expression if available.  The values of each input variable are
+   * read in one span that covers the columns of the row, and then the
+   * expression is evaluated once per distinct column over the arrays
+   * without any symbol table updates.
+   */
+  @Override
+  protected void getMaskRow (
+    int row,
+    int[] cols,
+    int count,
+    boolean[] masked
+  ) {
+
+    // Check for compiled expression
+    // -----------------------------
+    if (compiledParser == null) {
+      super.getMaskRow (row, cols, count, masked);
+      return;
+    } // if
+
+    // Find distinct columns
+    // ---------------------
+    rowValues.ensureCapacity (inputVars.length, count);
+    int[] distinctCols = rowValues.cols;
+    int distinct = 0;
+    int lastCol = Integer.MIN_VALUE;
+    int minCol = Integer.MAX_VALUE;
+    int maxCol = Integer.MIN_VALUE;
+    for (int i = 0; i < count; i++) {
+      if (cols[i] != lastCol) {
+        distinctCols[distinct++] = cols[i];
+        lastCol = cols[i];
+        if (lastCol < minCol) minCol = lastCol;
+        if (lastCol > maxCol) maxCol = lastCol;
+      } // if
+    } // for
+
+    // Read variable values
+    // --------------------
+    /**
+     * Each variable is read for the span of columns clipped to the grid,
+     * and columns or rows outside the grid are given missing values, the
+     * same as reading each value with getValue (row, col) would do.
+     */
+    for (int var = 0; var < inputVars.length; var++) {
+      Grid grid = inputVars[var];
+      int[] dims = grid.getDimensions();
+      double[] values = rowValues.values[var];
+      int spanStart = Math.max (0, minCol);
+      int spanEnd = Math.min (dims[Grid.COLS]-1, maxCol);
+      if (row < 0 || row > dims[Grid.ROWS]-1 || spanStart > spanEnd) {
+        Arrays.fill (values, 0, distinct, Double.NaN);
+        continue;
+      } // if
+      int spanCount = spanEnd - spanStart + 1;
+      rowValues.ensureSpan (spanCount);
+      double[] span = rowValues.span;
+      grid.getValues (row, spanStart, spanCount, span);
+      for (int k = 0; k < distinct; k++) {
+        int col = distinctCols[k];
+        values[k] = ((col < spanStart || col > spanEnd) ? Double.NaN : span[col - spanStart]);
+      } // for
+    } // for
+
+    // Evaluate expression
+    // -------------------
+    int k = -1;
+    boolean value = false;
+    lastCol = Integer.MIN_VALUE;
+    for (int i = 0; i < count; i++) {
+      if (cols[i] != lastCol) {
+        k++;
+        rowValues.index = k;
+        value = evaluateCompiled();
+        lastCol = cols[i];
+      } // if
+      masked[i] = value;
+    } // for
+
+  } // getMaskRow
+
+  ////////////////////////////////////////////////////////////
+
   protected boolean isCompatible (
     EarthDataView view
   ) {
@@ -253,6 +476,117 @@ public class ExpressionMaskOverlay
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Tests this class.
+   *
+   * @param argv the command line arguments (unused).
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (ExpressionMaskOverlay.class);
+
+    // ------------------------->
+
+    logger.test ("Framework");
+
+    int rows = 50, cols = 70;
+    EarthTransform trans = MapProjectionFactory.getInstance().create (
+      ProjectionConstants.MERCAT,
+      0,
+      new double[15],
+      SpheroidConstants.WGS84,
+      new int[] {rows, cols},
+      new EarthLocation (48, -125),
+      new double[] {2000, 2000}
+    );
+    SatelliteDataInfo info = new SatelliteDataInfo (
+      "petros-1",
+      "java-19",
+      Arrays.asList (new TimePeriod (new Date (86400000L*20000), 12*60*1000)),
+      trans,
+      "Petros RS Inc.",
+      "Created by unit test"
+    );
+
+    short[] aData = new short[rows*cols];
+    for (int i = 0; i < aData.length; i++)
+      aData[i] = (i % 7 == 0 ? Short.MIN_VALUE : (short) ((i*37) % 2000 - 1000));
+    Grid a = new Grid ("a", "Variable a", "", rows, cols, aData,
+      new DecimalFormat ("0.00"), new double[] {0.01, 0}, Short.MIN_VALUE);
+    byte[] bData = new byte[rows*cols];
+    for (int i = 0; i < bData.length; i++) bData[i] = (byte) ((i*13) % 256);
+    Grid b = new Grid ("b", "Variable b", "", rows, cols, bData,
+      new DecimalFormat ("0"), null, null);
+    b.setUnsigned (true);
+
+    Path dir = Files.createTempDirectory ("ExpressionMaskOverlayTest");
+    String path = new File (dir.toFile(), "test.zarr").getPath();
+    ZarrWriter writer = new ZarrWriter (info, path);
+    writer.setChunkDims (new int[] {16, 16});
+    writer.addVariable (a);
+    writer.addVariable (b);
+    writer.close();
+    EarthDataReader reader = EarthDataReaderFactory.create (path);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getMaskRow");
+
+    ExpressionMaskOverlay overlay = new ExpressionMaskOverlay (Color.WHITE,
+      reader, Arrays.asList ("a", "b"), "a > 5 && b < 200");
+    assert (overlay.compiledParser != null);
+    overlay.getMaskRow (0, new int[0], 0, new boolean[0]);
+
+    /**
+     * The columns repeat, run past both edges of the grid, cross tile
+     * boundaries, and go back on themselves at the end, and the rows
+     * include some outside the grid.  Variable a is missing at column 0
+     * in rows 0 and 7, among others.
+     */
+    int[] testCols = new int[] {-3, -1, -1, 0, 0, 1, 5, 15, 16, 16, 17, 40,
+      69, 69, 70, 75, 30, 31};
+    int[] testRows = new int[] {-1, 0, 7, 17, 33, 49, 50};
+    String[] expressions = new String[] {
+      "a > 5 && b < 200",
+      "a < 0 || b == 3",
+      "(a + b) / 2 > 50",
+      "b"
+    };
+    Grid aIn = (Grid) reader.getVariable ("a");
+    assert (Double.isNaN (aIn.getValue (0, 0)));
+    assert (Double.isNaN (aIn.getValue (7, 0)));
+
+    boolean[] masked = new boolean[testCols.length];
+    DataLocation loc = new DataLocation (2);
+    int maskedCount = 0, unmaskedCount = 0;
+    for (String expression : expressions) {
+      overlay.setExpression (expression);
+      assert (overlay.compiledParser != null);
+      for (int row : testRows) {
+        overlay.getMaskRow (row, testCols, testCols.length, masked);
+        for (int i = 0; i < testCols.length; i++) {
+          loc.set (Grid.ROWS, row);
+          loc.set (Grid.COLS, testCols[i]);
+          assert (masked[i] == overlay.isMasked (loc, true));
+          if (masked[i]) maskedCount++;
+          else unmaskedCount++;
+        } // for
+      } // for
+    } // for
+    assert (maskedCount != 0 && unmaskedCount != 0);
+
+    reader.close();
+    Files.walk (dir).sorted (Comparator.reverseOrder()).forEach (p -> p.toFile().delete());
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
 } // ExpressionMaskOverlay class
 
 ////////////////////////////////////////////////////////////////////////
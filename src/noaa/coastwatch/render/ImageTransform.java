@@ -52,8 +52,12 @@ public class ImageTransform {
   /** The data to image coordinate transform. */
   private AffineTransform inverse;
 
-  /** The image to data location coordinate cache for rows. */
-  private double[] rowCache;
+  /** 
+   * The image to data location coordinate cache for rows.  The row cache
+   * is assigned last when the caches are computed so that a non-null row
+   * cache indicates that both caches are ready for use by any thread.
+   */
+  private volatile double[] rowCache;
 
   /** The image to data location coordinate cache for columns. */
   private double[] colCache;
@@ -324,26 +328,35 @@ public class ImageTransform {
   ////////////////////////////////////////////////////////////
 
   /** Creates a set of caches to speed image->data transforms. */
-  private void computeCaches () {
+  private synchronized void computeCaches () {
+
+    // Check for existing caches
+    // -------------------------
+    if (rowCache != null) return;
 
     // Create caches
     // -------------
-    rowCache = new double[imageDims.height];
-    colCache = new double[imageDims.width];
+    double[] newRowCache = new double[imageDims.height];
+    double[] newColCache = new double[imageDims.width];
 
     // Calculate cache points
     // ----------------------
     for (Point p = new Point (0,0); p.x < imageDims.width; p.x++) {
       DataLocation loc = new DataLocation (p.x, p.y);
       loc = loc.transform (forward);
-      colCache[p.x] = loc.get(Grid.COLS);
+      newColCache[p.x] = loc.get(Grid.COLS);
     } // for
     for (Point p = new Point (0,0); p.y < imageDims.height; p.y++) {
       DataLocation loc = new DataLocation (p.x, p.y);
       loc = loc.transform (forward);
-      rowCache[p.y] = loc.get(Grid.ROWS);
+      newRowCache[p.y] = loc.get(Grid.ROWS);
     } // for
 
+    // Publish caches
+    // --------------
+    colCache = newColCache;
+    rowCache = newRowCache;
+
   } // computeCaches
 
   ////////////////////////////////////////////////////////////
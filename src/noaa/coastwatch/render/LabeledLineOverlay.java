@@ -229,7 +229,7 @@ public abstract class LabeledLineOverlay
 
       // Determine which factory to use for labels
       // -----------------------------------------
-      EarthImageTransform trans = view.getTransform();
+      EarthImageTransform trans = view.getWorkTransform();
       Dimension imageDims = trans.getImageTransform().getImageDimensions();
       List<Point2D> pointList = new ArrayList<Point2D>();
       pointList.add (new Point2D.Double (0, 0));
@@ -208,7 +208,7 @@ public class LatLonOverlay
 
     // Create grid lines
     // -----------------
-    EarthImageTransform trans = view.getTransform();
+    EarthImageTransform trans = view.getWorkTransform();
     Datum datum = trans.getEarthTransform().getDatum();
     Iterator iter = area.getIterator();
     LineCollection lines = new LineCollection();
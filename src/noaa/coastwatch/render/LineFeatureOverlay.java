@@ -104,6 +104,10 @@ public class LineFeatureOverlay
       throw new RuntimeException (e);
     } // catch
 
+    // Project the selected data
+    // -------------------------
+    source.project (view.getTransform());
+
   } // prepare
 
   ////////////////////////////////////////////////////////////
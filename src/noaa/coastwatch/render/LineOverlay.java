@@ -133,11 +133,7 @@ public abstract class LineOverlay
 
     // Prepare graphics
     // ----------------
-    if (!isPrepared (view)) {
-      prepare (g, view);
-      prepared = true;
-      lastTrans = view.getTransform();
-    } // if
+    prepareForView (g, view);
 
     // Draw drop shadow
     // ----------------
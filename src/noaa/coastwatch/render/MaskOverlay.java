@@ -219,6 +219,46 @@ public abstract class MaskOverlay
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Determines if a row of navigated data locations should be masked.
+   * This is called when rendering with cached view coordinates, and
+   * may be overridden in the child class to compute mask values for
+   * many locations at once more efficiently than with repeated calls
+   * to {@link #isMasked}.  By default, each location is passed to
+   * {@link #isMasked} except where the column is the same as the
+   * previous location.
+   *
+   * @param row the navigated data row.
+   * @param cols the navigated data columns.
+   * @param count the number of columns to use from the array.
+   * @param masked the mask flags for each column (modified).
+   *
+   * @since 3.7.0
+   */
+  protected void getMaskRow (
+    int row,
+    int[] cols,
+    int count,
+    boolean[] masked
+  ) {
+
+    DataLocation loc = new DataLocation (2);
+    loc.set (Grid.ROWS, row);
+    int lastCol = Integer.MIN_VALUE;
+    boolean value = false;
+    for (int i = 0; i < count; i++) {
+      if (cols[i] != lastCol) {
+        loc.set (Grid.COLS, cols[i]);
+        value = isMasked (loc, true);
+        lastCol = cols[i];
+      } // if
+      masked[i] = value;
+    } // for
+
+  } // getMaskRow
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Determines if the data view is compatible with this overlay.
    * If so, then the precomputed view coordinate cache tables
@@ -292,23 +332,15 @@ public abstract class MaskOverlay
     // -------------------------------
     else {
       int lastGridRow = Integer.MIN_VALUE;
+      boolean[] maskedRow = new boolean[imageDims.width];
       for (int y = 0; y < imageDims.height; y++) {
 
         // Render line
         // -----------
         if (view.rowCache[y] != lastGridRow) {
-          int lastGridCol = Integer.MIN_VALUE;
-          byte byteValue = 0;
-          DataLocation loc = new DataLocation (2);
-          for (int x = 0; x < imageDims.width; x++) {
-            if (view.colCache[x] != lastGridCol) {
-              loc.set (Grid.ROWS, view.rowCache[y]);
-              loc.set (Grid.COLS, view.colCache[x]);
-              byteValue = (byte) (isMasked (loc, true) ? 1 : 0);
-              lastGridCol = view.colCache[x];
-            } // if
-            byteRow[x] = byteValue;
-          } // for
+          getMaskRow (view.rowCache[y], view.colCache, imageDims.width, maskedRow);
+          for (int x = 0; x < imageDims.width; x++)
+            byteRow[x] = (byte) (maskedRow[x] ? 1 : 0);
           lastGridRow = view.rowCache[y];
         } // if
         raster.setDataElements (0, y, imageDims.width, 1, byteRow);
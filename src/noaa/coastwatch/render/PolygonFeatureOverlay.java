@@ -106,6 +106,10 @@ public class PolygonFeatureOverlay
       throw new RuntimeException (e);
     } // catch
 
+    // Project the selected data
+    // -------------------------
+    source.project (view.getTransform());
+
   } // prepare
 
   ////////////////////////////////////////////////////////////
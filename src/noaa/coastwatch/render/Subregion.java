@@ -27,6 +27,7 @@ package noaa.coastwatch.render;
 // -------
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.EarthRegion;
 import noaa.coastwatch.util.trans.EarthTransform;
 
 /*
@@ -43,12 +44,6 @@ import noaa.coastwatch.util.trans.EarthTransform;
  */
 public class Subregion {
 
-  // Constants
-  // ---------
-
-  /** The minimum data location increment for radius probes. */
-  private static final double MIN_INC = 1e-6;
-
   // Variables
   // ---------
   
@@ -108,69 +103,6 @@ public class Subregion {
 
   ////////////////////////////////////////////////////////////
 
-  /**
-   * Finds the data location that is this region's radius away from
-   * the center in a specific direction.
-   *
-   * @param trans the earth transform to use for coordinate transforms.
-   * @param dataLoc the data location to use for probing (modified).
-   * @param earthLoc the earth location to use for probing (modified).
-   * @param direction the direction to use for each probe as a data location
-   * offset.
-   *
-   * @return true if successful, false if Double.NaN was returned from
-   * some distance calculation.
-   */
-  private boolean findDataLoc (
-    EarthTransform trans,
-    DataLocation dataLoc,
-    EarthLocation earthLoc,
-    int[] direction
-  ) {
-
-    // Initialize data probe
-    // ---------------------
-    trans.transform (centerLoc, dataLoc);
-    trans.transform (dataLoc, earthLoc);
-    double probeDist = Math.abs (centerLoc.distance (earthLoc) - radius);
-    double lastProbeDist = Double.MAX_VALUE;
-
-    // Set initial increment
-    // ---------------------
-    double[] inc = new double[] {direction[0], direction[1]};
-    double incMagnitude = Math.max (Math.abs (inc[0]), Math.abs (inc[1]));
-
-    // Loop until tolerance hit
-    // ------------------------
-    while (!Double.isNaN (probeDist) && incMagnitude > MIN_INC) {
-
-      // Increment probe location and test distance
-      // ------------------------------------------
-      dataLoc.set (0, dataLoc.get (0) + inc[0]);
-      dataLoc.set (1, dataLoc.get (1) + inc[1]);
-      trans.transform (dataLoc, earthLoc);
-      probeDist = Math.abs (centerLoc.distance (earthLoc) - radius);
-
-      // Check to decrease increment
-      // ---------------------------
-      if (probeDist >= lastProbeDist) {
-        inc[0] *= -0.5;
-        inc[1] *= -0.5;
-        incMagnitude = Math.max (Math.abs (inc[0]), Math.abs (inc[1]));
-      } // if
-      lastProbeDist = probeDist;
-
-    } // while
-
-    // Check final distance
-    // --------------------
-    if (Double.isNaN (probeDist)) return (false);
-    else return (true);
-
-  } // findDataLoc
-
-  ////////////////////////////////////////////////////////////
-
   /**
    * Gets the data location limits of this subregion relative to the
    * specified earth transform.
@@ -185,6 +117,8 @@ public class Subregion {
    * one of the coordinate transforms returned an invalid earth
    * or data location.  Usually this means that the limits are
    * past the edge of some transform discontinuity.
+   *
+   * @see EarthRegion#getLimits
    */
   public boolean getLimits (
     EarthTransform trans, 
@@ -192,33 +126,8 @@ public class Subregion {
     DataLocation end
   ) {
 
-    // Create temporary locations
-    // --------------------------
-    DataLocation dataLoc = new DataLocation (2);
-    EarthLocation earthLoc = new EarthLocation (trans.getDatum());
-
-    // Find limits
-    // -----------
-    boolean found = findDataLoc (trans, dataLoc, earthLoc, new int[] {-1, 0});
-    if (!found) return (false);
-    double minRow = dataLoc.get (0);
-    found = findDataLoc (trans, dataLoc, earthLoc, new int[] {1, 0});
-    if (!found) return (false);
-    double maxRow = dataLoc.get (0);
-    found = findDataLoc (trans, dataLoc, earthLoc, new int[] {0, -1});
-    if (!found) return (false);
-    double minCol = dataLoc.get (1);
-    found = findDataLoc (trans, dataLoc, earthLoc, new int[] {0, 1});
-    if (!found) return (false);
-    double maxCol = dataLoc.get (1);
-
-    // Set coords
-    // ----------
-    start.set (0, minRow);
-    start.set (1, minCol);
-    end.set (0, maxRow);
-    end.set (1, maxCol);
-    return (true);
+    return (EarthRegion.fromCircle (centerLoc, radius).getLimits (trans,
+      start, end));
 
   } // getLimits
 
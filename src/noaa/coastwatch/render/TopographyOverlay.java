@@ -39,16 +39,12 @@ import java.awt.Stroke;
 import java.io.IOException;
 import java.io.ObjectInputStream;
 import java.util.Arrays;
-import noaa.coastwatch.io.EarthDataReader;
-import noaa.coastwatch.io.EarthDataReaderFactory;
-import noaa.coastwatch.io.IOServices;
+import noaa.coastwatch.io.ReferenceDataRegistry;
+import noaa.coastwatch.io.ReferenceDataRegistry.ReferenceData;
 import noaa.coastwatch.render.ContourGenerator;
 import noaa.coastwatch.render.EarthDataView;
 import noaa.coastwatch.render.LineOverlay;
 import noaa.coastwatch.util.EarthArea;
-import noaa.coastwatch.util.EarthDataInfo;
-import noaa.coastwatch.util.trans.EarthTransform;
-import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.trans.MapProjection;
 
 /**
@@ -142,19 +138,19 @@ public class TopographyOverlay
   /** Gets the source for topographic contours. */
   private ContourGenerator getSource () throws IOException {
 
-    // Get reader
-    // ----------
-    String path = IOServices.getFilePath (getClass(), TOPOGRAPHY_FILE);
-    EarthDataReader reader = EarthDataReaderFactory.create (path);
-
-    // Get grid and transform
-    // ----------------------
-    Grid grid = (Grid) reader.getVariable ("elevation");
-    EarthTransform trans = reader.getInfo().getTransform();
+    // Get shared topography data
+    // --------------------------
+    /**
+     * All topography overlays share one in-memory copy of the grid, and
+     * each has its own contour generator with its own levels and area.
+     */
+    ReferenceData data = ReferenceDataRegistry.getInstance().getData (
+      TopographyOverlay.class, TOPOGRAPHY_FILE, "elevation");
 
     // Create contour generator
     // ------------------------
-    ContourGenerator generator = new ContourGenerator (grid, trans);
+    ContourGenerator generator = new ContourGenerator (data.getGrid(),
+      data.getTransform());
     generator.setLevelNudge (TOPOGRAPHY_ACCURACY/2);
     return (generator);
 
@@ -41,7 +41,11 @@ import java.io.IOException;
 import java.io.InputStream;
 import java.net.URI;
 import java.net.URL;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
 
+import noaa.coastwatch.render.feature.FeatureIndex;
 import noaa.coastwatch.render.feature.LineFeature;
 import noaa.coastwatch.render.feature.LineFeatureSource;
 import noaa.coastwatch.render.feature.PointFeature;
@@ -56,6 +60,7 @@ import noaa.coastwatch.render.PointFeatureOverlay;
 import noaa.coastwatch.render.LineFeatureOverlay;
 import noaa.coastwatch.render.PolygonFeatureOverlay;
 
+import noaa.coastwatch.util.EarthArea;
 import noaa.coastwatch.util.EarthLocation;
 
 import java.util.logging.Logger;
@@ -80,6 +85,12 @@ import java.util.logging.Logger;
  *   http://www.esri.com/library/whitepapers/pdfs/shapefile.pdf
  * </pre>
  *
+ * <p>As of version 3.7.0, line and polygon features are read once and
+ * held in a {@link FeatureIndex}, and each selection only passes on the
+ * features whose bounding boxes intersect the selected earth area, so
+ * that views of a small region of a large shapefile don't transform and
+ * draw every feature in the file.</p>
+ *
  * @author Peter Hollemans
  * @since 3.1.9
  */
@@ -191,15 +202,47 @@ public class ESRIShapefileReader {
     /** The selected flag, true if select was called. */
     private boolean selected;
 
+    /** The list of all line features in the file. */
+    private List<LineFeature> allFeatures = new ArrayList<>();
+
+    /** The spatial index of all line features. */
+    private FeatureIndex index;
+
+    /** The area used for the last selection, or null for none. */
+    private EarthArea lastArea;
+
     ////////////////////////////////////////////////////////
 
     @Override
     protected void select () throws IOException {
 
-      // Check if already selected
-      // -------------------------
-      if (selected) return;
-      selected = true;
+      // Read features and create index
+      // ------------------------------
+      if (!selected) {
+        selected = true;
+        readFeatures();
+        List<double[]> bounds = new ArrayList<>();
+        for (LineFeature line : allFeatures)
+          bounds.add (FeatureIndex.getBounds (Collections.singletonList (line)));
+        index = new FeatureIndex (bounds);
+      } // if
+
+      // Select features in area
+      // -----------------------
+      if (area.equals (lastArea)) return;
+      lastArea = area;
+      featureList.clear();
+      int[] selectedIndices = index.query (area);
+      for (int i : selectedIndices) featureList.add (allFeatures.get (i));
+      LOGGER.fine ("Selected " + selectedIndices.length + " of " +
+        allFeatures.size() + " line features");
+
+    } // select
+
+    ////////////////////////////////////////////////////////
+
+    /** Reads all line features from the file. */
+    private void readFeatures () throws IOException {
 
       try {
 
@@ -215,7 +258,7 @@ public class ESRIShapefileReader {
             PointData[] points = polyShape.getPointsOfPart (i);
             for (int j = 0; j < points.length; j++)
               line.add (new EarthLocation (points[j].getY(), points[j].getX()));
-            featureList.add (line);
+            allFeatures.add (line);
           } // for
 
         } // while
@@ -228,7 +271,7 @@ public class ESRIShapefileReader {
         inputStream.close();
       } // finally
 
-    } // select
+    } // readFeatures
 
     ////////////////////////////////////////////////////////
 
@@ -245,15 +288,50 @@ public class ESRIShapefileReader {
     /** The selected flag, true if select was called. */
     private boolean selected;
 
+    /** The list of all polygon groups in the file. */
+    private List<List<PolygonFeature>> allGroups = new ArrayList<>();
+
+    /** The spatial index of all polygon groups. */
+    private FeatureIndex index;
+
+    /** The area used for the last selection, or null for none. */
+    private EarthArea lastArea;
+
     ////////////////////////////////////////////////////////
 
     @Override
     protected void select () throws IOException {
 
-      // Check if already selected
-      // -------------------------
-      if (selected) return;
-      selected = true;
+      // Read polygons and create index
+      // ------------------------------
+      if (!selected) {
+        selected = true;
+        readPolygons();
+        List<double[]> bounds = new ArrayList<>();
+        for (List<PolygonFeature> group : allGroups)
+          bounds.add (FeatureIndex.getBounds (group));
+        index = new FeatureIndex (bounds);
+      } // if
+
+      // Select polygon groups in area
+      // -----------------------------
+      if (area.equals (lastArea)) return;
+      lastArea = area;
+      polygonList.clear();
+      int[] selectedIndices = index.query (area);
+      for (int i : selectedIndices) {
+        polygonList.addAll (allGroups.get (i));
+        polygonList.add (new PolygonFeature (PolygonFeature.COUNTER_CLOCKWISE));
+      } // for
+      LOGGER.fine ("Selected " + selectedIndices.length + " of " +
+        allGroups.size() + " polygons");
+
+    } // select
+
+    ////////////////////////////////////////////////////////
+
+    /** Reads all polygon groups from the file. */
+    private void readPolygons () throws IOException {
 
       try {
 
@@ -273,9 +351,10 @@ public class ESRIShapefileReader {
          * are referred to as its parts."
          *
          * So in this reading loop, we separate out the parts of an individual
-         * polygon into polygon features and then terminate the list of parts
-         * using a zero-length polygon.  This indicates to the rendering code
-         * that the polygon parts should be rendered together.
+         * polygon into polygon features and keep them together as a group.
+         * When selecting, each group is terminated using a zero-length
+         * polygon.  This indicates to the rendering code that the polygon
+         * parts should be rendered together.
          */
 
         // Iterate over each shape part and create polygon features
@@ -284,16 +363,17 @@ public class ESRIShapefileReader {
         while ((polyShape = (AbstractPolyShape) reader.next()) != null) {
 
           int parts = polyShape.getNumberOfParts();
+          List<PolygonFeature> group = new ArrayList<>();
 
           for (int i = 0; i < parts; i++) {
             PolygonFeature polygon = new PolygonFeature (PolygonFeature.COUNTER_CLOCKWISE);
             PointData[] points = polyShape.getPointsOfPart (i);
             for (int j = 0; j < points.length; j++)
               polygon.add (new EarthLocation (points[j].getY(), points[j].getX()));
-            polygonList.add (polygon);
+            group.add (polygon);
           } // for
 
-          polygonList.add (new PolygonFeature (PolygonFeature.COUNTER_CLOCKWISE));
+          allGroups.add (group);
 
         } // while
 
@@ -305,7 +385,7 @@ public class ESRIShapefileReader {
         inputStream.close();
       } // finally
 
-    } // select
+    } // readPolygons
 
     ////////////////////////////////////////////////////////
 
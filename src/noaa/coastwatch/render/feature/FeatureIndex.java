@@ -0,0 +1,502 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: FeatureIndex.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.render.feature;
+
+// Imports
+// -------
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import noaa.coastwatch.render.feature.LineFeature;
+import noaa.coastwatch.util.EarthArea;
+import noaa.coastwatch.util.EarthLocation;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>FeatureIndex</code> class is a static spatial index of
+ * feature bounding boxes in latitude and longitude, used to quickly find
+ * the features that intersect a geographic area.  The index is a packed
+ * R-tree: the boxes are sorted along a Hilbert curve by their centers and
+ * then grouped into fixed size nodes level by level, so that the tree is
+ * built once in O(n log n) time and stored in flat arrays.  Queries
+ * return the indices of the intersecting items in their original order,
+ * so that features selected from the index are drawn in the same order
+ * as they were added.<p>
+ *
+ * Bounding boxes are given as [south, north, west, east] with longitudes
+ * in the range [-180..180].  A feature that crosses the 180E/180W border
+ * should have a box that spans the full longitude range, which is what
+ * {@link #getBounds} computes from the feature points.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class FeatureIndex {
+
+  // Constants
+  // ---------
+
+  /** The number of children in each tree node. */
+  private static final int NODE_SIZE = 16;
+
+  /** The Hilbert curve grid size along each side. */
+  private static final int HILBERT_SIZE = 1 << 15;
+
+  /**
+   * The maximum number of grid squares to check when testing a box
+   * against an earth area.  Larger boxes are assumed to intersect.
+   */
+  private static final int MAX_SQUARES = 4096;
+
+  // Variables
+  // ---------
+
+  /** The number of items in the index. */
+  private int items;
+
+  /** The node boxes as [south, north, west, east] for each node. */
+  private double[] boxes;
+
+  /**
+   * The node indices, either the item index for leaf nodes or the
+   * position of the first child node for higher level nodes.
+   */
+  private int[] indices;
+
+  /** The node position of the end of each level, leaves first. */
+  private int[] levelEnds;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new index.
+   *
+   * @param bounds the item bounding boxes, each as [south, north, west,
+   * east], or null for an item that should never be found.
+   */
+  public FeatureIndex (
+    List<double[]> bounds
+  ) {
+
+    items = bounds.size();
+
+    // Find overall extent
+    // -------------------
+    double south = 90, north = -90, west = 180, east = -180;
+    for (double[] box : bounds) {
+      if (box == null) continue;
+      south = Math.min (south, box[0]);
+      north = Math.max (north, box[1]);
+      west = Math.min (west, box[2]);
+      east = Math.max (east, box[3]);
+    } // for
+    double latScale = (north > south ? (HILBERT_SIZE-1) / (north - south) : 0);
+    double lonScale = (east > west ? (HILBERT_SIZE-1) / (east - west) : 0);
+
+    // Sort items along Hilbert curve
+    // ------------------------------
+    /**
+     * The Hilbert values fit in 30 bits and the item indices in 31 bits,
+     * so we sort a single array of combined keys rather than boxing the
+     * indices for a comparator sort.  Items with no box are dropped.
+     */
+    long[] keys = new long[items];
+    int count = 0;
+    for (int i = 0; i < items; i++) {
+      double[] box = bounds.get (i);
+      if (box == null) continue;
+      int y = (int) (((box[0] + box[1])/2 - south) * latScale);
+      int x = (int) (((box[2] + box[3])/2 - west) * lonScale);
+      keys[count++] = (hilbert (x, y) << 31) | i;
+    } // for
+    Arrays.sort (keys, 0, count);
+
+    // Compute level sizes
+    // -------------------
+    List<Integer> ends = new ArrayList<>();
+    int nodes = count;
+    int levelSize = count;
+    ends.add (nodes);
+    while (levelSize > 1) {
+      levelSize = (levelSize + NODE_SIZE - 1) / NODE_SIZE;
+      nodes += levelSize;
+      ends.add (nodes);
+    } // while
+    levelEnds = new int[ends.size()];
+    for (int i = 0; i < levelEnds.length; i++) levelEnds[i] = ends.get (i);
+    boxes = new double[nodes*4];
+    indices = new int[nodes];
+
+    // Fill leaf nodes
+    // ---------------
+    for (int pos = 0; pos < count; pos++) {
+      int item = (int) (keys[pos] & Integer.MAX_VALUE);
+      System.arraycopy (bounds.get (item), 0, boxes, pos*4, 4);
+      indices[pos] = item;
+    } // for
+
+    // Fill higher level nodes
+    // -----------------------
+    int pos = count;
+    for (int level = 0; level < levelEnds.length-1; level++) {
+      int start = (level == 0 ? 0 : levelEnds[level-1]);
+      int end = levelEnds[level];
+      for (int child = start; child < end; child += NODE_SIZE) {
+        int childEnd = Math.min (child + NODE_SIZE, end);
+        double nodeSouth = 90, nodeNorth = -90, nodeWest = 180, nodeEast = -180;
+        for (int i = child; i < childEnd; i++) {
+          nodeSouth = Math.min (nodeSouth, boxes[i*4]);
+          nodeNorth = Math.max (nodeNorth, boxes[i*4+1]);
+          nodeWest = Math.min (nodeWest, boxes[i*4+2]);
+          nodeEast = Math.max (nodeEast, boxes[i*4+3]);
+        } // for
+        boxes[pos*4] = nodeSouth;
+        boxes[pos*4+1] = nodeNorth;
+        boxes[pos*4+2] = nodeWest;
+        boxes[pos*4+3] = nodeEast;
+        indices[pos] = child;
+        pos++;
+      } // for
+    } // for
+
+  } // FeatureIndex constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the position of a grid point along a Hilbert curve that
+   * fills the grid.
+   */
+  private static long hilbert (
+    int x,
+    int y
+  ) {
+
+    long d = 0;
+    for (int s = HILBERT_SIZE/2; s > 0; s /= 2) {
+      int rx = ((x & s) > 0 ? 1 : 0);
+      int ry = ((y & s) > 0 ? 1 : 0);
+      d += (long) s * s * ((3 * rx) ^ ry);
+      if (ry == 0) {
+        if (rx == 1) {
+          x = HILBERT_SIZE-1 - x;
+          y = HILBERT_SIZE-1 - y;
+        } // if
+        int t = x; x = y; y = t;
+      } // if
+    } // for
+
+    return (d);
+
+  } // hilbert
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of items in the index. */
+  public int size () { return (items); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the bounding box of a group of features.
+   *
+   * @param features the features to bound.
+   *
+   * @return the bounding box as [south, north, west, east], or null if
+   * the features have no valid points.  If the features cross the
+   * 180E/180W border, the box spans the full longitude range.
+   */
+  public static double[] getBounds (
+    List<? extends LineFeature> features
+  ) {
+
+    double south = 90, north = -90, west = 180, east = -180;
+    boolean isValid = false;
+    boolean isCrossing = false;
+    for (LineFeature feature : features) {
+      EarthLocation last = null;
+      for (int i = 0; i < feature.size(); i++) {
+        EarthLocation loc = feature.get (i);
+        if (!loc.isValid()) continue;
+        south = Math.min (south, loc.lat);
+        north = Math.max (north, loc.lat);
+        west = Math.min (west, loc.lon);
+        east = Math.max (east, loc.lon);
+        if (last != null && Math.abs (loc.lon - last.lon) > 180) isCrossing = true;
+        last = loc;
+        isValid = true;
+      } // for
+    } // for
+    if (!isValid) return (null);
+    if (isCrossing) { west = -180; east = 180; }
+
+    return (new double[] {south, north, west, east});
+
+  } // getBounds
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finds the items whose bounding boxes intersect a box.
+   *
+   * @param south the southern edge of the box.
+   * @param north the northern edge of the box.
+   * @param west the western edge of the box.
+   * @param east the eastern edge of the box.
+   *
+   * @return the intersecting item indices in ascending order.
+   */
+  public int[] query (
+    double south,
+    double north,
+    double west,
+    double east
+  ) {
+
+    return (query (new double[][] {{south, north, west, east}}, null));
+
+  } // query
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finds the items whose bounding boxes intersect an earth area.  The
+   * index is first searched using the extremes of the area, split in
+   * two if the area crosses the 180E/180W border.  Each item found is
+   * then checked against the area grid squares that its box overlaps,
+   * so that items outside an irregularly shaped area are not returned.
+   *
+   * @param area the earth area to search.
+   *
+   * @return the intersecting item indices in ascending order.
+   */
+  public int[] query (
+    EarthArea area
+  ) {
+
+    if (area.isEmpty()) return (new int[0]);
+    int[] extremes = area.getExtremes();
+    double[][] searchBoxes;
+    if (extremes[2] > 180) {
+      searchBoxes = new double[][] {
+        {extremes[1], extremes[0], extremes[3], 180},
+        {extremes[1], extremes[0], -180, extremes[2] - 360}
+      };
+    } // if
+    else {
+      searchBoxes = new double[][] {
+        {extremes[1], extremes[0], extremes[3], extremes[2]}
+      };
+    } // else
+
+    return (query (searchBoxes, area));
+
+  } // query
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finds the items whose bounding boxes intersect any of a set of
+   * boxes and optionally an earth area.
+   */
+  private int[] query (
+    double[][] searchBoxes,
+    EarthArea area
+  ) {
+
+    if (items == 0 || levelEnds[0] == 0) return (new int[0]);
+
+    // Search tree from root
+    // ---------------------
+    /**
+     * The stack holds node positions to visit.  Positions below the
+     * first level end are leaves, and other nodes hold the position of
+     * their first child, with the children of a node ending at the next
+     * node's first child or the end of the child level.
+     */
+    boolean[] found = new boolean[items];
+    int[] stack = new int[NODE_SIZE * levelEnds.length + 1];
+    int top = 0;
+    stack[top++] = boxes.length/4 - 1;
+    while (top > 0) {
+      int node = stack[--top];
+      if (!intersects (node, searchBoxes)) continue;
+      if (node < levelEnds[0]) {
+        int item = indices[node];
+        if (area == null || intersects (node, area)) found[item] = true;
+      } // if
+      else {
+        int level = 1;
+        while (node >= levelEnds[level]) level++;
+        int childEnd = (node+1 < levelEnds[level] ? indices[node+1] : levelEnds[level-1]);
+        for (int child = indices[node]; child < childEnd; child++)
+          stack[top++] = child;
+      } // else
+    } // while
+
+    // Collect results in order
+    // ------------------------
+    int count = 0;
+    for (int i = 0; i < items; i++) if (found[i]) count++;
+    int[] result = new int[count];
+    count = 0;
+    for (int i = 0; i < items; i++) if (found[i]) result[count++] = i;
+
+    return (result);
+
+  } // query
+
+  ////////////////////////////////////////////////////////////
+
+  /** Determines if a node box intersects any of a set of boxes. */
+  private boolean intersects (
+    int node,
+    double[][] searchBoxes
+  ) {
+
+    int pos = node*4;
+    for (double[] box : searchBoxes) {
+      if (boxes[pos] <= box[1] && boxes[pos+1] >= box[0] &&
+        boxes[pos+2] <= box[3] && boxes[pos+3] >= box[2]) return (true);
+    } // for
+
+    return (false);
+
+  } // intersects
+
+  ////////////////////////////////////////////////////////////
+
+  /** Determines if a node box overlaps any grid square in an area. */
+  private boolean intersects (
+    int node,
+    EarthArea area
+  ) {
+
+    int pos = node*4;
+    int south = Math.max (-90, (int) Math.floor (boxes[pos]));
+    int north = Math.min (89, (int) Math.floor (boxes[pos+1]));
+    int west = Math.max (-180, (int) Math.floor (boxes[pos+2]));
+    int east = Math.min (179, (int) Math.floor (boxes[pos+3]));
+    if ((long) (north - south + 1) * (east - west + 1) > MAX_SQUARES) return (true);
+
+    int[] square = new int[2];
+    for (square[0] = south; square[0] <= north; square[0]++) {
+      for (square[1] = west; square[1] <= east; square[1]++) {
+        if (area.contains (square)) return (true);
+      } // for
+    } // for
+
+    return (false);
+
+  } // intersects
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (FeatureIndex.class);
+
+    // ------------------------->
+
+    logger.test ("query against brute force");
+
+    java.util.Random random = new java.util.Random (1234);
+    List<double[]> bounds = new ArrayList<>();
+    for (int i = 0; i < 5000; i++) {
+      if (i % 100 == 0) { bounds.add (null); continue; }
+      double lat = random.nextDouble()*170 - 85;
+      double lon = random.nextDouble()*350 - 180;
+      double size = random.nextDouble()*5;
+      bounds.add (new double[] {lat, lat + size, lon, lon + size});
+    } // for
+    FeatureIndex index = new FeatureIndex (bounds);
+    assert (index.size() == 5000);
+
+    for (int test = 0; test < 50; test++) {
+      double lat = random.nextDouble()*160 - 80;
+      double lon = random.nextDouble()*340 - 180;
+      double size = random.nextDouble()*20;
+      double[] box = new double[] {lat, lat + size, lon, lon + size};
+      int[] result = index.query (box[0], box[1], box[2], box[3]);
+      List<Integer> expected = new ArrayList<>();
+      for (int i = 0; i < bounds.size(); i++) {
+        double[] b = bounds.get (i);
+        if (b != null && b[0] <= box[1] && b[1] >= box[0] && b[2] <= box[3] && b[3] >= box[2])
+          expected.add (i);
+      } // for
+      assert (result.length == expected.size());
+      for (int i = 0; i < result.length; i++) assert (result[i] == expected.get (i));
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("query with earth area");
+
+    bounds.clear();
+    bounds.add (new double[] {10.2, 10.8, 20.2, 20.8});
+    bounds.add (new double[] {10.2, 10.8, 25.2, 25.8});
+    bounds.add (new double[] {-5, 5, 178, 180});
+    bounds.add (new double[] {-5, 5, -180, -178});
+    index = new FeatureIndex (bounds);
+
+    EarthArea area = new EarthArea();
+    area.add (new EarthLocation (10.5, 20.5));
+    area.add (new EarthLocation (10.5, 30.5));
+    int[] result = index.query (area);
+    assert (result.length == 1 && result[0] == 0);
+
+    area = new EarthArea();
+    area.add (new EarthLocation (0.5, 179.5));
+    area.add (new EarthLocation (0.5, -179.5));
+    result = index.query (area);
+    assert (result.length == 2 && result[0] == 2 && result[1] == 3);
+
+    LineFeature line = new LineFeature();
+    line.add (new EarthLocation (0, 179));
+    line.add (new EarthLocation (1, -179));
+    double[] lineBounds = getBounds (java.util.Collections.singletonList (line));
+    assert (lineBounds[2] == -180 && lineBounds[3] == 180);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // FeatureIndex class
+
+////////////////////////////////////////////////////////////////////////
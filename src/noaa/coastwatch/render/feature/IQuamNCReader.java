@@ -29,7 +29,6 @@ import java.io.IOException;
 import java.util.List;
 import java.util.Map;
 import java.util.LinkedHashMap;
-import java.util.HashMap;
 import java.util.Date;
 import java.util.Calendar;
 import java.util.TimeZone;
@@ -166,8 +165,14 @@ public class IQuamNCReader
   /** The reference time in milliseconds to compute proper date values. */
   private long refTime;
 
-  /** The mapping of earth area square index to list of point features. */
-  private Map<Integer, List<Feature>> squareToFeaturesMap;
+  /** The array of all point features, or null if not precached. */
+  private Feature[] featureCache;
+
+  /** The space-time index of observations. */
+  private ObservationIndex index;
+
+  /** The time window for selecting observations, or null for all times. */
+  private TimeWindow timeWindow;
   
   /** The latitude variable index. */
   private int latIndex;
@@ -375,6 +380,14 @@ public class IQuamNCReader
     cal.set (1981, 0, 1, 0, 0, 0);      // 1980-01-01 00:00:00
     refTime = cal.getTimeInMillis();
 
+    // Create observation index
+    // ------------------------
+    int[] timeData = (int[]) chunkData[timeIndex];
+    long[] times = new long[pointCount];
+    for (int i = 0; i < pointCount; i++)
+      times[i] = refTime + (timeData[i] & 0xffffffffL)*1000L;
+    index = new ObservationIndex (latData, lonData, times);
+
   } // IQuamNCReader construtor
   
   ////////////////////////////////////////////////////////
@@ -618,80 +631,91 @@ public class IQuamNCReader
    ////////////////////////////////////////////////////////
 
   /**
-   * Performs a precaching read of all the point data in the file.  This will
-   * have the effect of speeding up subsequent select operations significantly,
-   * as the point data will be returned from memory and not read on-demand.
-   * This operation may take some time to complete.
+   * Creates the point features for all observations in the file ahead of
+   * time, so that subsequent select operations reuse the same features
+   * rather than creating new ones.  Selections themselves use the
+   * observation index created when the file is opened, whether or not
+   * the features are precached.
    */
   public void precache () throws IOException {
   
-    // Select entire file
-    // ------------------
-    EarthArea area = new EarthArea();
-    area.addAll();
-    select (area);
-    
-    // Add features to cache
-    // ---------------------
-    squareToFeaturesMap = new HashMap<Integer, List<Feature>>();
-    for (Feature feature : featureList) {
-      EarthLocation location = ((PointFeature) feature).getPoint();
-      int index = area.getIndex (location);
-      List<Feature> squareFeatureList = squareToFeaturesMap.get (index);
-      if (squareFeatureList == null) {
-        squareFeatureList = new ArrayList<Feature>();
-        squareToFeaturesMap.put (index, squareFeatureList);
-      } // if
-      squareFeatureList.add (feature);
-    } // for
-
-    // Clear feature list
-    // ------------------
-    featureList.clear();
+    featureCache = new Feature[pointCount];
+    for (int i = 0; i < pointCount; i++)
+      featureCache[i] = new Observation (i);
 
   } // precache
 
   ////////////////////////////////////////////////////////
 
+  /**
+   * Sets the time window for selecting observations.  Subsequent calls
+   * to {@link #select} only select observations whose time falls within
+   * the window.
+   *
+   * @param window the time window or null to select observations at all
+   * times.  By default observations are selected at all times.
+   *
+   * @since 3.7.0
+   */
+  public void setTimeWindow (TimeWindow window) { this.timeWindow = window; }
+
+  ////////////////////////////////////////////////////////
+
+  /**
+   * Gets the time window for selecting observations.
+   *
+   * @return the time window or null for all times.
+   *
+   * @since 3.7.0
+   */
+  public TimeWindow getTimeWindow () { return (timeWindow); }
+
+  ////////////////////////////////////////////////////////
+
+  /**
+   * Gets the indices of the observations in an area and time window,
+   * without creating features for them.
+   *
+   * @param area the earth area for the observations.
+   * @param window the time window for the observations, or null for all
+   * times.
+   *
+   * @return the observation indices in ascending order, in the same order
+   * as the observations in the file.
+   *
+   * @since 3.7.0
+   */
+  public int[] getObservations (
+    EarthArea area,
+    TimeWindow window
+  ) {
+
+    int[] indices;
+    if (window == null) indices = index.query (area);
+    else {
+      long center = window.getCentralDate().getTime();
+      long size = window.getWindowSize();
+      indices = index.query (area, center - size, center + size);
+    } // else
+
+    return (indices);
+
+  } // getObservations
+
+  ////////////////////////////////////////////////////////
+
   @Override
   protected void select () throws IOException {
     
     // Initialize feature list
     // -----------------------
     featureList.clear();
-    
-    // Use data cache if available
-    // ---------------------------
-    if (squareToFeaturesMap != null) {
-      for (int[] square : area) {
-        int index = area.getIndex (square[0], square[1]);
-        List<Feature> squareFeatureList = squareToFeaturesMap.get (index);
-        if (squareFeatureList != null)
-          featureList.addAll (squareFeatureList);
-      } // for
-    } // if
 
-    // Read features from the file
+    // Add features from the index
     // ---------------------------
-    else {
-      
-      // Loop over each point in the file
-      // --------------------------------
-      EarthLocation earthLoc = new EarthLocation();
-      int datasetCount = datasetNameList.size();
-      int lastPercentComplete = -1;
-      for (int i = 0; i < pointCount; i++) {
-
-        // Check containment
-        // -----------------
-        earthLoc.setCoords (latData[i], lonData[i]);
-        if (area.contains (earthLoc)) {
-          featureList.add (new Observation (i));
-        } // if
-
-      } // for
-
-    } // else
+    int[] indices = getObservations (area, timeWindow);
+    for (int i : indices)
+      featureList.add (featureCache != null ? featureCache[i] : new Observation (i));
     
   } // select
 
@@ -26,7 +26,9 @@ package noaa.coastwatch.render.feature;
 // Imports
 // -------
 import java.awt.Graphics2D;
+import java.awt.geom.AffineTransform;
 import java.awt.geom.GeneralPath;
+import java.awt.geom.Point2D;
 import java.util.ArrayList;
 import java.util.List;
 
@@ -232,7 +234,10 @@ public class LineFeature
 
   /** 
    * Gets the general path for this feature under the specified
-   * transform.
+   * transform.  The path from the last call is reused if the transform
+   * is the same, or translated if the transform only differs from the
+   * last one by an image offset (see
+   * {@link EarthImageTransform#getOffset}).
    *
    * @param trans the earth image transform for converting Earth
    * locations to image points.
@@ -243,22 +248,70 @@ public class LineFeature
     EarthImageTransform trans
   ) {  
 
-    // Create path
-    // -----------
-    GeneralPath path;
-    if (lastPath == null || lastTrans != trans) {
-      path = transform (trans);
-      lastPath = path;
-      lastTrans = trans;
-    } // if
+    if (!hasPath (trans) && !translatePath (trans)) updatePath (trans, trans);
+    return (lastPath);
 
-    // Get saved path
-    // --------------
-    else path = lastPath;
+  } // getPath
 
-    return (path);
+  ////////////////////////////////////////////////////////////
 
-  } // getPath
+  /** 
+   * Determines if the saved path for this feature was created using
+   * the specified transform.
+   */
+  boolean hasPath (
+    EarthImageTransform trans
+  ) {
+
+    return (lastPath != null && lastTrans == trans);
+
+  } // hasPath
+
+  ////////////////////////////////////////////////////////////
+
+  /** 
+   * Translates the saved path to a new transform if the transform only
+   * differs from the last one by an image offset.
+   *
+   * @return true if the saved path was translated, or false if the
+   * feature needs to be transformed.
+   */
+  boolean translatePath (
+    EarthImageTransform trans
+  ) {
+
+    if (lastPath == null) return (false);
+    Point2D offset = trans.getOffset (lastTrans);
+    if (offset == null) return (false);
+
+    GeneralPath path = (GeneralPath) lastPath.clone();
+    path.transform (AffineTransform.getTranslateInstance (offset.getX(), offset.getY()));
+    lastPath = path;
+    lastTrans = trans;
+
+    return (true);
+
+  } // translatePath
+
+  ////////////////////////////////////////////////////////////
+
+  /** 
+   * Transforms this feature and saves the path.
+   *
+   * @param trans the transform to save the path for.
+   * @param workTrans the transform to use for the conversion, either
+   * the same as the saved transform or an equivalent copy to be used by
+   * the calling thread.
+   */
+  void updatePath (
+    EarthImageTransform trans,
+    EarthImageTransform workTrans
+  ) {
+
+    lastPath = transform (workTrans);
+    lastTrans = trans;
+
+  } // updatePath
 
   ////////////////////////////////////////////////////////////
 
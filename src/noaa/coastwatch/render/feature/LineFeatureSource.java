@@ -26,10 +26,17 @@ package noaa.coastwatch.render.feature;
 // Imports
 // -------
 import java.awt.Graphics2D;
+import java.util.ArrayList;
 import java.util.Iterator;
+import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import noaa.coastwatch.render.feature.AbstractFeatureSource;
 import noaa.coastwatch.render.EarthImageTransform;
 import noaa.coastwatch.render.feature.LineFeature;
+import noaa.coastwatch.util.trans.EarthTransform;
 
 import java.util.logging.Logger;
 
@@ -48,6 +55,140 @@ public abstract class LineFeatureSource
 
   private static final Logger LOGGER = Logger.getLogger (LineFeatureSource.class.getName());
 
+  // Constants
+  // ---------
+
+  /** The number of feature points above which projection is parallel. */
+  private static final int PARALLEL_POINTS = 16384;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Projects the selected line features to image paths ahead of
+   * rendering, so that a later call to {@link #render} with the same
+   * transform only needs to draw the paths.
+   *
+   * @param trans the earth image transform for converting Earth
+   * locations to image points.
+   *
+   * @since 3.7.0
+   */
+  public void project (
+    EarthImageTransform trans
+  ) {
+
+    List<LineFeature> lineList = new ArrayList<>();
+    for (Iterator iter = iterator(); iter.hasNext(); )
+      lineList.add ((LineFeature) iter.next());
+    projectFeatures (lineList, trans);
+
+  } // project
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Projects a list of line features to image paths.  Features whose
+   * saved path is for the same transform are left as is, and features
+   * whose saved path only needs an image offset are translated.  The
+   * remaining features are transformed, in parallel if there are enough
+   * points to make it worthwhile.
+   *
+   * @param features the features to project.
+   * @param trans the earth image transform for converting Earth
+   * locations to image points.
+   */
+  protected static void projectFeatures (
+    List<? extends LineFeature> features,
+    EarthImageTransform trans
+  ) {
+
+    // Find features to transform
+    // --------------------------
+    List<LineFeature> transformList = new ArrayList<>();
+    int points = 0;
+    int translated = 0;
+    for (LineFeature feature : features) {
+      if (feature.hasPath (trans)) continue;
+      if (feature.translatePath (trans)) { translated++; continue; }
+      transformList.add (feature);
+      points += feature.size();
+    } // for
+    if (translated != 0) LOGGER.fine ("Translated " + translated + " feature paths");
+    if (transformList.isEmpty()) return;
+
+    // Transform serially
+    // ------------------
+    /**
+     * Even when transforming serially we use a copy of the earth
+     * transform, since overlays may be prepared in parallel with each
+     * other using the same view transform.
+     */
+    int processors = Runtime.getRuntime().availableProcessors();
+    if (points < PARALLEL_POINTS || processors == 1) {
+      EarthImageTransform workTrans = new EarthImageTransform (
+        (EarthTransform) trans.getEarthTransform().clone(),
+        trans.getImageTransform());
+      for (LineFeature feature : transformList) feature.updatePath (trans, workTrans);
+      return;
+    } // if
+
+    // Transform in parallel
+    // ---------------------
+    /**
+     * Each task works on a contiguous chunk of features with about the
+     * same number of points, and uses its own copy of the earth
+     * transform so that transforms that keep intermediate values between
+     * calls are not shared between threads.  The image transform is
+     * only read, so it's safe to share.
+     */
+    int chunks = Math.min (processors*4, transformList.size());
+    int chunkPoints = (points + chunks - 1) / chunks;
+    List<List<LineFeature>> chunkList = new ArrayList<>();
+    List<LineFeature> chunk = new ArrayList<>();
+    int count = 0;
+    for (LineFeature feature : transformList) {
+      chunk.add (feature);
+      count += feature.size();
+      if (count >= chunkPoints) {
+        chunkList.add (chunk);
+        chunk = new ArrayList<>();
+        count = 0;
+      } // if
+    } // for
+    if (!chunk.isEmpty()) chunkList.add (chunk);
+
+    ExecutorService executor = Executors.newFixedThreadPool (Math.min (processors, chunkList.size()));
+    try {
+      List<Future<Void>> futures = new ArrayList<>();
+      for (List<LineFeature> taskChunk : chunkList) {
+        futures.add (executor.submit (() -> {
+          EarthImageTransform workTrans = new EarthImageTransform (
+            (EarthTransform) trans.getEarthTransform().clone(),
+            trans.getImageTransform());
+          for (LineFeature feature : taskChunk) feature.updatePath (trans, workTrans);
+          return (null);
+        }));
+      } // for
+      for (Future<Void> future : futures) future.get();
+    } // try
+    catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+      throw new RuntimeException (e);
+    } // catch
+    catch (ExecutionException e) {
+      Throwable cause = e.getCause();
+      if (cause instanceof RuntimeException) throw (RuntimeException) cause;
+      throw new RuntimeException (cause);
+    } // catch
+    finally {
+      executor.shutdownNow();
+    } // finally
+
+    LOGGER.fine ("Transformed " + transformList.size() + " feature paths in " +
+      chunkList.size() + " parallel chunks");
+
+  } // projectFeatures
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -0,0 +1,348 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: ObservationIndex.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.render.feature;
+
+// Imports
+// -------
+import java.util.Arrays;
+import noaa.coastwatch.util.EarthArea;
+import noaa.coastwatch.util.EarthLocation;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>ObservationIndex</code> class is a space-time index of point
+ * observations, used to find the observations in an earth area and time
+ * range without checking every observation.  Observations are grouped by
+ * the 1x1 degree {@link EarthArea} grid square that contains them, and
+ * sorted by time within each square.  A query visits only the squares in
+ * the area, and uses a binary search in each square to find the range of
+ * observations in the time range.  The index is held in primitive
+ * arrays, and uses about 12 bytes per observation.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class ObservationIndex {
+
+  // Constants
+  // ---------
+
+  /** The number of grid squares. */
+  private static final int SQUARES = 180*360;
+
+  // Variables
+  // ---------
+
+  /**
+   * The start position of each grid square in the sorted arrays, with
+   * the end of the last square at the end.
+   */
+  private int[] squareStart;
+
+  /** The observation indices sorted by grid square and time. */
+  private int[] order;
+
+  /** The observation times sorted by grid square and time. */
+  private long[] times;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new index.  Observations with an invalid location are not
+   * indexed.
+   *
+   * @param lat the observation latitudes.
+   * @param lon the observation longitudes.
+   * @param time the observation times in any units, or null to index
+   * by location only.
+   */
+  public ObservationIndex (
+    float[] lat,
+    float[] lon,
+    long[] time
+  ) {
+
+    // Count observations in each square
+    // ---------------------------------
+    /**
+     * We sort by square using a counting sort, which is linear in the
+     * number of observations, and then sort each square by time.
+     */
+    int count = lat.length;
+    EarthArea area = new EarthArea();
+    EarthLocation loc = new EarthLocation();
+    int[] squares = new int[count];
+    squareStart = new int[SQUARES+1];
+    for (int i = 0; i < count; i++) {
+      loc.setCoords (lat[i], lon[i]);
+      squares[i] = (loc.isValid() ? area.getIndex (loc) : -1);
+      if (squares[i] != -1) squareStart[squares[i]+1]++;
+    } // for
+    for (int square = 0; square < SQUARES; square++)
+      squareStart[square+1] += squareStart[square];
+
+    // Sort observations by square
+    // ---------------------------
+    int indexed = squareStart[SQUARES];
+    order = new int[indexed];
+    times = new long[indexed];
+    int[] next = Arrays.copyOf (squareStart, SQUARES);
+    for (int i = 0; i < count; i++) {
+      if (squares[i] == -1) continue;
+      int pos = next[squares[i]]++;
+      order[pos] = i;
+      times[pos] = (time == null ? 0 : time[i]);
+    } // for
+
+    // Sort each square by time
+    // ------------------------
+    if (time != null) {
+      for (int square = 0; square < SQUARES; square++) {
+        int start = squareStart[square];
+        int end = squareStart[square+1];
+        if (end - start > 1) sortByTime (start, end);
+      } // for
+    } // if
+
+  } // ObservationIndex constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sorts a range of the sorted arrays by time, keeping observations with
+   * the same time in index order.
+   */
+  private void sortByTime (
+    int start,
+    int end
+  ) {
+
+    // Check if already sorted
+    // -----------------------
+    boolean isSorted = true;
+    for (int pos = start+1; pos < end && isSorted; pos++)
+      isSorted = (times[pos-1] <= times[pos]);
+    if (isSorted) return;
+
+    // Sort positions by time
+    // ----------------------
+    int length = end - start;
+    Integer[] positions = new Integer[length];
+    for (int i = 0; i < length; i++) positions[i] = start + i;
+    Arrays.sort (positions, (a, b) -> {
+      int result = Long.compare (times[a], times[b]);
+      if (result == 0) result = Integer.compare (order[a], order[b]);
+      return (result);
+    });
+    int[] sortedOrder = new int[length];
+    long[] sortedTimes = new long[length];
+    for (int i = 0; i < length; i++) {
+      sortedOrder[i] = order[positions[i]];
+      sortedTimes[i] = times[positions[i]];
+    } // for
+    System.arraycopy (sortedOrder, 0, order, start, length);
+    System.arraycopy (sortedTimes, 0, times, start, length);
+
+  } // sortByTime
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of observations in the index. */
+  public int size () { return (order.length); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finds the observations in an earth area.
+   *
+   * @param area the area to search.
+   *
+   * @return the observation indices in ascending order.
+   */
+  public int[] query (
+    EarthArea area
+  ) {
+
+    return (query (area, Long.MIN_VALUE, Long.MAX_VALUE));
+
+  } // query
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finds the observations in an earth area and time range.
+   *
+   * @param area the area to search.
+   * @param minTime the minimum time, inclusive.
+   * @param maxTime the maximum time, inclusive.
+   *
+   * @return the observation indices in ascending order.
+   */
+  public int[] query (
+    EarthArea area,
+    long minTime,
+    long maxTime
+  ) {
+
+    // Find ranges in each square
+    // --------------------------
+    int count = 0;
+    int[] ranges = new int[16];
+    int rangeCount = 0;
+    for (int[] square : area) {
+      int index = area.getIndex (square[0], square[1]);
+      int start = squareStart[index];
+      int end = squareStart[index+1];
+      if (start == end) continue;
+      int first = search (start, end, minTime, false);
+      int last = search (start, end, maxTime, true);
+      if (first >= last) continue;
+      if (rangeCount*2 == ranges.length) ranges = Arrays.copyOf (ranges, ranges.length*2);
+      ranges[rangeCount*2] = first;
+      ranges[rangeCount*2+1] = last;
+      rangeCount++;
+      count += last - first;
+    } // for
+
+    // Collect observations
+    // --------------------
+    int[] result = new int[count];
+    int pos = 0;
+    for (int i = 0; i < rangeCount; i++) {
+      int length = ranges[i*2+1] - ranges[i*2];
+      System.arraycopy (order, ranges[i*2], result, pos, length);
+      pos += length;
+    } // for
+    Arrays.sort (result);
+
+    return (result);
+
+  } // query
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Searches a square range for a time.
+   *
+   * @param start the start position of the range.
+   * @param end the end position of the range.
+   * @param time the time to search for.
+   * @param isAfter the after flag, true to find the first position with
+   * a time greater than the search time, or false to find the first
+   * position with a time greater than or equal to the search time.
+   *
+   * @return the position found, or the end of the range if none.
+   */
+  private int search (
+    int start,
+    int end,
+    long time,
+    boolean isAfter
+  ) {
+
+    int low = start, high = end;
+    while (low < high) {
+      int mid = (low + high) >>> 1;
+      boolean isBefore = (isAfter ? times[mid] <= time : times[mid] < time);
+      if (isBefore) low = mid + 1;
+      else high = mid;
+    } // while
+
+    return (low);
+
+  } // search
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (ObservationIndex.class);
+
+    // ------------------------->
+
+    logger.test ("query against brute force");
+
+    java.util.Random random = new java.util.Random (5678);
+    int count = 20000;
+    float[] lat = new float[count];
+    float[] lon = new float[count];
+    long[] time = new long[count];
+    for (int i = 0; i < count; i++) {
+      lat[i] = (float) (random.nextDouble()*40 + 10);
+      lon[i] = (float) (random.nextDouble()*40 - 140);
+      time[i] = random.nextInt (86400);
+    } // for
+    lat[0] = Float.NaN;
+    ObservationIndex index = new ObservationIndex (lat, lon, time);
+    assert (index.size() == count-1);
+
+    for (int test = 0; test < 20; test++) {
+      EarthArea area = new EarthArea();
+      area.add (new EarthLocation (random.nextDouble()*40 + 10, random.nextDouble()*40 - 140));
+      int expansions = random.nextInt (4);
+      for (int i = 0; i < expansions; i++) area.expand();
+      long minTime = random.nextInt (86400);
+      long maxTime = minTime + random.nextInt (7200);
+
+      int[] result = index.query (area, minTime, maxTime);
+      EarthLocation loc = new EarthLocation();
+      int expected = 0;
+      for (int i = 0; i < count; i++) {
+        loc.setCoords (lat[i], lon[i]);
+        if (area.contains (loc) && time[i] >= minTime && time[i] <= maxTime) {
+          assert (Arrays.binarySearch (result, i) >= 0);
+          expected++;
+        } // if
+      } // for
+      assert (result.length == expected);
+      for (int i = 1; i < result.length; i++) assert (result[i-1] < result[i]);
+
+      int areaCount = 0;
+      for (int i = 0; i < count; i++) {
+        loc.setCoords (lat[i], lon[i]);
+        if (area.contains (loc)) areaCount++;
+      } // for
+      assert (index.query (area).length == areaCount);
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // ObservationIndex class
+
+////////////////////////////////////////////////////////////////////////
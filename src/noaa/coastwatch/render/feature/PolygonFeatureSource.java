@@ -69,6 +69,29 @@ public abstract class PolygonFeatureSource
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Projects the selected line and polygon features to image paths
+   * ahead of rendering, so that later calls to {@link #render},
+   * {@link #renderPolygons}, or {@link #renderOutlines} with the same
+   * transform only need to draw the paths.
+   *
+   * @param trans the earth image transform for converting Earth
+   * locations to image points.
+   *
+   * @since 3.7.0
+   */
+  @Override
+  public void project (
+    EarthImageTransform trans
+  ) {
+
+    super.project (trans);
+    projectFeatures (polygonList, trans);
+
+  } // project
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Renders the selected polygon data to a graphics context.
    * This method differs from the {@link LineFeatureSource#render}
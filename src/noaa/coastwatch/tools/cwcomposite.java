@@ -58,6 +58,7 @@ import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.PrecisionTrimmer;
 import noaa.coastwatch.util.trans.EarthTransform;
 import noaa.coastwatch.util.ArrayReduction;
 import noaa.coastwatch.util.MinReduction;
@@ -113,6 +114,8 @@ import java.util.logging.Level;
  * -M, --method=TYPE <br>
  * -p, --pedantic <br>
  * --serial <br>
+ * --sigdigits=DIGITS <br>
+ * --stats <br>
  * -t, --collapsetime <br>
  * -v, --verbose <br>
  * -V, --valid=COUNT <br>
@@ -233,6 +236,26 @@ import java.util.logging.Level;
  *   <dd>Turns on serial processing mode.  By default the program will
  *   use multiple processors in parallel to process chunks of data.</dd>
  *
+ *   <dt>--sigdigits=DIGITS</dt>
+ *
+ *   <dd>Specifies the number of significant decimal digits to keep for
+ *   floating-point output variables, in the range [1..15].  The trailing
+ *   mantissa bits of each value beyond the requested precision are
+ *   rounded off before the data is compressed, which can greatly reduce
+ *   the output file size.  The precision kept is recorded in the
+ *   'quantization_nsb' variable attribute.  Integer variables are not
+ *   affected.  By default floating-point data is written at full
+ *   precision.</dd>
+ *
+ *   <dt>--stats</dt>
+ *
+ *   <dd>Turns on computation of output variable statistics while the
+ *   data is written.  The minimum, maximum, mean, standard deviation,
+ *   median, percentiles, and a histogram over all data values are
+ *   stored in 'stats_*' variable attributes, so that later statistics
+ *   and enhancement calculations on the output variables don't need to
+ *   read the data.  By default no statistics are stored.</dd>
+ *
  *   <dt>-t, --collapsetime</dt>
  *
  *   <dd>Specifies that the time metadata in the output file
@@ -351,6 +374,8 @@ public final class cwcomposite {
     Option inputsOpt = cmd.addStringOption ('i', "inputs");
     Option coherentOpt = cmd.addStringOption ('c', "coherent");
     Option serialOpt = cmd.addBooleanOption ("serial");
+    Option sigdigitsOpt = cmd.addIntegerOption ("sigdigits");
+    Option statsOpt = cmd.addBooleanOption ("stats");
     Option versionOpt = cmd.addBooleanOption ("version");
     try { cmd.parse (argv); }
     catch (OptionException e) {
@@ -401,6 +426,13 @@ public final class cwcomposite {
     String coherentOutput = (String) cmd.getOptionValue (coherentOpt);
     boolean serialOperations = (cmd.getOptionValue (serialOpt) != null);
     boolean collapseTime = (cmd.getOptionValue (collapsetimeOpt) != null);
+    Integer sigdigits = (Integer) cmd.getOptionValue (sigdigitsOpt);
+    if (sigdigits != null && (sigdigits < 1 || sigdigits > 15)) {
+      LOGGER.severe ("Invalid significant digits " + sigdigits);
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+    boolean stats = (cmd.getOptionValue (statsOpt) != null);
 
     // Check for coherent mode
     // -----------------------
@@ -533,6 +565,9 @@ public final class cwcomposite {
       if (collapseTime) outputInfo.collapseTimePeriods();
       CleanupHook.getInstance().scheduleDelete (output);
       CWHDFWriter writer = new CWHDFWriter (outputInfo, output);
+      if (sigdigits != null)
+        writer.setSignificantBits (null, PrecisionTrimmer.getBitsForDigits (sigdigits));
+      writer.setStatistics (stats);
 
       // Create chunk function
       // ---------------------
@@ -700,6 +735,8 @@ public final class cwcomposite {
     info.option ("-M, --method=TYPE", "Set composite type");
     info.option ("-p, --pedantic", "Retain repeated metadata values");
     info.option ("--serial", "Perform serial operations");
+    info.option ("--sigdigits=DIGITS", "Set significant digits for floating-point output");
+    info.option ("--stats", "Store output variable statistics");
     info.option ("-t, --collapsetime", "Collapse and simplify time metadata");
     info.option ("-v, --verbose", "Print verbose messages");
     info.option ("-V, --valid=COUNT", "Set minimum valid values");
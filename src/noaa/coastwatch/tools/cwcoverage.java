@@ -42,19 +42,20 @@ import java.io.FileOutputStream;
 import java.io.PrintStream;
 import java.util.ArrayList;
 import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
 import javax.imageio.ImageIO;
-import noaa.coastwatch.io.EarthDataReader;
-import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.io.FootprintCache;
+import noaa.coastwatch.io.FootprintCache.Footprint;
 import noaa.coastwatch.render.ColorLookup;
 import noaa.coastwatch.render.EarthContextElement;
 import noaa.coastwatch.render.EarthImageTransform;
 import noaa.coastwatch.render.feature.LineFeature;
 import noaa.coastwatch.tools.ToolServices;
-import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.EarthArea;
-import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.EarthLocation;
-import noaa.coastwatch.util.trans.EarthTransform;
 import noaa.coastwatch.util.trans.SpheroidConstants;
 
 /**
@@ -99,7 +100,9 @@ import noaa.coastwatch.util.trans.SpheroidConstants;
  * -H, --highlight=PATTERN <br>
  * -l, --labels=LABEL1/LABEL2/... <br>
  * -m, --map=OUTPUT <br>
+ * -t, --threads=COUNT <br>
  * -x, --box=COLOR <br>
+ * --cache=FILE <br>
  * </p>
  *
  * <h3>Ground station options:</h3>
@@ -215,11 +218,26 @@ import noaa.coastwatch.util.trans.SpheroidConstants;
  *   output PNG coverage image to provide users with a clickable
  *   interface for area of interest selection. </dd>
  *
+ *   <dt> -t, --threads=COUNT </dt>
+ *   <dd> The maximum number of input files to open and compute
+ *   boundaries for at the same time.  By default the number of
+ *   processors is used, up to a maximum of 8.  The boundaries are
+ *   always drawn in the order of the input files. </dd>
+ *
  *   <dt> -x, --box=COLOR </dt> 
  *   <dd> The box boundary and fill color.  The color is specified by
  *   name or hexadecimal value.  The default is a color close to
  *   cyan. </dd>
  *
+ *   <dt> --cache=FILE </dt>
+ *   <dd> The boundary cache file.  When specified, the boundary of
+ *   each input file is saved to the cache file along with the file
+ *   size and modification time.  When the coverage map is created
+ *   again with the same cache file, input files that are unchanged
+ *   are not opened, and their boundaries are read from the cache
+ *   instead.  This can greatly speed up coverage maps for large
+ *   archives of files.  By default no cache is used. </dd>
+ *
  * </dl>
  *
  * <h3>Ground station options:</h3>
@@ -327,6 +345,9 @@ public class cwcoverage {
   /** Name of program. */
   private static final String PROG = "cwcoverage";
 
+  /** The maximum default number of threads. */
+  private static final int MAX_DEFAULT_THREADS = 8;
+
   /////////////////////////////////////////////////////////////////////
 
   /**
@@ -425,6 +446,8 @@ public class cwcoverage {
     Option elevationOpt = cmd.addDoubleOption ('e', "elevation");
     Option stationcolorOpt = cmd.addStringOption ('C', "stationcolor");
     Option stationlabelsOpt = cmd.addStringOption ('L', "stationlabels");
+    Option threadsOpt = cmd.addIntegerOption ('t', "threads");
+    Option cacheOpt = cmd.addStringOption ("cache");
     Option versionOpt = cmd.addBooleanOption ("version");
     try { cmd.parse (argv); }
     catch (OptionException e) {
@@ -482,6 +505,14 @@ public class cwcoverage {
       elevationObj.doubleValue()); 
     String stationColorName = (String) cmd.getOptionValue (stationcolorOpt);
     String stationlabels = (String) cmd.getOptionValue (stationlabelsOpt);
+    Integer threadsObj = (Integer) cmd.getOptionValue (threadsOpt);
+    int threads = (threadsObj != null ? threadsObj.intValue() :
+      Math.min (MAX_DEFAULT_THREADS, Runtime.getRuntime().availableProcessors()));
+    if (threads < 1) {
+      System.err.println (PROG + ": Invalid thread count " + threads);
+      System.exit (2);
+    } // if
+    String cache = (String) cmd.getOptionValue (cacheOpt);
 
     // Create context map
     // ------------------
@@ -574,24 +605,40 @@ public class cwcoverage {
           stationLabelsArray[i]));
       } // for
 
+      // Compute input file footprints
+      // ------------------------------
+      /**
+       * The input files are opened and their footprints computed in
+       * parallel, but the footprints are added to the map in the order
+       * of the input files so that the drawing order is the same as
+       * for a serial computation.
+       */
+      FootprintCache footprintCache = new FootprintCache (
+        cache == null ? null : new File (cache));
+      boolean withArea = (center == null);
+      ExecutorService pool = Executors.newFixedThreadPool (threads);
+      List<Future<Footprint>> futures = new ArrayList<>();
+      for (String file : input) {
+        futures.add (pool.submit (() -> 
+          footprintCache.getFootprint (file, withArea)));
+      } // for
+      pool.shutdown();
+
       // Loop over each input file
       // -------------------------
       for (int i = 0; i < input.length; i++) {
 
-        // Open file
-        // ---------
+        // Get footprint
+        // -------------
         String file = input[i];
         if (verbose) System.out.println (PROG + ": Reading input " + file);
-        EarthDataReader reader = EarthDataReaderFactory.create (file);
-
-        // Get transform info
-        // ------------------
-        EarthDataInfo info = reader.getInfo();
-        EarthTransform trans = info.getTransform();
-        int[] dims = trans.getDimensions();
-        int rows = dims[0];
-        int cols = dims[1];
-        reader.close();
+        Footprint footprint;
+        try { footprint = futures.get (i).get(); }
+        catch (ExecutionException e) {
+          pool.shutdownNow();
+          Throwable cause = e.getCause();
+          throw (cause instanceof Exception ? (Exception) cause : e);
+        } // catch
 
         // Determine this box color
         // ------------------------
@@ -604,24 +651,25 @@ public class cwcoverage {
 
         // Add bounding box
         // ----------------
-        DataLocation min = new DataLocation (0, 0);
-        DataLocation max = new DataLocation (rows-1, cols-1);
         String label = (labelsArray != null ? labelsArray[i] : null);
-        element.addBoundingBox (trans, min, max, thisBoxColor, label);
+        element.addBoundingBox (footprint.getPolygon(), thisBoxColor, label);
 
         // Add to earth area
         // -----------------
-        if (center == null) {
-          area.explore (trans, min, max, trans.transform (min));
-          area.explore (trans, min, max, trans.transform (
-            new DataLocation (0, cols-1)));
-          area.explore (trans, min, max, trans.transform (max));
-          area.explore (trans, min, max, trans.transform (
-            new DataLocation (rows-1, 0)));
-        } // if
+        if (withArea) footprint.addArea (area);
 
       } // for
 
+      // Save footprint cache
+      // --------------------
+      if (cache != null) {
+        if (verbose) {
+          System.out.println (PROG + ": Found " + footprintCache.getHits() +
+            " of " + input.length + " input boundaries in cache");
+        } // if
+        footprintCache.save();
+      } // if
+
       // Set context using center
       // ------------------------
       if (center != null) {
@@ -757,7 +805,9 @@ public class cwcoverage {
 "                             Label boundaries with text.\n" +
 "  -m, --map=OUTPUT           Create an HTML image map file using the\n" +
 "                              boundary points.\n" +
+"  -t, --threads=COUNT        Set maximum number of files opened at once.\n" +
 "  -x, --box=COLOR            Set boundary box outline and fill color.\n" +
+"  --cache=FILE               Save and reuse input file boundaries.\n" +
 "\n" +
 "Ground station options:\n" +
 "  -C, --stationcolor=COLOR   Set ground station outline and fill color.\n" +
@@ -45,6 +45,7 @@ import noaa.coastwatch.tools.CleanupHook;
 import noaa.coastwatch.tools.ToolServices;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
+import noaa.coastwatch.util.EarthRegion;
 import noaa.coastwatch.io.GeoTIFFWriter;
 import noaa.coastwatch.io.GeoTIFFDataWriter;
 
@@ -74,6 +75,7 @@ import java.util.logging.Level;
  * -f, --format=TYPE <br>
  * -h, --help <br>
  * -H, --header <br>
+ * -g, --region=LAT/LON/RADIUS | MINLAT/MINLON/MAXLAT/MAXLON <br>
  * -m, --match=PATTERN <br>
  * -M, --missing=VALUE <br>
  * -v, --verbose <br>
@@ -87,6 +89,7 @@ import java.util.logging.Level;
  * -o, --byteorder=ORDER <br>
  * -r, --range=MIN/MAX <br>
  * -s, --size=TYPE <br>
+ * --sidecar <br>
  * </p>
  *
  * <h3>ASCII text options:</h3>
@@ -222,6 +225,15 @@ import java.util.logging.Level;
  *   'geotiff' for GeoTIFF, or 'auto' to detect the format from the output file name.
  *   The default is 'auto'.</dd>
  *
+ *   <dt> -g, --region=LAT/LON/RADIUS | MINLAT/MINLON/MAXLAT/MAXLON </dt>
+ *   <dd> The geographic region to export, either a center latitude and
+ *   longitude in degrees and a radius in kilometres, or a box of minimum
+ *   and maximum latitude and longitude in degrees.  Only the rectangle
+ *   of data that covers the region is read and exported, along with
+ *   georeferencing for the rectangle.  Region export is supported only
+ *   for map projected data, not for satellite swath data.  By default
+ *   the full data is exported. </dd>
+ *
  *   <dt> -h, --help </dt>
  *   <dd> Prints a brief help message. </dd>
  *
@@ -322,6 +334,16 @@ import java.util.logging.Level;
  *   for 32-bit IEEE floating point values.  The default is 32-bit
  *   floats. </dd>
  *
+ *   <dt> --sidecar </dt>
+ *   <dd> Specifies that a JSON sidecar file should be written alongside
+ *   the binary output.  The sidecar file name is the output file name
+ *   with '.json' appended, and describes the value size, byte order,
+ *   scaling, missing value, variable dimensions and offsets, and the
+ *   earth location and date metadata.  A binary file with a sidecar
+ *   may be used as input to other tools, which read the data directly
+ *   from the file using memory mapping (map projected data only).
+ *   By default no sidecar file is written. </dd>
+ *
  * </dl>
  *
  * <h3>ASCII text options:</h3>
@@ -592,6 +614,8 @@ public class cwexport {
     Option dcsOpt = cmd.addBooleanOption ('S', "dcs");
     Option cwOpt = cmd.addBooleanOption ('C', "cw");
     Option tiffcompOpt = cmd.addStringOption ('T', "tiffcomp");
+    Option sidecarOpt = cmd.addBooleanOption ("sidecar");
+    Option regionOpt = cmd.addStringOption ('g', "region");
     Option versionOpt = cmd.addBooleanOption ("version");
     try { cmd.parse (argv); }
     catch (OptionException e) {
@@ -683,6 +707,8 @@ public class cwexport {
     if (delimit == null) delimit = " ";
     String tiffcomp = (String) cmd.getOptionValue (tiffcompOpt);
     if (tiffcomp == null) tiffcomp = "none";
+    boolean sidecar = (cmd.getOptionValue (sidecarOpt) != null);
+    String regionSpec = (String) cmd.getOptionValue (regionOpt);
 
     // Check range and scaling
     // -----------------------
@@ -713,12 +739,49 @@ public class cwexport {
       } // catch
     } // if
 
+    // Check region
+    // ------------
+    EarthRegion region = null;
+    if (regionSpec != null) {
+      try { region = EarthRegion.parse (regionSpec, ToolServices.SPLIT_REGEX); }
+      catch (IllegalArgumentException e) {
+        LOGGER.severe (e.getMessage());
+        ToolServices.exitWithCode (2);
+        return;
+      } // catch
+    } // if
+
     try {
 
       // Open input file
       // ---------------
       EarthDataReader reader = EarthDataReaderFactory.create (input);
       EarthDataInfo info = reader.getInfo();
+
+      // Get region info
+      // ---------------
+      /**
+       * The region rectangle is computed once here from the input
+       * transform, and then each variable is read as a subset of the
+       * rectangle so that data outside the region is never accessed.
+       */
+      int[][] bounds = null;
+      if (region != null) {
+        bounds = reader.getRegionBounds (region);
+        if (bounds == null) {
+          LOGGER.severe ("Region '" + regionSpec + "' does not intersect input data");
+          ToolServices.exitWithCode (2);
+          return;
+        } // if
+        try { info = reader.getRegionInfo (bounds); }
+        catch (UnsupportedOperationException e) {
+          LOGGER.severe ("Region export not supported for " + info.getTransform().describe() + " data");
+          ToolServices.exitWithCode (2);
+          return;
+        } // catch
+        VERBOSE.info ("Exporting region at [" + bounds[0][0] + "," + bounds[0][1] +
+          "] of size [" + bounds[1][0] + "," + bounds[1][1] + "]");
+      } // if
    
       // Setup for output
       // ----------------
@@ -780,6 +843,10 @@ public class cwexport {
         // ----------
         binWriter.setHeader (header);
 
+        // Set sidecar
+        // -----------
+        binWriter.setSidecar (sidecar);
+
         writer = binWriter;
 
       } // if
@@ -865,7 +932,8 @@ public class cwexport {
         // Get variable and flush
         // ----------------------
         try {
-          DataVariable var = reader.getVariable (i);
+          DataVariable var = (bounds != null ?
+            reader.getRegionVariable (varName, bounds) : reader.getVariable (i));
           VERBOSE.info ("Writing " + varName);
           writer.addVariable (var);
           writer.flush(); 
@@ -915,6 +983,7 @@ public class cwexport {
     info.option ("-f, --format=TYPE", "Set output format");
     info.option ("-h, --help", "Show help message");
     info.option ("-H, --header", "Write header before data");
+    info.option ("-g, --region=LAT/LON/RADIUS | MINLAT/MINLON/MAXLAT/MAXLON", "Write only data covering region");
     info.option ("-m, --match=PATTERN", "Write only variables matching regular expression");
     info.option ("-M, --missing=VALUE", "Set value for missing data");
     info.option ("-v, --verbose", "Print verbose messages");
@@ -925,6 +994,7 @@ public class cwexport {
     info.option ("-o, --byteorder=ORDER", "Set byte order for multi-byte output");
     info.option ("-r, --range=MIN/MAX", "Set range-based integer packing parameters");
     info.option ("-s, --size=TYPE", "Set binary output value size");
+    info.option ("--sidecar", "Write JSON layout and georeferencing sidecar file");
 
     info.section ("ASCII text");
     info.option ("-d, --dec=DECIMALS", "Set geographic coordinate decimal accuracy");
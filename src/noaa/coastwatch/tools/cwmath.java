@@ -68,6 +68,8 @@ import noaa.coastwatch.util.expression.ExpressionParser.ResultType;
 import noaa.coastwatch.util.expression.ParseImp;
 import noaa.coastwatch.util.expression.EvaluateImp;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.Statistics;
+import noaa.coastwatch.util.PrecisionTrimmer;
 import noaa.coastwatch.util.trans.EarthTransform;
 
 import noaa.coastwatch.util.chunk.DataChunk;
@@ -115,6 +117,8 @@ import noaa.coastwatch.util.chunk.DataChunkFactory;
  * -m, --missing=VALUE <br>
  * -p, --parser=TYPE <br>
  * -s, --size=TYPE <br>
+ * --sigdigits=DIGITS <br>
+ * --stats <br>
  * -t, --template=VARIABLE <br>
  * -f, --full-template <br>
  * -u, --units=STRING <br>
@@ -589,6 +593,24 @@ import noaa.coastwatch.util.chunk.DataChunkFactory;
  *   packed into 16-bit signed integers with a range of [-327.68 ... 327.67] and
  *   two decimals of accuracy. </dd>
  *
+ *   <dt> --sigdigits=DIGITS </dt>
+ *   <dd> The number of significant decimal digits to keep for
+ *   floating-point output data, in the range [1..15].  The trailing
+ *   mantissa bits of each value beyond the requested precision are
+ *   rounded off before the data is compressed, which can greatly
+ *   reduce the output file size.  The precision kept is recorded in
+ *   the 'quantization_nsb' variable attribute.  Integer output data is
+ *   not affected.  By default floating-point data is written at full
+ *   precision. </dd>
+ *
+ *   <dt> --stats </dt>
+ *   <dd> Turns on computation of output variable statistics while the
+ *   data is written.  The minimum, maximum, mean, standard deviation,
+ *   median, percentiles, and a histogram over all data values are
+ *   stored in 'stats_*' variable attributes, so that later statistics
+ *   and enhancement calculations on the output variable don't need to
+ *   read the data.  By default no statistics are stored. </dd>
+ *
  *   <dt> -t, --template=VARIABLE </dt>
  *   <dd> The output template variable.  When a template is used, the
  *   output variable size, scaling, units, long name, and missing
@@ -954,6 +976,8 @@ public final class cwmath {
     Option exprOpt = cmd.addStringOption ('e', "expr");
     Option parserOpt = cmd.addStringOption ('p', "parser");
     Option missingOpt = cmd.addStringOption ('m', "missing");
+    Option sigdigitsOpt = cmd.addIntegerOption ("sigdigits");
+    Option statsOpt = cmd.addBooleanOption ("stats");
     Option versionOpt = cmd.addBooleanOption ("version");
     try { cmd.parse (argv); }
     catch (OptionException e) {
@@ -1054,6 +1078,13 @@ public final class cwmath {
       parserWasSet = true;
     } // else
     String missingStr = (String) cmd.getOptionValue (missingOpt);
+    Integer sigdigits = (Integer) cmd.getOptionValue (sigdigitsOpt);
+    if (sigdigits != null && (sigdigits < 1 || sigdigits > 15)) {
+      LOGGER.severe ("Invalid significant digits " + sigdigits);
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+    boolean stats = (cmd.getOptionValue (statsOpt) != null);
 
     // We have the readers and writers declared outside the try statement so
     // we can close them later if there's an error that doesn't result in
@@ -1119,6 +1150,9 @@ public final class cwmath {
           writer = new CWHDFWriter (readers[0].getInfo(), output);
         } // else
       } // if
+      if (sigdigits != null)
+        writer.setSignificantBits (null, PrecisionTrimmer.getBitsForDigits (sigdigits));
+      writer.setStatistics (stats);
 
       // Get input variable names and modify expression
       // ----------------------------------------------
@@ -1328,6 +1362,7 @@ public final class cwmath {
       if (templateVar != null) {
         if (fullTemplate) {
           grid.getMetadataMap().putAll (templateVar.getMetadataMap());
+          Statistics.removeAttributes (grid.getMetadataMap());
         } // if
         else {
           Map templateMap = templateVar.getMetadataMap();
@@ -1457,6 +1492,8 @@ public final class cwmath {
     info.option ("-l, --longname=STRING", "Set output variable long name");
     info.option ("-m, --missing=VALUE", "Set output variable missing value");
     info.option ("-s, --size=TYPE", "Set output variable binary type");
+    info.option ("--sigdigits=DIGITS", "Set significant digits for floating-point output");
+    info.option ("--stats", "Store output variable statistics");
     info.option ("-t, --template=VARIABLE", "Use template for output attributes");
     info.option ("-f, --full-template", "Use all template variable attributes");
     info.option ("-u, --units=STRING", "Set output variable units");
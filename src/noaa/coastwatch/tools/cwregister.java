@@ -75,6 +75,7 @@ import java.util.logging.Level;
  * <h3>Options:</h3>
  *
  * <p>
+ * -e, --maxerror=PIXELS <br>
  * -f, --srcfilter=TYPE <br>
  * -h, --help <br>
  * -m, --match=PATTERN <br>
@@ -124,6 +125,18 @@ import java.util.logging.Level;
  *
  *   <dd>Prints a brief help message.</dd>
  *
+ *   <dt>-e, --maxerror=PIXELS</dt>
+ *
+ *   <dd>The maximum source coordinate interpolation error in pixels.
+ *   This option is only used by the direct resampling method (see the
+ *   <b>--method</b> option).  When specified, source coordinates are
+ *   computed exactly only on a sparse set of destination locations and
+ *   interpolated in between, with the destination divided more finely
+ *   wherever the interpolation error exceeds the maximum.  This is much
+ *   faster than computing every source coordinate exactly when
+ *   resampling between smooth map projections.  By default every source
+ *   coordinate is computed exactly.</dd>
+ *
  *   <dt>-f, --srcfilter=TYPE</dt>
  *
  *   <dd>Specifies a filter used to determine whether source pixels
@@ -319,6 +332,7 @@ public final class cwregister {
     Option overwriteOpt = cmd.addStringOption ('O', "overwrite");
     Option srcexprOpt = cmd.addStringOption ('s', "srcexpr");
     Option srcfilterOpt = cmd.addStringOption ('f', "srcfilter");
+    Option maxerrorOpt = cmd.addDoubleOption ('e', "maxerror");
     Option savemapOpt = cmd.addBooleanOption ('S', "savemap");
     Option versionOpt = cmd.addBooleanOption ("version");
     try { cmd.parse (argv); }
@@ -374,6 +388,8 @@ public final class cwregister {
     String srcexpr = (String) cmd.getOptionValue (srcexprOpt);
     String srcfilter = (String) cmd.getOptionValue (srcfilterOpt);
     boolean saveMap = (cmd.getOptionValue (savemapOpt) != null);
+    Double maxerrorObj = (Double) cmd.getOptionValue (maxerrorOpt);
+    double maxerror = (maxerrorObj == null ? 0 : maxerrorObj.doubleValue());
 
     // Detect method subtype
     // ---------------------
@@ -519,8 +535,10 @@ public final class cwregister {
       // Create direct resampler
       // -----------------------
       else if (method.equals ("direct")) {
-        resampler = new DirectGridResampler (inputInfo.getTransform(),
-          masterTrans);
+        DirectGridResampler direct = new DirectGridResampler (
+          inputInfo.getTransform(), masterTrans);
+        direct.setMaxError (maxerror);
+        resampler = direct;
       } // else if
 
       // Invalid method
@@ -649,6 +667,7 @@ public final class cwregister {
     info.param ("input", "Input data file");
     info.param ("output", "Output data file");
 
+    info.option ("-e, --maxerror=PIXELS", "Set interpolation error for direct method");
     info.option ("-f, --srcfilter=TYPE", "Filter source pixels using filter type");
     info.option ("-h, --help", "Show help message");
     info.option ("-m, --match=PATTERN", "Register only variables matching regular expression");
@@ -48,6 +48,7 @@ import noaa.coastwatch.tools.ToolServices;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.PrecisionTrimmer;
 import noaa.coastwatch.util.trans.EarthTransform;
 import noaa.coastwatch.util.trans.SpheroidConstants;
 import noaa.coastwatch.util.trans.ProjectionConstants;
@@ -57,6 +58,7 @@ import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.EarthLocation;
 
 import noaa.coastwatch.util.chunk.DataChunk;
+import noaa.coastwatch.util.chunk.DataChunk.DataType;
 import noaa.coastwatch.util.chunk.ChunkProducer;
 import noaa.coastwatch.util.chunk.ChunkConsumer;
 import noaa.coastwatch.util.chunk.GridChunkProducer;
@@ -67,6 +69,9 @@ import noaa.coastwatch.util.chunk.PoolProcessor;
 import noaa.coastwatch.util.chunk.ResamplingOperation;
 import noaa.coastwatch.util.chunk.ChunkOperation;
 import noaa.coastwatch.util.chunk.SyntheticIntChunkProducer;
+import noaa.coastwatch.util.chunk.ChunkCache;
+import noaa.coastwatch.util.chunk.CachedChunkProducer;
+import noaa.coastwatch.util.chunk.ChunkResampler.Kernel;
 
 import noaa.coastwatch.util.DirectResamplingMapFactory;
 import noaa.coastwatch.util.BucketResamplingMapFactory;
@@ -108,12 +113,15 @@ import java.util.logging.Level;
  * -d, --diagnostic <br>
  * -D, --diagnostic-long <br>
  * -g, --nogroup <br>
+ * -k, --kernel=TYPE <br>
  * -M, --master=FILE <br>
  * -m, --match=PATTERN <br>
  * -p, --proj=SYSTEM <br>
  * -S, --savemap <br>
  * -H, --sensorhint=HINT <br>
  * --serial <br>
+ * --sigdigits=DIGITS <br>
+ * --stats <br>
  * -t, --tiledims=ROWS/COLS <br>
  * -u, --usemap=FILE[/ROW_VAR/COL_VAR] <br>
  * -v, --verbose <br>
@@ -218,6 +226,22 @@ import java.util.logging.Level;
  *   names contain a leading group path ending with '/', the group path is
  *   removed.</dd>
  *
+ *   <dt>-k, --kernel=TYPE</dt>
+ *
+ *   <dd>The resampling kernel for floating-point and scaled integer
+ *   variables.  This can be 'nearest' (copy the nearest source value),
+ *   'bilinear' or 'bicubic' (interpolate between the surrounding source
+ *   values), or 'area' (average the source values under each destination
+ *   pixel, weighted by overlap).  Use 'area' to downsample high resolution
+ *   data onto a coarser grid in a single pass, and 'bilinear' or 'bicubic'
+ *   to avoid blocky output when upsampling.  Missing source values are left
+ *   out of the weighted mean, and a destination value is missing if less
+ *   than half of its weight is valid.  Unscaled integer variables such as
+ *   flags and masks always use the nearest source value.  Interpolation
+ *   uses the exact fractional source location only when the source
+ *   transform can be inverted directly, otherwise the nearest source pixel
+ *   location is used.  The default is 'nearest'.</dd>
+ *
  *   <dt>-M, --master=FILE</dt>
  *
  *   <dd>The master projection file name.  The master file is not modified,
@@ -263,6 +287,26 @@ import java.util.logging.Level;
  *   <dd>Turns on serial processing mode.  By default the program will
  *   use multiple processors in parallel to process chunks of data.</dd>
  *
+ *   <dt>--sigdigits=DIGITS</dt>
+ *
+ *   <dd>Specifies the number of significant decimal digits to keep for
+ *   floating-point output variables, in the range [1..15].  The trailing
+ *   mantissa bits of each value beyond the requested precision are
+ *   rounded off before the data is compressed, which can greatly reduce
+ *   the output file size.  The precision kept is recorded in the
+ *   'quantization_nsb' variable attribute.  Integer variables are not
+ *   affected.  By default floating-point data is written at full
+ *   precision.</dd>
+ *
+ *   <dt>--stats</dt>
+ *
+ *   <dd>Turns on computation of output variable statistics while the
+ *   data is written.  The minimum, maximum, mean, standard deviation,
+ *   median, percentiles, and a histogram over all data values are
+ *   stored in 'stats_*' variable attributes, so that later statistics
+ *   and enhancement calculations on the output variables don't need to
+ *   read the data.  By default no statistics are stored.</dd>
+ *
  *   <dt>-t, --tiledims=ROWS/COLS</dt>
  *
  *   <dd>Specifies the 2D tile size to use in the output file.  This is
@@ -549,6 +593,9 @@ public final class cwregister2 {
     Option usemapOpt = cmd.addStringOption ('u', "usemap");
     Option sensorhintOpt = cmd.addStringOption ('H', "sensorhint");
     Option nogroupOpt = cmd.addBooleanOption ('g', "nogroup");
+    Option kernelOpt = cmd.addStringOption ('k', "kernel");
+    Option sigdigitsOpt = cmd.addIntegerOption ("sigdigits");
+    Option statsOpt = cmd.addBooleanOption ("stats");
     Option versionOpt = cmd.addBooleanOption ("version");
     try { cmd.parse (argv); }
     catch (OptionException e) {
@@ -605,6 +652,22 @@ public final class cwregister2 {
     boolean serialOperations = (cmd.getOptionValue (serialOpt) != null);
     String sensorhint = (String) cmd.getOptionValue (sensorhintOpt);
     boolean nogroup = (cmd.getOptionValue (nogroupOpt) != null);
+    Integer sigdigits = (Integer) cmd.getOptionValue (sigdigitsOpt);
+    if (sigdigits != null && (sigdigits < 1 || sigdigits > 15)) {
+      LOGGER.severe ("Invalid significant digits " + sigdigits);
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+    boolean stats = (cmd.getOptionValue (statsOpt) != null);
+    String kernelName = (String) cmd.getOptionValue (kernelOpt);
+    if (kernelName == null) kernelName = "nearest";
+    Kernel kernel;
+    try { kernel = Kernel.valueOf (kernelName.toUpperCase()); }
+    catch (IllegalArgumentException e) {
+      LOGGER.severe ("Invalid resampling kernel " + kernelName);
+      ToolServices.exitWithCode (2);
+      return;
+    } // catch
 
     // Check output
     // ------------
@@ -684,9 +747,23 @@ public final class cwregister2 {
       };
       LOGGER.fine ("Tile dimensions " + Arrays.toString (tileDims));
       writer.setTileDims (tileDims);
+
+      // Set precision trimming
+      // ----------------------
+      if (sigdigits != null)
+        writer.setSignificantBits (null, PrecisionTrimmer.getBitsForDigits (sigdigits));
+      writer.setStatistics (stats);
       
       List<ChunkProducer> producerList = new ArrayList<>();
       List<ChunkConsumer> consumerList = new ArrayList<>();
+      List<Kernel> kernelList = new ArrayList<>();
+
+      /**
+       * Source chunks are read through a cache shared by all variables
+       * and threads, so that neighbouring destination chunks that need
+       * the same source chunks don't read and decode them again.
+       */
+      ChunkCache sourceCache = new ChunkCache (Runtime.getRuntime().maxMemory()/4);
      
       // Loop over each variable
       // -----------------------
@@ -722,8 +799,12 @@ public final class cwregister2 {
           };
           outputGrid.setNavigation (null);
           outputGrid = new HDFCachedGrid (outputGrid, writer);
-          producerList.add (new GridChunkProducer (inputGrid));
+          ChunkProducer producer = new GridChunkProducer (inputGrid);
+          DataType type = producer.getExternalType();
+          boolean isFloat = (type == DataType.FLOAT || type == DataType.DOUBLE);
+          producerList.add (new CachedChunkProducer (producer, sourceCache));
           consumerList.add (new GridChunkConsumer (outputGrid));
+          kernelList.add (isFloat ? kernel : Kernel.NEAREST);
         } // if
 
       } // for
@@ -760,6 +841,7 @@ public final class cwregister2 {
 
         producerList.add (sourceRowChunkProducer);
         consumerList.add (new GridChunkConsumer (sourceRowGrid));
+        kernelList.add (Kernel.NEAREST);
 
         VERBOSE.info ("Creating mapping variable source_col");
         ChunkProducer sourceColChunkProducer = new SyntheticIntChunkProducer (sourceScheme,
@@ -779,6 +861,7 @@ public final class cwregister2 {
 
         producerList.add (sourceColChunkProducer);
         consumerList.add (new GridChunkConsumer (sourceColGrid));
+        kernelList.add (Kernel.NEAREST);
 
       } // if
 
@@ -888,8 +971,7 @@ public final class cwregister2 {
       // Setup resampling
       // ----------------
       ChunkingScheme scheme = consumerList.get (0).getNativeScheme();
-      List<ChunkPosition> positions = new ArrayList<>();
-      scheme.forEach (positions::add);
+      List<ChunkPosition> positions = scheme.getLocalityOrder();
 
       int[] sourceDims = sourceTrans.getDimensions();
       VERBOSE.info ("Source has size " + sourceDims[ROW] + "x" + sourceDims[COL]);
@@ -907,7 +989,9 @@ public final class cwregister2 {
 
       // Perform resampling
       // ------------------
-      ChunkOperation op = new ResamplingOperation (producerList, consumerList, mapFactory);
+      if (kernel != Kernel.NEAREST)
+        VERBOSE.info ("Using " + kernelName.toLowerCase() + " kernel for floating-point variables");
+      ChunkOperation op = new ResamplingOperation (producerList, consumerList, mapFactory, kernelList);
 
       if (serialOperations) {
         positions.forEach (pos -> op.perform (pos));
@@ -919,6 +1003,9 @@ public final class cwregister2 {
         processor.waitForCompletion();
       } // if
 
+      VERBOSE.info ("Read " + sourceCache.getLoads() + " source chunks for " +
+        sourceCache.getRequests() + " chunk requests");
+
       // Perform diagnostic
       // ------------------
       if (performDiagnostic && diagnostic != null) {
@@ -1000,6 +1087,7 @@ public final class cwregister2 {
     info.option ("-d, --diagnostic", "Perform resampling diagnostics");
     info.option ("-D, --diagnostic-long", "Perform diagnostics in long form");
     info.option ("-g, --nogroup", "Remove group path from variable names");
+    info.option ("-k, --kernel=TYPE", "Set resampling kernel for floating-point data");
     info.option ("-h, --help", "Show help message");
     info.option ("-M, --master=FILE", "Use file for output projection");
     info.option ("-m, --match=PATTERN", "Register only variables matching regular expression");
@@ -1007,6 +1095,8 @@ public final class cwregister2 {
     info.option ("-S, --savemap", "Save resampling map");
     info.option ("-H, --sensorhint=HINT", "Override automatic sensor detection");
     info.option ("--serial", "Perform serial operations");
+    info.option ("--sigdigits=DIGITS", "Set significant digits for floating-point output");
+    info.option ("--stats", "Store output variable statistics");
     info.option ("-t, --tiledims=ROWS/COLS", "Set written tile dimensions");
     info.option ("-u, --usemap=FILE[/ROW_VAR/COL_VAR]", "Use precomputed remapping");
     info.option ("-v, --verbose", "Print verbose messages");
@@ -442,9 +442,12 @@ import ucar.units.Unit;
  *     by most web browsers and image manipulation software.  The GIF
  *     files produced use LZW compression.  Images stored in GIF
  *     format are run through a color quantization algorithm to reduce
- *     the color map to 256 colors or less.  Although file sizes are
- *     generally smaller than PNG, image quality may be compromised by
- *     the reduced color map.</li>
+ *     the color map to 256 colors or less, unless the <b>--indexed</b>
+ *     option is specified for a color enhancement image, in which case
+ *     the image colors are mapped exactly to the indexed color model
+ *     without antialiasing.  Although file sizes are generally smaller
+ *     than PNG, image quality may be compromised by the reduced color
+ *     map.</li>
  *
  *     <li> <b>JPEG</b> is a lossy compressed format that should be
  *     used with caution for images with sharp color lines such as
@@ -0,0 +1,458 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: cwseries.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.tools;
+
+// Imports
+// -------
+import jargs.gnu.CmdLineParser;
+import jargs.gnu.CmdLineParser.Option;
+import jargs.gnu.CmdLineParser.OptionException;
+import java.io.BufferedReader;
+import java.io.File;
+import java.io.FileInputStream;
+import java.io.FileReader;
+import java.io.IOException;
+import java.io.InputStreamReader;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.Date;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import noaa.coastwatch.io.EarthDataReader;
+import noaa.coastwatch.io.EarthDataReaderFactory;
+import noaa.coastwatch.io.SimpleParser;
+import noaa.coastwatch.io.TimeSeriesExtractor;
+import noaa.coastwatch.io.TimeSeriesNCWriter;
+import noaa.coastwatch.tools.CleanupHook;
+import noaa.coastwatch.tools.ToolServices;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.EarthLocation;
+
+import java.util.logging.Logger;
+import java.util.logging.Level;
+
+/**
+ * <p>The time series tool extracts data values at a set of earth
+ * locations from a series of data files.</p>
+ *
+ * <!-- START MAN PAGE -->
+ *
+ * <h2>Name</h2>
+ * <p>
+ *   <!-- START NAME -->
+ *   cwseries - extracts time series of data values at earth locations.
+ *   <!-- END NAME -->
+ * </p>
+ *
+ * <h2>Synopsis</h2>
+ * <p>
+ *   cwseries [OPTIONS] input [input2 ...] output<br>
+ *   cwseries [OPTIONS] --inputs=FILE output
+ * </p>
+ *
+ * <h3>Options:</h3>
+ *
+ * <p>
+ * -h, --help <br>
+ * -i, --inputs=FILE <br>
+ * -S, --samples=FILE <br>
+ * -t, --threads=COUNT <br>
+ * -v, --verbose <br>
+ * -V, --variable=NAME1[/NAME2/...] <br>
+ * --version <br>
+ * </p>
+ *
+ * <h2>Description</h2>
+ * <p>
+ * The time series tool extracts data values at a list of earth
+ * locations from 2D data variables in a series of input files, and
+ * writes the values to a NetCDF file as a time series for each
+ * location.  It produces the same values as running the sampling tool
+ * on each input file, but is much faster for large numbers of files and
+ * locations:
+ * </p>
+ * <ul>
+ *   <li>All files are processed in a single program run, with a number
+ *   of files opened and sampled in parallel.</li>
+ *   <li>Within each file, the locations are sampled in order of the
+ *   data tiles that contain them, so that each tile of data is read at
+ *   most once.</li>
+ *   <li>The image coordinates of the locations are computed once for
+ *   each distinct map projection and reused for all files with that
+ *   projection.</li>
+ * </ul>
+ * <p>
+ * The output NetCDF file follows the CF conventions for time series
+ * data.  It has a 'time' dimension with one entry per input file in the
+ * order the files are given, and a 'station' dimension with one entry
+ * per location in the order the locations are listed.  Each variable
+ * is written as a 32-bit floating point array with dimensions (time,
+ * station), and the station latitude and longitude are written as the
+ * 'lat' and 'lon' variables.  Locations outside the data, missing data
+ * values, and input files that cannot be read are written as NaN.
+ * </p>
+ *
+ * <h2>Parameters</h2>
+ *
+ * <h3>Main parameters:</h3>
+ *
+ * <dl>
+ *
+ *   <dt> input [input2 ...] </dt>
+ *   <dd> The input data file names, one time step each.  At least one
+ *   input file is required, unless the <b>--inputs</b> option is
+ *   used. </dd>
+ *
+ *   <dt> output </dt>
+ *   <dd> The output NetCDF file name. </dd>
+ *
+ * </dl>
+ *
+ * <h3>Options:</h3>
+ *
+ * <dl>
+ *
+ *   <dt> -h, --help </dt>
+ *   <dd> Prints a brief help message. </dd>
+ *
+ *   <dt> -i, --inputs=FILE </dt>
+ *   <dd> The file name containing a list of input data files.  The file
+ *   must be an ASCII text file containing input file names, one per
+ *   line.  If the inputs file name is '-', input is read from standard
+ *   input.</dd>
+ *
+ *   <dt> -S, --samples=FILE </dt>
+ *   <dd> The file name containing the list of sample locations.  The
+ *   file must be an ASCII text file containing locations as latitude /
+ *   longitude pairs, one pair per line, with values separated by spaces
+ *   or tabs, in the same format as the sampling tool.  This option is
+ *   required. </dd>
+ *
+ *   <dt> -t, --threads=COUNT </dt>
+ *   <dd> The maximum number of input files to open and sample at the
+ *   same time.  By default the number of processors is used, up to a
+ *   maximum of 8. </dd>
+ *
+ *   <dt> -v, --verbose </dt>
+ *   <dd> Turns verbose mode on.  The progress of each input file is
+ *   printed.  The default is to run quietly. </dd>
+ *
+ *   <dt> -V, --variable=NAME1[/NAME2/...] </dt>
+ *   <dd> The variable names to sample.  The variables are written to
+ *   the output in the order listed, and must exist in the first input
+ *   file.  If a variable is missing from a later input file, its
+ *   values are written as NaN for that time step.  This option is
+ *   required. </dd>
+ *
+ *   <dt>--version</dt>
+ *   <dd>Prints the software version.</dd>
+ *
+ * </dl>
+ *
+ * <h2>Exit status</h2>
+ * <p> 0 on success, &gt; 0 on failure.  Possible causes of errors:</p>
+ * <ul>
+ *   <li> Invalid command line option </li>
+ *   <li> Invalid input or output file names </li>
+ *   <li> Invalid sample locations file format </li>
+ *   <li> Variable not found in the first input file </li>
+ * </ul>
+ *
+ * <h2>Examples</h2>
+ * <p> The following extracts a year of SST values at a set of buoy
+ * locations from daily files listed in a text file:</p>
+ * <pre>
+ *   phollema$ ls 2025_*_sst.hdf &gt; inputs.txt
+ *   phollema$ cwseries -v --inputs inputs.txt --samples buoys.txt --variable sst sst_series.nc
+ *
+ *   [INFO] Found 365 input file(s) and 1250 location(s)
+ *   [INFO] Extracted 2025_001_sst.hdf (1 of 365)
+ *   [INFO] Extracted 2025_002_sst.hdf (2 of 365)
+ *   ...
+ *   [INFO] Reused location coordinates for 364 file(s)
+ * </pre>
+ *
+ * <!-- END MAN PAGE -->
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public final class cwseries {
+
+  private static final String PROG = cwseries.class.getName();
+  private static final Logger LOGGER = Logger.getLogger (PROG);
+  private static final Logger VERBOSE = Logger.getLogger (PROG + ".verbose");
+
+  // Constants
+  // ---------
+
+  /** Minimum required command line parameters. */
+  private static final int NARGS = 1;
+
+  /** The maximum default number of threads. */
+  private static final int MAX_DEFAULT_THREADS = 8;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Performs the main function.
+   *
+   * @param argv the list of command line parameters.
+   */
+  public static void main (String argv[]) {
+
+    ToolServices.startExecution (PROG);
+    ToolServices.setCommandLine (PROG, argv);
+
+    // Parse command line
+    // ------------------
+    CmdLineParser cmd = new CmdLineParser();
+    Option helpOpt = cmd.addBooleanOption ('h', "help");
+    Option verboseOpt = cmd.addBooleanOption ('v', "verbose");
+    Option inputsOpt = cmd.addStringOption ('i', "inputs");
+    Option samplesOpt = cmd.addStringOption ('S', "samples");
+    Option threadsOpt = cmd.addIntegerOption ('t', "threads");
+    Option variableOpt = cmd.addStringOption ('V', "variable");
+    Option versionOpt = cmd.addBooleanOption ("version");
+    try { cmd.parse (argv); }
+    catch (OptionException e) {
+      LOGGER.warning (e.getMessage());
+      usage();
+      ToolServices.exitWithCode (1);
+      return;
+    } // catch
+
+    // Print help message
+    // ------------------
+    if (cmd.getOptionValue (helpOpt) != null) {
+      usage();
+      ToolServices.exitWithCode (0);
+      return;
+    } // if
+
+    // Print version message
+    // ---------------------
+    if (cmd.getOptionValue (versionOpt) != null) {
+      System.out.println (ToolServices.getFullVersion (PROG));
+      ToolServices.exitWithCode (0);
+      return;
+    } // if
+
+    // Get remaining arguments
+    // -----------------------
+    String[] remain = cmd.getRemainingArgs();
+    if (remain.length < NARGS) {
+      LOGGER.warning ("At least " + NARGS + " argument(s) required");
+      usage();
+      ToolServices.exitWithCode (1);
+      return;
+    } // if
+    String output = remain[remain.length-1];
+
+    // Set defaults
+    // ------------
+    boolean verbose = (cmd.getOptionValue (verboseOpt) != null);
+    if (verbose) VERBOSE.setLevel (Level.INFO);
+    String inputs = (String) cmd.getOptionValue (inputsOpt);
+    String samples = (String) cmd.getOptionValue (samplesOpt);
+    String variable = (String) cmd.getOptionValue (variableOpt);
+    Integer threadsObj = (Integer) cmd.getOptionValue (threadsOpt);
+    int threads = (threadsObj != null ? threadsObj.intValue() :
+      Math.min (MAX_DEFAULT_THREADS, Runtime.getRuntime().availableProcessors()));
+    if (threads < 1) {
+      LOGGER.severe ("Invalid thread count " + threads);
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+
+    // Check required options
+    // ----------------------
+    if (samples == null) {
+      LOGGER.severe ("The --samples option must be specified");
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+    if (variable == null) {
+      LOGGER.severe ("The --variable option must be specified");
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+    List<String> varNames = Arrays.asList (variable.split (ToolServices.SPLIT_REGEX));
+
+    // Read input filenames from file
+    // ------------------------------
+    List<String> inputFileList;
+    if (inputs != null) {
+      inputFileList = new ArrayList<>();
+      try {
+        BufferedReader reader;
+        if (inputs.equals ("-"))
+          reader = new BufferedReader (new InputStreamReader (System.in));
+        else
+          reader = new BufferedReader (new FileReader (inputs));
+        String line;
+        while ((line = reader.readLine()) != null) {
+          String fileName = line.trim();
+          if (!fileName.equals ("")) inputFileList.add (fileName);
+        } // while
+        reader.close();
+      } // try
+      catch (IOException e) {
+        LOGGER.log (Level.SEVERE, "Error parsing inputs file", e);
+        ToolServices.exitWithCode (2);
+        return;
+      } // catch
+    } // if
+
+    // Get input filenames from command line
+    // -------------------------------------
+    else {
+      inputFileList = Arrays.asList (remain).subList (0, remain.length-1);
+    } // else
+
+    // Check input file count
+    // ----------------------
+    if (inputFileList.size() == 0) {
+      LOGGER.severe ("At least one input file must be specified");
+      ToolServices.exitWithCode (2);
+      return;
+    } // if
+
+    // Read sample locations
+    // ---------------------
+    List<EarthLocation> locations = new ArrayList<>();
+    try {
+      SimpleParser parser = new SimpleParser (new BufferedReader (
+        new InputStreamReader (new FileInputStream (new File (samples)))));
+      do {
+        double lat = parser.getNumber();
+        double lon = parser.getNumber();
+        locations.add (new EarthLocation (lat, lon));
+      } while (!parser.eof());
+    } // try
+    catch (IOException e) {
+      LOGGER.log (Level.SEVERE, "Error parsing sample points file", e);
+      ToolServices.exitWithCode (2);
+      return;
+    } // catch
+    VERBOSE.info ("Found " + inputFileList.size() + " input file(s) and " +
+      locations.size() + " location(s)");
+
+    try {
+
+      // Get variable information
+      // ------------------------
+      List<DataVariable> previews = new ArrayList<>();
+      EarthDataReader reader = EarthDataReaderFactory.create (inputFileList.get (0));
+      for (String varName : varNames) {
+        DataVariable preview = reader.getPreview (varName);
+        if (preview.getRank() != 2) {
+          LOGGER.severe ("Cannot sample variable '" + varName + "', rank is not 2");
+          ToolServices.exitWithCode (2);
+          return;
+        } // if
+        previews.add (preview);
+      } // for
+      reader.close();
+
+      // Create output file
+      // ------------------
+      VERBOSE.info ("Creating output " + output);
+      CleanupHook.getInstance().scheduleDelete (output);
+      final TimeSeriesNCWriter writer = new TimeSeriesNCWriter (output,
+        inputFileList.size(), locations, previews);
+
+      // Extract time series
+      // -------------------
+      final List<String> fileList = inputFileList;
+      final AtomicInteger finished = new AtomicInteger();
+      TimeSeriesExtractor extractor = new TimeSeriesExtractor (locations, varNames);
+      extractor.setThreads (threads);
+      extractor.extract (inputFileList, new TimeSeriesExtractor.SliceConsumer () {
+        public void accept (int index, Date date, double[][] values) throws IOException {
+          writer.accept (index, date, values);
+          VERBOSE.info ("Extracted " + fileList.get (index) + " (" +
+            finished.incrementAndGet() + " of " + fileList.size() + ")");
+        } // accept
+      });
+      VERBOSE.info ("Reused location coordinates for " + extractor.getCacheHits() + " file(s)");
+
+      // Close file
+      // ----------
+      writer.close();
+      CleanupHook.getInstance().cancelDelete (output);
+
+    } // try
+
+    catch (OutOfMemoryError | Exception e) {
+      ToolServices.warnOutOfMemory (e);
+      LOGGER.log (Level.SEVERE, "Aborting", e);
+      ToolServices.exitWithCode (2);
+      return;
+    } // catch
+
+    ToolServices.finishExecution (PROG);
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+  private static void usage () { System.out.println (getUsage()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the usage info for this tool. */
+  private static UsageInfo getUsage () {
+
+    UsageInfo info = new UsageInfo ("cwseries");
+
+    info.func ("Extracts time series of data values at earth locations");
+
+    info.param ("input [input2 ...]", "Input data file(s)", 1);
+    info.param ("output", "Output NetCDF file", 1);
+
+    info.param ("--inputs=FILE", "Text file of input data file(s)", 2);
+    info.param ("output", "Output NetCDF file", 2);
+
+    info.option ("-h, --help", "Show help message");
+    info.option ("-i, --inputs=FILE", "Read input file names from text file");
+    info.option ("-S, --samples=FILE", "Sample locations file");
+    info.option ("-t, --threads=COUNT", "Set maximum number of files processed at once");
+    info.option ("-v, --verbose", "Print verbose messages");
+    info.option ("-V, --variable=NAME1[/NAME2/...]", "Sample variables listed");
+    info.option ("--version", "Show version information");
+
+    return (info);
+
+  } // getUsage
+
+  ////////////////////////////////////////////////////////////
+
+  private cwseries () { }
+
+  ////////////////////////////////////////////////////////////
+
+} // cwseries class
+
+////////////////////////////////////////////////////////////////////////
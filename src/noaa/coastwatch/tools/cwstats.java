@@ -48,13 +48,13 @@ import java.util.Iterator;
 import noaa.coastwatch.io.EarthDataReader;
 import noaa.coastwatch.io.EarthDataReaderFactory;
 import noaa.coastwatch.io.SimpleParser;
-import noaa.coastwatch.render.Subregion;
 import noaa.coastwatch.tools.ToolServices;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataLocationConstraints;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.EarthRegion;
 import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.VariableStatisticsGenerator;
 import noaa.coastwatch.util.trans.EarthTransform;
@@ -80,7 +80,7 @@ import noaa.coastwatch.util.trans.Datum;
  *
  * <p>
  * -h, --help <br>
- * -i, --region=LAT/LON/RADIUS <br>
+ * -i, --region=LAT/LON/RADIUS | MINLAT/MINLON/MAXLAT/MAXLON <br>
  * -l, --limit=STARTROW/STARTCOL/ENDROW/ENDCOL <br>
  * -m, --match=PATTERN <br>
  * -p, --polygon=FILE <br>
@@ -125,14 +125,16 @@ import noaa.coastwatch.util.trans.Datum;
  *   <dt> -h, --help </dt>
  *   <dd> Prints a brief help message. </dd>
  *
- *   <dt> -i, --region=LAT/LON/RADIUS</dt>
+ *   <dt> -i, --region=LAT/LON/RADIUS | MINLAT/MINLON/MAXLAT/MAXLON</dt>
  *   <dd> The sampling region for each two-dimensional variable.  The
- *   region is specified by the center latitude and longitude in
- *   degrees, and the radius from the center in kilometers.  Only data
- *   within the rectangle specified by the center and radius is
- *   sampled.  By default, all data is sampled.  Only one of the
- *   <b>--region</b>, <b>--limit</b>, or <b>--polygon</b> options may be
- *   specified.</dd>
+ *   region is specified either by the center latitude and longitude in
+ *   degrees and the radius from the center in kilometers, or by the
+ *   minimum and maximum latitude and longitude of a box in degrees.
+ *   Only data within the rectangle of data coordinates that covers the
+ *   region is sampled, which is the same rectangle selected by the
+ *   <b>--region</b> option of other tools.  By default, all data is
+ *   sampled.  Only one of the <b>--region</b>, <b>--limit</b>, or
+ *   <b>--polygon</b> options may be specified.</dd>
  *
  *   <dt> -l, --limit=STARTROW/ENDROW/STARTCOL/ENDCOL</dt> 
  *   <dd> The sampling limits for each two-dimensional variable in
@@ -318,25 +320,28 @@ public final class cwstats {
     // Get region limits
     // -----------------
     if (region != null) {
-      String[] regionArray = region.split (ToolServices.SPLIT_REGEX);
-      if (regionArray.length != 3) {
-        System.err.println (PROG + ": Invalid region '" + region + "'");
+
+      /**
+       * Both the center and radius form and the box form go through
+       * the earth region bounds, so that the data rectangle sampled
+       * here is the same one that cwexport and the other tools select
+       * for the same region.
+       */
+      EarthRegion earthRegion = null;
+      try { earthRegion = EarthRegion.parse (region, ToolServices.SPLIT_REGEX); }
+      catch (IllegalArgumentException e) {
+        System.err.println (PROG + ": " + e.getMessage());
         System.exit (2);
-      } // if
-      EarthLocation centerLoc = new EarthLocation (
-        Double.parseDouble (regionArray[0]),
-        Double.parseDouble (regionArray[1])
-      );
-      double radius = Double.parseDouble (regionArray[2]);
-      Subregion subregion = new Subregion (centerLoc, radius);
-      start = new DataLocation (2);
-      end = new DataLocation (2);
-      boolean success = subregion.getLimits (reader.getInfo().getTransform(),
-        start, end);
-      if (!success) {
-        System.err.println (PROG + ": Error getting region limits");
+      } // catch
+      int[][] bounds = reader.getRegionBounds (earthRegion);
+      if (bounds == null) {
+        System.err.println (PROG + ": Region does not intersect data");
         System.exit (2);
       } // if
+      start = new DataLocation (bounds[0][0], bounds[0][1]);
+      end = new DataLocation (bounds[0][0] + bounds[1][0] - 1,
+        bounds[0][1] + bounds[1][1] - 1);
+
     } // if
 
     // Get polygon point data
@@ -522,9 +527,10 @@ public final class cwstats {
 "\n" +
 "Options:\n" +
 "  -h, --help                 Show this help message.\n" +
-"  -i, --region=LAT/LON/RADIUS\n" +
+"  -i, --region=LAT/LON/RADIUS | MINLAT/MINLON/MAXLAT/MAXLON\n" +
 "                             Only compute statistics for data values\n" +
-"                              within so many kilometers of a location.\n" +
+"                              within so many kilometers of a location,\n" +
+"                              or within a latitude/longitude box.\n" +
 "  -l, --limit=STARTROW/STARTCOL/ENDROW/ENDCOL\n" +
 "                             Only compute statistics for data values\n" +
 "                              between the limits.\n" +
@@ -167,6 +167,7 @@ public class cwtoolstest {
       sysOut.println (runTest ("cwregister2", true, new String[] {}));
       sysOut.println (runTest ("cwrender", true, new String[] {}));
       sysOut.println (runTest ("cwsample", true, new String[] {}));
+      sysOut.println (runTest ("cwseries", true, new String[] {}));
       sysOut.println (runTest ("cwscript", true, new String[] {}));
       sysOut.println (runTest ("cwstats", true, new String[] {}));
       sysOut.println (runTest ("hdatt", true, new String[] {}));
@@ -26,10 +26,19 @@ package noaa.coastwatch.util;
 //Imports
 //-------
 import java.awt.geom.AffineTransform;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import noaa.coastwatch.util.chunk.ChunkOperation;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkingScheme;
+import noaa.coastwatch.util.chunk.PoolProcessor;
 import noaa.coastwatch.util.trans.EarthTransform;
 
-// TODO: Should we improve the speed of this routine as well, using less
-// dynamic memory calls?  See InverseGridResampler.java
+// Testing
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.trans.GCTP;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
 
 /**
  * The <code>ACSPOInverseGridResampler</code> class performs generic data
@@ -50,6 +59,10 @@ import noaa.coastwatch.util.trans.EarthTransform;
  * 
  * </ol>
  *
+ * The destination grid is processed in tiles by a pool of threads.  The
+ * source coordinates for each tile are computed into primitive arrays,
+ * and then the data for all grids in the tile is copied at once.
+ *
  * @author Xiaoming Liu
  * @since 3.3.0
  *
@@ -57,9 +70,16 @@ import noaa.coastwatch.util.trans.EarthTransform;
  * the exact same operation as this class.
  */
 @Deprecated
+@noaa.coastwatch.test.Testable
 public class ACSPOInverseGridResampler
 	extends GridResampler{
 	
+	  // Constants
+	  // ---------
+
+	  /** The destination tile size in rows and columns. */
+	  private static final int TILE_SIZE = 256;
+
 	  // Variables
 	  // ---------
 
@@ -68,6 +88,43 @@ public class ACSPOInverseGridResampler
 
 	  ////////////////////////////////////////////////////////////
 
+	  /** Holds the reusable storage for one resampling thread. */
+	  private static class TileBuffer {
+
+	    /** The destination transform for this thread. */
+	    public EarthTransform destTrans;
+
+	    /** The location estimator for this thread. */
+	    public LocationEstimator estimator;
+
+	    /** The source row for each tile location. */
+	    public int[] rowMap = new int[TILE_SIZE*TILE_SIZE];
+
+	    /** The source column for each tile location. */
+	    public int[] colMap = new int[TILE_SIZE*TILE_SIZE];
+
+	    /** The temporary destination location. */
+	    public DataLocation destLoc = new DataLocation (2);
+
+	    /** The temporary source location. */
+	    public DataLocation sourceLoc = new DataLocation (2);
+
+	    /** The temporary earth location. */
+	    public EarthLocation earthLoc = new EarthLocation();
+
+	    /** The temporary coordinate array. */
+	    public double[] coords = new double[2];
+
+	    /** Creates a buffer using the specified transform and estimator. */
+	    public TileBuffer (EarthTransform destTrans, LocationEstimator estimator) {
+	      this.destTrans = destTrans;
+	      this.estimator = estimator;
+	    } // TileBuffer constructor
+
+	  } // TileBuffer class
+
+	  ////////////////////////////////////////////////////////////
+
 	  /**
 	   * Creates a new grid resampler from the specified source and
 	   * destination transforms.
@@ -91,6 +148,103 @@ public class ACSPOInverseGridResampler
 	  
 	  ////////////////////////////////////////////////////////////
 
+	  /**
+	   * Computes the nearest neighbour source coordinates for a tile of
+	   * destination locations.  The row and column map entries are set to
+	   * Integer.MIN_VALUE where the destination location has no source.
+	   *
+	   * @param sourceDims the source grid dimensions.
+	   * @param pos the destination tile position.
+	   * @param buffer the buffer holding the transform and estimator to
+	   * use, and the row and column maps to fill.
+	   */
+	  private static void mapTile (
+	    int[] sourceDims,
+	    ChunkPosition pos,
+	    TileBuffer buffer
+	  ) {
+
+	    int index = 0;
+	    int endRow = pos.start[Grid.ROWS] + pos.length[Grid.ROWS];
+	    int endCol = pos.start[Grid.COLS] + pos.length[Grid.COLS];
+	    for (int i = pos.start[Grid.ROWS]; i < endRow; i++) {
+	      for (int j = pos.start[Grid.COLS]; j < endCol; j++) {
+
+	        // Get source location
+	        // -------------------
+	        buffer.destLoc.set (Grid.ROWS, i);
+	        buffer.destLoc.set (Grid.COLS, j);
+	        buffer.destTrans.transform (buffer.destLoc, buffer.earthLoc);
+	        boolean sourceValid = false;
+	        if (buffer.earthLoc.isValid()) {
+	          buffer.estimator.getLocation (buffer.destLoc, buffer.sourceLoc,
+	            buffer.earthLoc, buffer.coords);
+	          sourceValid = buffer.sourceLoc.isValid();
+	        } // if
+
+	        // Save nearest neighbour source coordinate
+	        // ----------------------------------------
+	        if (sourceValid) {
+
+	          // need to get all pixels on the four edges
+	          int sourceRow = (int) Math.round (buffer.sourceLoc.get(Grid.ROWS));
+	          if(sourceRow == -1) sourceRow = 0;
+	          if(sourceRow == sourceDims[Grid.ROWS]) sourceRow = sourceDims[Grid.ROWS] - 1;
+
+	          int sourceCol = (int) Math.round (buffer.sourceLoc.get(Grid.COLS));
+	          if(sourceCol == -1) sourceCol = 0;
+	          if(sourceCol == sourceDims[Grid.COLS]) sourceCol = sourceDims[Grid.COLS] - 1;
+
+	          buffer.rowMap[index] = sourceRow;
+	          buffer.colMap[index] = sourceCol;
+
+	        } // if
+	        else {
+	          buffer.rowMap[index] = Integer.MIN_VALUE;
+	          buffer.colMap[index] = Integer.MIN_VALUE;
+	        } // else
+	        index++;
+
+	      } // for
+	    } // for
+
+	  } // mapTile
+
+	  ////////////////////////////////////////////////////////////
+
+	  /**
+	   * Copies data values for a tile of destination locations.
+	   *
+	   * @param source the source grid.
+	   * @param dest the destination grid.
+	   * @param pos the destination tile position.
+	   * @param buffer the buffer of source coordinates from
+	   * {@link #mapTile}.
+	   */
+	  private static void copyTile (
+	    Grid source,
+	    Grid dest,
+	    ChunkPosition pos,
+	    TileBuffer buffer
+	  ) {
+
+	    int index = 0;
+	    int endRow = pos.start[Grid.ROWS] + pos.length[Grid.ROWS];
+	    int endCol = pos.start[Grid.COLS] + pos.length[Grid.COLS];
+	    for (int i = pos.start[Grid.ROWS]; i < endRow; i++) {
+	      for (int j = pos.start[Grid.COLS]; j < endCol; j++) {
+	        int sourceRow = buffer.rowMap[index];
+	        double val = (sourceRow == Integer.MIN_VALUE ? Double.NaN :
+	          source.getValue (sourceRow, buffer.colMap[index]));
+	        dest.setValue (i, j, val);
+	        index++;
+	      } // for
+	    } // for
+
+	  } // copyTile
+
+	  ////////////////////////////////////////////////////////////
+
 	  public void perform (
 	    boolean verbose
 	  ) {
@@ -123,69 +277,149 @@ public class ACSPOInverseGridResampler
 	    LocationEstimator estimator = new LocationEstimator (destTrans,
 	      destDims, sourceTrans, sourceDims, sourceNav, polySize);
 
-	    // TODO: This loop needs to be made more efficient.  One way would
-	    // be to eliminate the dynamic memory allocation performed when
-	    // creating and transforming each new DataLocation.  That would
-	    // require changes here, and in LocationEstimator, and possibly
-	    // EarthTransform by adding transform() methods that take two
-	    // arguments -- a source and destination for the transformed
-	    // point.
+	    // Create destination tiles
+	    // ------------------------
+	    ChunkingScheme scheme = new ChunkingScheme (destDims,
+	      new int[] {TILE_SIZE, TILE_SIZE});
+	    List<ChunkPosition> positions = new ArrayList<ChunkPosition>();
+	    for (ChunkPosition pos : scheme) positions.add (pos);
+	    int tiles = positions.size();
+	    if (verbose) 
+	      System.out.println (this.getClass() + ": Resampling " + tiles + 
+	        " tile(s) of size " + TILE_SIZE + "x" + TILE_SIZE);
 
-	    // Loop over each destination location
-	    // -----------------------------------
-	    for (int i = 0; i < destDims[Grid.ROWS]; i++) {
-	      if (verbose && i%100 == 0)
-	        System.out.println (this.getClass() + ": Working on output row " + i);
-	      for (int j = 0; j < destDims[Grid.COLS]; j++) {
+	    // Create tile operation
+	    // ---------------------
+	    /**
+	     * The source coordinates are computed in parallel, but the
+	     * transforms keep intermediate values between calls, so each
+	     * thread gets cloned transforms and its own copy of the location
+	     * estimator that shares the polynomials.  The grids themselves may
+	     * be cached grids that are not thread-safe, so the copying of each
+	     * tile is done while holding a lock over all the grids.
+	     */
+	    final ThreadLocal<TileBuffer> bufferLocal = ThreadLocal.withInitial (() -> {
+	      EarthTransform threadDestTrans = (EarthTransform) destTrans.clone();
+	      return (new TileBuffer (threadDestTrans, estimator.copyWithTransforms (
+	        threadDestTrans, (EarthTransform) sourceTrans.clone())));
+	    });
+	    final Object gridLock = new Object();
+	    final AtomicInteger completed = new AtomicInteger();
+	    ChunkOperation op = new ChunkOperation() {
+	      public void perform (ChunkPosition pos) {
 
-	        // Get source location
-	        // -------------------
-	        DataLocation destLoc = new DataLocation (i, j);
-	        boolean destValid = destTrans.transform(destLoc).isValid();
-	        DataLocation sourceLoc = (destValid ? 
-	          estimator.getLocation (destLoc) : null);
-	        boolean sourceValid = (sourceLoc != null && 
-	        		sourceLoc.isValid());	
-//	          sourceLoc.isValid() && sourceLoc.isContained (sourceDims));
+	        TileBuffer buffer = bufferLocal.get();
+	        mapTile (sourceDims, pos, buffer);
+	        synchronized (gridLock) {
+	          for (int k = 0; k < grids; k++)
+	            copyTile (sourceArray[k], destArray[k], pos, buffer);
+	        } // synchronized
 
-	        // Copy data value
-	        // ---------------
-	        if (sourceValid) {
-	 
-	          // Get nearest neighbour source coordinate
-	          // need to get all pixels on the four edges
-	          int sourceRow = (int) Math.round (sourceLoc.get(Grid.ROWS));
-	          if(sourceRow == -1) sourceRow = 0;
-	          if(sourceRow == sourceDims[Grid.ROWS]) sourceRow = sourceDims[Grid.ROWS] - 1;
-	          
-	          int sourceCol = (int) Math.round (sourceLoc.get(Grid.COLS));
-	          if(sourceCol == -1) sourceCol = 0;
-	          if(sourceCol == sourceDims[Grid.COLS]) sourceCol = sourceDims[Grid.COLS] - 1;
-	          
-	          // Loop over each grid
-	          // -------------------
-	          for (int k = 0; k < grids; k++) {
-	            double val = sourceArray[k].getValue (sourceRow, sourceCol);
-	            destArray[k].setValue (i, j, val);
-	          } // for
+	        int done = completed.incrementAndGet();
+	        if (verbose && (done % 10 == 0 || done == tiles))
+	          System.out.println (ACSPOInverseGridResampler.this.getClass() + 
+	            ": Completed " + done + " of " + tiles + " tile(s)");
 
-	        } // if
+	      } // perform
+	    };
 
-	        // Set missing value
-	        // -----------------
-	        else {
+	    // Perform resampling
+	    // ------------------
+	    PoolProcessor processor = new PoolProcessor();
+	    processor.init (positions, op);
+	    processor.start();
+	    processor.waitForCompletion();
 
-	          // Loop over each grid
-	          // -------------------
-	          for (int k = 0; k < grids; k++) {
-	            destArray[k].setValue (i, j, Double.NaN);
-	          } // for
+	  } // perform
 
-	        } // else
+	  ////////////////////////////////////////////////////////////
+
+	  /**
+	   * Tests this class.
+	   *
+	   * @param argv the array of command line parameters.
+	   */
+	  public static void main (String[] argv) throws Exception {
+
+	    TestLogger logger = TestLogger.getInstance();
+	    logger.startClass (ACSPOInverseGridResampler.class);
+
+	    // ------------------------->
 
+	    logger.test ("perform");
+
+	    /**
+	     * The destination covers a larger area than the source at a finer
+	     * resolution and spans several tiles, so that some destination
+	     * locations round to source row or column -1 or N and are clamped
+	     * to the edge, and some fall outside the source entirely.
+	     */
+	    MapProjectionFactory factory = MapProjectionFactory.getInstance();
+	    double[] params = new double[15];
+	    int[] sourceDims = new int[] {100, 120};
+	    EarthTransform sourceTrans = factory.create (GCTP.GEO, 0, params,
+	      GCTP.WGS84, sourceDims, new EarthLocation (0, 0),
+	      new double[] {0.1, 0.1});
+	    int[] destDims = new int[] {600, 700};
+	    EarthTransform destTrans = factory.create (GCTP.GEO, 0, params,
+	      GCTP.WGS84, destDims, new EarthLocation (0, 0),
+	      new double[] {0.02, 0.02});
+
+	    float[] sourceData = new float[sourceDims[Grid.ROWS]*sourceDims[Grid.COLS]];
+	    for (int i = 0; i < sourceData.length; i++) sourceData[i] = i;
+	    Grid source = new Grid ("test", "test data", "none",
+	      sourceDims[Grid.ROWS], sourceDims[Grid.COLS], sourceData,
+	      new java.text.DecimalFormat ("0"), null, Float.valueOf (Float.NaN));
+	    Grid dest = new Grid (source, destDims[Grid.ROWS], destDims[Grid.COLS]);
+	    dest.setData (new float[destDims[Grid.ROWS]*destDims[Grid.COLS]]);
+
+	    double polySize = 50;
+	    ACSPOInverseGridResampler resampler = new ACSPOInverseGridResampler (
+	      sourceTrans, destTrans, polySize);
+	    resampler.addGrid (source, dest);
+	    resampler.perform (false);
+
+	    // Compute the expected values using the original serial loop
+	    // ----------------------------------------------------------
+	    LocationEstimator estimator = new LocationEstimator (destTrans,
+	      destDims, sourceTrans, sourceDims, null, polySize);
+	    float[] expected = new float[destDims[Grid.ROWS]*destDims[Grid.COLS]];
+	    int clamped = 0, outside = 0;
+	    for (int i = 0; i < destDims[Grid.ROWS]; i++) {
+	      for (int j = 0; j < destDims[Grid.COLS]; j++) {
+	        DataLocation destLoc = new DataLocation (i, j);
+	        boolean destValid = destTrans.transform (destLoc).isValid();
+	        DataLocation sourceLoc = (destValid ?
+	          estimator.getLocation (destLoc) : null);
+	        double val = Double.NaN;
+	        if (sourceLoc != null && sourceLoc.isValid()) {
+	          int sourceRow = (int) Math.round (sourceLoc.get (Grid.ROWS));
+	          int sourceCol = (int) Math.round (sourceLoc.get (Grid.COLS));
+	          if (sourceRow == -1 || sourceRow == sourceDims[Grid.ROWS] ||
+	            sourceCol == -1 || sourceCol == sourceDims[Grid.COLS]) clamped++;
+	          if (sourceRow == -1) sourceRow = 0;
+	          if (sourceRow == sourceDims[Grid.ROWS]) sourceRow = sourceDims[Grid.ROWS] - 1;
+	          if (sourceCol == -1) sourceCol = 0;
+	          if (sourceCol == sourceDims[Grid.COLS]) sourceCol = sourceDims[Grid.COLS] - 1;
+	          val = source.getValue (sourceRow, sourceCol);
+	        } // if
+	        if (Double.isNaN (val)) outside++;
+	        expected[i*destDims[Grid.COLS] + j] = (float) val;
 	      } // for
 	    } // for
+	    assert (clamped > 0);
+	    assert (outside > 0);
+
+	    float[] actual = (float[]) dest.getData();
+	    for (int i = 0; i < expected.length; i++)
+	      assert (Float.floatToIntBits (actual[i]) == Float.floatToIntBits (expected[i]));
+
+	    logger.passed();
+
+	    // ------------------------->
+
+	  } // main
+
+	  ////////////////////////////////////////////////////////////
 
-	  } // perform
-	
 }
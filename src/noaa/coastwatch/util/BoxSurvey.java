@@ -31,10 +31,10 @@ import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.EarthDataSurvey;
 import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.RowSpanSampler;
 import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.trans.EarthTransform;
 import noaa.coastwatch.util.DataLocationConstraints;
-import noaa.coastwatch.util.VariableStatisticsGenerator;
 
 /**
  * The <code>BoxSurvey</code> class holds survey information for a
@@ -143,7 +143,7 @@ public class BoxSurvey
     lc.end = end;
     lc.fraction = 0.01;
     lc.minCount = 1000;
-    Statistics stats = VariableStatisticsGenerator.getInstance().generate (variable, lc);
+    Statistics stats = RowSpanSampler.generate (variable, lc);
 
     // Initialize
     // ----------
@@ -89,8 +89,10 @@ public class DataLocationIteratorFactory {
    * @return the optimal stride vector.  The number of values iterated over 
    * using the optimal stride is guaranteed to be bounded below by the
    * fraction value or the minimum count, whichever is greater.
+   *
+   * @since Public as of 3.7.0.
    */
-  private int[] getOptimalStride (
+  public int[] getOptimalStride (
     DataLocation start,
     DataLocation end,
     double fraction,
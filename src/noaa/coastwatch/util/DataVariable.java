@@ -730,10 +730,13 @@ public abstract class DataVariable
   /**
    * Gets the data variable statistics.  The computed statistics
    * include the number of valid data values sampled, minimum,
-   * maximum, mean, and standard deviation.
+   * maximum, mean, and standard deviation.  If a statistics summary
+   * over all the data values is stored with the variable (see
+   * {@link #getStoredStatistics}), it is returned regardless of the
+   * sample size, since it is exact and needs no data to be read.
    *
    * @param factor the sample size as a fraction of the total number of
-   * values.  For example, to sample 1 percent of the data the sample
+   * values, used only when no stored summary is available.  For example, to sample 1 percent of the data the sample
    * size is 0.01.  The sample size is used to compute an optimal
    * stride while preserving sample frequency uniformity in each
    * dimension.  The total number of sampled values is guaranteed to
@@ -741,20 +744,45 @@ public abstract class DataVariable
    * 
    * @return the data statistics.  If the number of valid data values
    * is zero, the minimum, maximum, mean, and standard deviation
-   * values are undefined.  
+   * values are undefined.
    *
    * @see #getStatistics(int[])
+   * @see #getStoredStatistics
    */
   public Statistics getStatistics (
     double factor
   ) {
 
-    return (getStatistics (null, null, factor));
+    Statistics stats = getStoredStatistics();
+    if (stats == null) stats = getStatistics (null, null, factor);
+    return (stats);
 
   } // getStatistics
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the statistics summary stored in the variable metadata.  A
+   * summary may be stored by a data writer that computes statistics
+   * over all the data values as it writes them (see
+   * {@link Statistics#fromAttributes}).
+   *
+   * @return the stored statistics, or null if there is no stored
+   * summary or the summary does not cover the same number of data
+   * values as this variable.
+   *
+   * @since 3.7.0
+   */
+  public Statistics getStoredStatistics () {
+
+    Statistics stats = Statistics.fromAttributes (getMetadataMap());
+    if (stats != null && stats.getValues() != getValues()) stats = null;
+    return (stats);
+
+  } // getStoredStatistics
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Gets the optimal statistical sampling stride for this variable
    * based on a desired sampling factor and minimum number of values.
@@ -1027,6 +1055,7 @@ public abstract class DataVariable
     // Modify units and scaling
     // ------------------------
     units = newUnitSpec;
+    Statistics.removeAttributes (getMetadataMap());
     if (scaling == null) scaling = new double[] {1, 0};
     scaling[1] = scaling[1] - b/(scaling[0]*a);
     scaling[0] = a*scaling[0];
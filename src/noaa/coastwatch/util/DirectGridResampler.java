@@ -25,14 +25,24 @@ package noaa.coastwatch.util;
 
 // Imports
 // -------
-import java.awt.geom.AffineTransform;
+import java.util.ArrayList;
 import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.concurrent.atomic.AtomicLong;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.EarthLocation;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.GridResampler;
+import noaa.coastwatch.util.chunk.ChunkOperation;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkingScheme;
+import noaa.coastwatch.util.chunk.PoolProcessor;
 import noaa.coastwatch.util.trans.EarthTransform;
 
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.trans.GCTP;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+
 import java.util.logging.Logger;
 import java.util.logging.Level;
 
@@ -54,17 +64,85 @@ import java.util.logging.Level;
  * {@link EarthTransform} objects that compute forward and inverse transforms
  * relatively quickly.</p>
  *
+ * <p>When a maximum interpolation error is set, the source coordinates are
+ * computed exactly only at the corners of each destination rectangle, and
+ * bilinearly interpolated in between.  The interpolation is checked against
+ * exact transforms at the rectangle edge midpoints and center, and the
+ * rectangle is divided into four until the error is within the maximum.
+ * This greatly reduces the number of transforms for reprojections between
+ * smooth map projections.  It should not be used with source or destination
+ * transforms that have discontinuities, such as swath data with scan
+ * overlap.  In this mode the destination is processed in tiles by a pool
+ * of threads, each with its own copy of the source and destination
+ * transforms.  Otherwise the tiles are processed in order on the calling
+ * thread using the transforms directly.</p>
+ *
  * <p><b>WARNING: This class is not thread-safe.</b></p>
  *
  * @author Peter Hollemans
  * @since 3.3.2
  */
+@noaa.coastwatch.test.Testable
 public class DirectGridResampler 
   extends GridResampler {
 
   private static final Logger LOGGER = Logger.getLogger (DirectGridResampler.class.getName());
   private static final Logger VERBOSE = Logger.getLogger (DirectGridResampler.class.getName() + ".verbose");
 
+  // Constants
+  // ---------
+
+  /** The destination tile size in rows and columns. */
+  private static final int TILE_SIZE = 256;
+
+  /** The rectangle size below which source coordinates are always exact. */
+  private static final int MIN_RECT_SIZE = 4;
+
+  // Variables
+  // ---------
+
+  /** The maximum interpolation error in source pixels, or 0 for none. */
+  private double maxError;
+
+  /** The number of exact transforms computed in the last resampling. */
+  private AtomicLong exactTransforms = new AtomicLong();
+
+  ////////////////////////////////////////////////////////////
+
+  /** Holds the reusable storage for one resampling thread. */
+  private static class TileBuffer {
+
+    /** The source transform for use by the thread. */
+    public EarthTransform sourceTrans;
+
+    /** The destination transform for use by the thread. */
+    public EarthTransform destTrans;
+
+    /** The source row for each tile location. */
+    public int[] rowMap = new int[TILE_SIZE*TILE_SIZE];
+
+    /** The source column for each tile location. */
+    public int[] colMap = new int[TILE_SIZE*TILE_SIZE];
+
+    /** The temporary destination location. */
+    public DataLocation destLoc = new DataLocation (2);
+
+    /** The temporary source location. */
+    public DataLocation sourceLoc = new DataLocation (2);
+
+    /** The temporary earth location. */
+    public EarthLocation earthLoc = new EarthLocation();
+
+    /** The number of exact transforms computed for the current tile. */
+    public long transforms;
+
+    public TileBuffer (EarthTransform sourceTrans, EarthTransform destTrans) {
+      this.sourceTrans = sourceTrans;
+      this.destTrans = destTrans;
+    } // TileBuffer constructor
+
+  } // TileBuffer class
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -87,6 +165,311 @@ public class DirectGridResampler
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Sets the maximum interpolation error.  By default the error is 0 and
+   * every source coordinate is computed exactly.
+   *
+   * @param pixels the maximum error in source pixels between interpolated
+   * and exact source coordinates at the check points of each rectangle,
+   * or 0 to compute all source coordinates exactly.
+   *
+   * @since 3.7.0
+   */
+  public void setMaxError (double pixels) { maxError = pixels; }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the number of exact source coordinate transforms computed in
+   * the most recent call to {@link #perform}.
+   *
+   * @return the number of exact transforms.
+   *
+   * @since 3.7.0
+   */
+  public long getExactTransforms () { return (exactTransforms.get()); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the exact source coordinates for a destination location.
+   *
+   * @param row the destination row.
+   * @param col the destination column.
+   * @param buffer the buffer for temporary storage.
+   * @param coords the source coordinates as [row, col] (modified).
+   *
+   * @return true if the source coordinates are valid, or false if not.
+   */
+  private boolean transform (
+    int row,
+    int col,
+    TileBuffer buffer,
+    double[] coords
+  ) {
+
+    buffer.transforms++;
+    buffer.destLoc.set (Grid.ROWS, row);
+    buffer.destLoc.set (Grid.COLS, col);
+    buffer.destTrans.transform (buffer.destLoc, buffer.earthLoc);
+    boolean isValid = false;
+    if (buffer.earthLoc.isValid()) {
+      buffer.sourceTrans.transform (buffer.earthLoc, buffer.sourceLoc);
+      if (buffer.sourceLoc.isValid()) {
+        coords[Grid.ROWS] = buffer.sourceLoc.get (Grid.ROWS);
+        coords[Grid.COLS] = buffer.sourceLoc.get (Grid.COLS);
+        isValid = true;
+      } // if
+    } // if
+
+    return (isValid);
+
+  } // transform
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Stores the nearest neighbour source coordinate for a tile location.
+   *
+   * @param index the tile location index.
+   * @param row the source row, or NaN if invalid.
+   * @param col the source column, or NaN if invalid.
+   * @param sourceDims the source grid dimensions.
+   * @param buffer the buffer to store the coordinate.
+   */
+  private static void store (
+    int index,
+    double row,
+    double col,
+    int[] sourceDims,
+    TileBuffer buffer
+  ) {
+
+    DataLocation sourceLoc = buffer.sourceLoc;
+    sourceLoc.set (Grid.ROWS, row);
+    sourceLoc.set (Grid.COLS, col);
+    if (sourceLoc.isValid() && sourceLoc.isContained (sourceDims)) {
+      buffer.rowMap[index] = (int) Math.round (row);
+      buffer.colMap[index] = (int) Math.round (col);
+    } // if
+    else {
+      buffer.rowMap[index] = Integer.MIN_VALUE;
+      buffer.colMap[index] = Integer.MIN_VALUE;
+    } // else
+
+  } // store
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Maps a rectangle of destination locations to source coordinates
+   * using exact transforms.
+   *
+   * @param pos the destination tile position.
+   * @param startRow the rectangle starting row.
+   * @param startCol the rectangle starting column.
+   * @param rows the rectangle rows.
+   * @param cols the rectangle columns.
+   * @param sourceDims the source grid dimensions.
+   * @param buffer the buffer to store the source coordinates.
+   */
+  private void mapExact (
+    ChunkPosition pos,
+    int startRow,
+    int startCol,
+    int rows,
+    int cols,
+    int[] sourceDims,
+    TileBuffer buffer
+  ) {
+
+    double[] coords = new double[2];
+    for (int i = startRow; i < startRow + rows; i++) {
+      int index = (i - pos.start[Grid.ROWS])*pos.length[Grid.COLS] + 
+        (startCol - pos.start[Grid.COLS]);
+      for (int j = startCol; j < startCol + cols; j++) {
+        if (transform (i, j, buffer, coords))
+          store (index, coords[Grid.ROWS], coords[Grid.COLS], sourceDims, buffer);
+        else
+          store (index, Double.NaN, Double.NaN, sourceDims, buffer);
+        index++;
+      } // for
+    } // for
+
+  } // mapExact
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Maps a rectangle of destination locations to source coordinates
+   * using bilinear interpolation between exact corner coordinates,
+   * dividing the rectangle if the interpolation error is too large.
+   *
+   * @param pos the destination tile position.
+   * @param startRow the rectangle starting row.
+   * @param startCol the rectangle starting column.
+   * @param rows the rectangle rows.
+   * @param cols the rectangle columns.
+   * @param sourceDims the source grid dimensions.
+   * @param buffer the buffer to store the source coordinates.
+   */
+  private void mapInterpolated (
+    ChunkPosition pos,
+    int startRow,
+    int startCol,
+    int rows,
+    int cols,
+    int[] sourceDims,
+    TileBuffer buffer
+  ) {
+
+    // Check for small rectangle
+    // -------------------------
+    if (rows <= MIN_RECT_SIZE && cols <= MIN_RECT_SIZE) {
+      mapExact (pos, startRow, startCol, rows, cols, sourceDims, buffer);
+      return;
+    } // if
+
+    // Get corner coordinates
+    // ----------------------
+    int endRow = startRow + rows - 1;
+    int endCol = startCol + cols - 1;
+    double[][] corners = new double[4][2];
+    boolean isValid = 
+      transform (startRow, startCol, buffer, corners[0]) &&
+      transform (startRow, endCol, buffer, corners[1]) &&
+      transform (endRow, startCol, buffer, corners[2]) &&
+      transform (endRow, endCol, buffer, corners[3]);
+
+    // Check interpolation error
+    // -------------------------
+    if (isValid) {
+      int midRow = (startRow + endRow)/2;
+      int midCol = (startCol + endCol)/2;
+      int[][] checks = new int[][] {
+        {startRow, midCol},
+        {endRow, midCol},
+        {midRow, startCol},
+        {midRow, endCol},
+        {midRow, midCol}
+      };
+      double[] exact = new double[2];
+      double[] interp = new double[2];
+      for (int k = 0; k < checks.length && isValid; k++) {
+        isValid = transform (checks[k][0], checks[k][1], buffer, exact);
+        if (isValid) {
+          interpolate (corners, startRow, startCol, endRow, endCol,
+            checks[k][0], checks[k][1], interp);
+          isValid = (
+            Math.abs (interp[Grid.ROWS] - exact[Grid.ROWS]) <= maxError &&
+            Math.abs (interp[Grid.COLS] - exact[Grid.COLS]) <= maxError
+          );
+        } // if
+      } // for
+    } // if
+
+    // Fill rectangle with interpolated coordinates
+    // --------------------------------------------
+    if (isValid) {
+      double[] interp = new double[2];
+      for (int i = startRow; i <= endRow; i++) {
+        int index = (i - pos.start[Grid.ROWS])*pos.length[Grid.COLS] + 
+          (startCol - pos.start[Grid.COLS]);
+        for (int j = startCol; j <= endCol; j++) {
+          interpolate (corners, startRow, startCol, endRow, endCol, i, j, interp);
+          store (index, interp[Grid.ROWS], interp[Grid.COLS], sourceDims, buffer);
+          index++;
+        } // for
+      } // for
+    } // if
+
+    // Divide rectangle
+    // ----------------
+    else {
+      int topRows = (rows <= MIN_RECT_SIZE ? rows : rows/2);
+      int leftCols = (cols <= MIN_RECT_SIZE ? cols : cols/2);
+      mapInterpolated (pos, startRow, startCol, topRows, leftCols, sourceDims, buffer);
+      if (leftCols < cols)
+        mapInterpolated (pos, startRow, startCol + leftCols, topRows, cols - leftCols, sourceDims, buffer);
+      if (topRows < rows) {
+        mapInterpolated (pos, startRow + topRows, startCol, rows - topRows, leftCols, sourceDims, buffer);
+        if (leftCols < cols)
+          mapInterpolated (pos, startRow + topRows, startCol + leftCols, rows - topRows, cols - leftCols, sourceDims, buffer);
+      } // if
+    } // else
+
+  } // mapInterpolated
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Interpolates source coordinates bilinearly between rectangle corners.
+   *
+   * @param corners the corner source coordinates as [top-left, top-right,
+   * bottom-left, bottom-right][row, col].
+   * @param startRow the rectangle starting row.
+   * @param startCol the rectangle starting column.
+   * @param endRow the rectangle ending row (inclusive).
+   * @param endCol the rectangle ending column (inclusive).
+   * @param row the destination row to interpolate.
+   * @param col the destination column to interpolate.
+   * @param coords the interpolated source coordinates (modified).
+   */
+  private static void interpolate (
+    double[][] corners,
+    int startRow,
+    int startCol,
+    int endRow,
+    int endCol,
+    int row,
+    int col,
+    double[] coords
+  ) {
+
+    double u = (endRow == startRow ? 0 : (double) (row - startRow) / (endRow - startRow));
+    double v = (endCol == startCol ? 0 : (double) (col - startCol) / (endCol - startCol));
+    for (int k = 0; k < 2; k++) {
+      double top = corners[0][k] + v*(corners[1][k] - corners[0][k]);
+      double bottom = corners[2][k] + v*(corners[3][k] - corners[2][k]);
+      coords[k] = top + u*(bottom - top);
+    } // for
+
+  } // interpolate
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Copies data values for a tile of destination locations.
+   *
+   * @param source the source grid.
+   * @param dest the destination grid.
+   * @param pos the destination tile position.
+   * @param buffer the buffer of source coordinates.
+   */
+  private static void copyTile (
+    Grid source,
+    Grid dest,
+    ChunkPosition pos,
+    TileBuffer buffer
+  ) {
+
+    int index = 0;
+    int endRow = pos.start[Grid.ROWS] + pos.length[Grid.ROWS];
+    int endCol = pos.start[Grid.COLS] + pos.length[Grid.COLS];
+    for (int i = pos.start[Grid.ROWS]; i < endRow; i++) {
+      for (int j = pos.start[Grid.COLS]; j < endCol; j++) {
+        int sourceRow = buffer.rowMap[index];
+        double val = (sourceRow == Integer.MIN_VALUE ? Double.NaN :
+          source.getValue (sourceRow, buffer.colMap[index]));
+        dest.setValue (i, j, val);
+        index++;
+      } // for
+    } // for
+
+  } // copyTile
+
+  ////////////////////////////////////////////////////////////
+
   @Override
   public void perform (
     boolean verbose
@@ -107,71 +490,244 @@ public class DirectGridResampler
     int[] sourceDims = sourceArray[0].getDimensions();
     int[] destDims = destArray[0].getDimensions();
 
-    // Loop over each destination location
-    // -----------------------------------
+    // Create destination tiles
+    // ------------------------
     VERBOSE.info ("Resampling to " +
       destDims[Grid.ROWS] + "x" + destDims[Grid.COLS] + " from " +
-      sourceDims[Grid.ROWS] + "x" + sourceDims[Grid.COLS]);
-    DataLocation destLoc = new DataLocation (2);
-    DataLocation sourceLoc = new DataLocation (2);
-    EarthLocation earthLoc = new EarthLocation();
-    for (int i = 0; i < destDims[Grid.ROWS]; i++) {
-
-      // Print progress
-      // --------------
-      if ((i+1)%(destDims[Grid.ROWS]/10) == 0) {
-        int percentComplete = (int) Math.round (((i+1)*100.0/destDims[Grid.ROWS]));
-        VERBOSE.info (percentComplete + "% complete");
-      } // if
+      sourceDims[Grid.ROWS] + "x" + sourceDims[Grid.COLS] + 
+      (maxError > 0 ? " with max interpolation error " + maxError + " pixels" : ""));
+    ChunkingScheme scheme = new ChunkingScheme (destDims,
+      new int[] {TILE_SIZE, TILE_SIZE});
+    List<ChunkPosition> positions = new ArrayList<ChunkPosition>();
+    for (ChunkPosition pos : scheme) positions.add (pos);
+    int tiles = positions.size();
+    exactTransforms.set (0);
+
+    // Create tile operation
+    // ---------------------
+    /**
+     * In interpolated mode the source coordinates for each tile are
+     * computed in parallel, and each thread uses its own copy of the
+     * transforms since some transforms keep intermediate values between
+     * calls.  The grids may be cached grids that are not thread-safe, so
+     * the data values for each tile are copied while holding a lock over
+     * all the grids.
+     */
+    boolean isParallel = (maxError > 0);
+    ThreadLocal<TileBuffer> bufferLocal = ThreadLocal.withInitial (() -> 
+      isParallel ? new TileBuffer ((EarthTransform) sourceTrans.clone(),
+      (EarthTransform) destTrans.clone()) : new TileBuffer (sourceTrans, destTrans));
+    Object gridLock = new Object();
+    AtomicInteger completed = new AtomicInteger();
+    ChunkOperation op = new ChunkOperation() {
+      public void perform (ChunkPosition pos) {
+
+        TileBuffer buffer = bufferLocal.get();
+        int rows = pos.length[Grid.ROWS];
+        int cols = pos.length[Grid.COLS];
+        if (maxError > 0)
+          mapInterpolated (pos, pos.start[Grid.ROWS], pos.start[Grid.COLS], rows, cols, sourceDims, buffer);
+        else
+          mapExact (pos, pos.start[Grid.ROWS], pos.start[Grid.COLS], rows, cols, sourceDims, buffer);
+        exactTransforms.addAndGet (buffer.transforms);
+        buffer.transforms = 0;
+        synchronized (gridLock) {
+          for (int k = 0; k < grids; k++)
+            copyTile (sourceArray[k], destArray[k], pos, buffer);
+        } // synchronized
+
+        // Print progress
+        // --------------
+        int done = completed.incrementAndGet();
+        if (done*10/tiles != (done-1)*10/tiles) 
+          VERBOSE.info ((done*100/tiles) + "% complete");
+
+      } // perform
+    };
+
+    // Perform resampling
+    // ------------------
+    if (isParallel) {
+      PoolProcessor processor = new PoolProcessor();
+      processor.init (positions, op);
+      processor.start();
+      processor.waitForCompletion();
+    } // if
+    else {
+      for (ChunkPosition pos : positions) op.perform (pos);
+    } // else
+
+    long pixels = (long) destDims[Grid.ROWS] * destDims[Grid.COLS];
+    VERBOSE.info ("Computed " + exactTransforms.get() + " exact transforms for " + 
+      pixels + " pixels");
 
-      for (int j = 0; j < destDims[Grid.COLS]; j++) {
+  } // perform
 
-        // Get source location
-        // -------------------
-        destLoc.set (Grid.ROWS, i);
-        destLoc.set (Grid.COLS, j);
-        destTrans.transform (destLoc, earthLoc);
-        boolean isDestValid = earthLoc.isValid();
-        boolean isSourceValid = false;
-        if (isDestValid) {
-          sourceTrans.transform (earthLoc, sourceLoc);
-          isSourceValid = (sourceLoc.isValid() && sourceLoc.isContained (sourceDims));
-        } // if
+  ////////////////////////////////////////////////////////////
 
-        // Copy data value
-        // ---------------
-        if (isSourceValid) {
- 
-          // Get nearest neighbour source coordinate
-          // ---------------------------------------
-          int sourceRow = (int) Math.round (sourceLoc.get (Grid.ROWS));
-          int sourceCol = (int) Math.round (sourceLoc.get (Grid.COLS));
-                 
-          // Loop over each grid
-          // -------------------
-          for (int k = 0; k < grids; k++) {
-            double val = sourceArray[k].getValue (sourceRow, sourceCol);
-            destArray[k].setValue (i, j, val);
-          } // for
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (DirectGridResampler.class);
+
+    // ------------------------->
+
+    logger.test ("Framework");
+
+    /**
+     * The destination is a Mercator grid from about 2 to 34 degrees
+     * north, resampled from a geographic grid.  The source row is a
+     * nonlinear function of the destination row whose curvature grows
+     * with latitude, so that at the maximum error used here the southern
+     * tiles are interpolated as one rectangle and the northern tiles
+     * have to be divided.
+     */
+    MapProjectionFactory factory = MapProjectionFactory.getInstance();
+    double[] params = new double[15];
+    int[] sourceDims = new int[] {3400, 500};
+    EarthTransform sourceTrans = factory.create (GCTP.GEO, 0, params,
+      GCTP.WGS84, sourceDims, new EarthLocation (18.2, 0),
+      new double[] {0.01, 0.01});
+    int[] destDims = new int[] {2048, 256};
+    EarthTransform destTrans = factory.create (GCTP.MERCAT, 0, params,
+      GCTP.WGS84, destDims, new EarthLocation (20, 0),
+      new double[] {2000, 2000});
+    long pixels = (long) destDims[Grid.ROWS] * destDims[Grid.COLS];
+    double maxError = 0.85;
+
+    /**
+     * The error is only checked at the check points of each rectangle,
+     * where the error of a smooth transform is largest, so elsewhere we
+     * allow a small margin over the maximum error, plus the rounding of
+     * source coordinates to whole pixels.
+     */
+    double bound = maxError*1.1 + 0.5;
+
+    DirectGridResampler resampler = new DirectGridResampler (sourceTrans, destTrans);
+    resampler.setMaxError (maxError);
+    TileBuffer checkBuffer = new TileBuffer (sourceTrans, destTrans);
+    double[] exact = new double[2];
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("mapInterpolated");
+
+    TileBuffer buffer = new TileBuffer (sourceTrans, destTrans);
+    double[][] corners = new double[4][2];
+    double[] interp = new double[2];
+    int wholeTiles = 0, dividedTiles = 0;
+    long compared = 0;
+    for (ChunkPosition pos : new ChunkingScheme (destDims, new int[] {TILE_SIZE, TILE_SIZE})) {
+
+      // Map tile
+      // --------
+      int startRow = pos.start[Grid.ROWS];
+      int startCol = pos.start[Grid.COLS];
+      int endRow = startRow + pos.length[Grid.ROWS] - 1;
+      int endCol = startCol + pos.length[Grid.COLS] - 1;
+      buffer.transforms = 0;
+      resampler.mapInterpolated (pos, startRow, startCol, pos.length[Grid.ROWS],
+        pos.length[Grid.COLS], sourceDims, buffer);
+
+      // Check division against whole tile error
+      // ---------------------------------------
+      int midRow = (startRow + endRow)/2;
+      int midCol = (startCol + endCol)/2;
+      int[][] cornerLocs = new int[][] {
+        {startRow, startCol}, {startRow, endCol}, {endRow, startCol}, {endRow, endCol}
+      };
+      for (int k = 0; k < cornerLocs.length; k++)
+        assert (resampler.transform (cornerLocs[k][0], cornerLocs[k][1], checkBuffer, corners[k]));
+      int[][] checks = new int[][] {
+        {startRow, midCol}, {endRow, midCol}, {midRow, startCol}, {midRow, endCol}, {midRow, midCol}
+      };
+      double tileError = 0;
+      for (int k = 0; k < checks.length; k++) {
+        assert (resampler.transform (checks[k][0], checks[k][1], checkBuffer, exact));
+        interpolate (corners, startRow, startCol, endRow, endCol, checks[k][0], checks[k][1], interp);
+        tileError = Math.max (tileError, Math.abs (interp[Grid.ROWS] - exact[Grid.ROWS]));
+        tileError = Math.max (tileError, Math.abs (interp[Grid.COLS] - exact[Grid.COLS]));
+      } // for
+      if (tileError > maxError) {
+        assert (buffer.transforms > cornerLocs.length + checks.length);
+        dividedTiles++;
+      } // if
+      else {
+        assert (buffer.transforms == cornerLocs.length + checks.length);
+        wholeTiles++;
+      } // else
+
+      // Check source coordinates
+      // ------------------------
+      int index = 0;
+      for (int i = startRow; i <= endRow; i++) {
+        for (int j = startCol; j <= endCol; j++) {
+          if (buffer.rowMap[index] != Integer.MIN_VALUE &&
+            resampler.transform (i, j, checkBuffer, exact)) {
+            assert (Math.abs (buffer.rowMap[index] - exact[Grid.ROWS]) <= bound);
+            assert (Math.abs (buffer.colMap[index] - exact[Grid.COLS]) <= bound);
+            compared++;
+          } // if
+          index++;
+        } // for
+      } // for
 
-        } // if
+    } // for
+    assert (wholeTiles > 0);
+    assert (dividedTiles > 0);
+    assert (compared > pixels*9/10);
 
-        // Set missing value
-        // -----------------
-        else {
+    logger.passed();
 
-          // Loop over each grid
-          // -------------------
-          for (int k = 0; k < grids; k++) {
-            destArray[k].setValue (i, j, Double.NaN);
-          } // for
+    // ------------------------->
 
-        } // else
+    logger.test ("perform");
 
+    /**
+     * Each source value encodes its own row and column, so the resampled
+     * values give the source coordinates used for every destination
+     * location by the parallel tile processing.
+     */
+    float[] sourceData = new float[sourceDims[Grid.ROWS]*sourceDims[Grid.COLS]];
+    for (int i = 0; i < sourceDims[Grid.ROWS]; i++) {
+      for (int j = 0; j < sourceDims[Grid.COLS]; j++) {
+        sourceData[i*sourceDims[Grid.COLS] + j] = i*1000 + j;
       } // for
     } // for
+    Grid source = new Grid ("test", "test data", "none",
+      sourceDims[Grid.ROWS], sourceDims[Grid.COLS], sourceData,
+      new java.text.DecimalFormat ("0"), null, Float.valueOf (Float.NaN));
+    Grid dest = new Grid (source, destDims[Grid.ROWS], destDims[Grid.COLS]);
+    dest.setData (new float[destDims[Grid.ROWS]*destDims[Grid.COLS]]);
+    resampler.addGrid (source, dest);
+    resampler.perform (false);
+    assert (resampler.getExactTransforms() < pixels/100);
+
+    compared = 0;
+    for (int i = 0; i < destDims[Grid.ROWS]; i++) {
+      for (int j = 0; j < destDims[Grid.COLS]; j++) {
+        double val = dest.getValue (i, j);
+        if (!Double.isNaN (val) && resampler.transform (i, j, checkBuffer, exact)) {
+          int sourceRow = ((int) val) / 1000;
+          int sourceCol = ((int) val) % 1000;
+          assert (Math.abs (sourceRow - exact[Grid.ROWS]) <= bound);
+          assert (Math.abs (sourceCol - exact[Grid.COLS]) <= bound);
+          compared++;
+        } // if
+      } // for
+    } // for
+    assert (compared > pixels*9/10);
 
-  } // perform
+    logger.passed();
+
+  } // main
 
   ////////////////////////////////////////////////////////////
 
@@ -36,7 +36,8 @@ import static noaa.coastwatch.util.Grid.COL;
 /**
  * <p>The <code>DirectResamplingMapFactory</code> class creates a resampling
  * map by directly querying the source transform for the data location of
- * each earth location in the destination transform.</p>
+ * each earth location in the destination transform.  The maps created
+ * also hold the fractional source coordinates for interpolation.</p>
  *
  * @author Peter Hollemans
  * @since 3.5.0
@@ -84,6 +85,8 @@ public class DirectResamplingMapFactory implements ResamplingMapFactory {
     int entries = length[ROW] * length[COL];
     int[] rowMap = new int[entries];
     int[] colMap = new int[entries];
+    float[] rowCoords = new float[entries];
+    float[] colCoords = new float[entries];
     boolean isEmptyMap = true;
 
     // Loop over each dest location
@@ -110,8 +113,10 @@ public class DirectResamplingMapFactory implements ResamplingMapFactory {
         if (earthLoc.isValid()) {
           sourceTrans.transform (earthLoc, sourceLoc);
           if (sourceLoc.isValid()) {
-            int sourceRow = (int) Math.round (sourceLoc.get (ROW));
-            int sourceCol = (int) Math.round (sourceLoc.get (COL));
+            double sourceRowCoord = sourceLoc.get (ROW);
+            double sourceColCoord = sourceLoc.get (COL);
+            int sourceRow = (int) Math.round (sourceRowCoord);
+            int sourceCol = (int) Math.round (sourceColCoord);
             if (
               sourceRow >= 0 &&
               sourceRow < sourceDims[ROW] &&
@@ -120,6 +125,8 @@ public class DirectResamplingMapFactory implements ResamplingMapFactory {
             ) {
               rowMap[destIndex] = sourceRow;
               colMap[destIndex] = sourceCol;
+              rowCoords[destIndex] = (float) sourceRowCoord;
+              colCoords[destIndex] = (float) sourceColCoord;
               isValidMapping = true;
               isEmptyMap = false;
             } // if
@@ -146,7 +153,7 @@ public class DirectResamplingMapFactory implements ResamplingMapFactory {
     if (isEmptyMap)
       map = null;
     else
-      map = new ResamplingMap (start, length, rowMap, colMap);
+      map = new ResamplingMap (start, length, rowMap, colMap, rowCoords, colCoords);
     
     return (map);
 
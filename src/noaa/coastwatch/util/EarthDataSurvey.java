@@ -25,6 +25,7 @@ package noaa.coastwatch.util;
 
 // Imports
 // -------
+import java.io.PrintStream;
 import java.text.NumberFormat;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.Statistics;
@@ -105,6 +106,34 @@ public abstract class EarthDataSurvey {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Writes the survey data in CSV format, one line per row with commas
+   * separating the columns and a column name header.  By default the
+   * survey statistics are written as one statistic per row.  Child
+   * classes may override this method to write the survey data values.
+   *
+   * @param stream the stream to write to.
+   *
+   * @since 3.7.0
+   */
+  public void writeCSV (
+    PrintStream stream
+  ) {
+
+    stream.println ("\"STATISTIC\",\"VALUE\"");
+    int valid = stats.getValid();
+    stream.println ("\"COUNT\"," + stats.getValues());
+    stream.println ("\"VALID\"," + valid);
+    stream.println ("\"MIN\"," + (valid == 0 ? Double.NaN : stats.getMin()));
+    stream.println ("\"MAX\"," + (valid == 0 ? Double.NaN : stats.getMax()));
+    stream.println ("\"MEAN\"," + stats.getMean());
+    stream.println ("\"STDEV\"," + stats.getStdev());
+    stream.println ("\"MEDIAN\"," + stats.getMedian());
+
+  } // writeCSV
+
+  ////////////////////////////////////////////////////////////
+
   /** Creates a new empty survey. */
   protected EarthDataSurvey () { }
 
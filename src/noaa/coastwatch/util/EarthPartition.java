@@ -627,8 +627,13 @@ public class EarthPartition
 
     // Check if contained in children
     // ------------------------------
-    if (lastFound != null && lastFound.contains (loc))
-      return (lastFound);
+    /**
+     * We read the last found partition only once, since other threads may
+     * be searching this partition at the same time and replacing it.
+     */
+    EarthPartition last = lastFound;
+    if (last != null && last.contains (loc))
+      return (last);
     EarthPartition part = children[LEFT].findPartition (loc);
     if (part == null) part = children[RIGHT].findPartition (loc);
     lastFound = part;
@@ -0,0 +1,764 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: EarthRegion.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util;
+
+// Imports
+// -------
+import java.awt.geom.Path2D;
+import java.util.ArrayList;
+import java.util.List;
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.trans.EarthTransform;
+import noaa.coastwatch.util.trans.GCTP;
+import noaa.coastwatch.util.trans.MapProjectionFactory;
+
+/**
+ * The <code>EarthRegion</code> class represents a geographic region of
+ * interest, either a latitude/longitude box, a circle of some radius
+ * around a center location, or a polygon of latitude/longitude
+ * vertices.  The main use of a region is to compute the rectangle of
+ * data coordinates in an earth transform that covers the region, so
+ * that only that part of a data variable needs to be read.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class EarthRegion {
+
+  // Constants
+  // ---------
+
+  /** The box region type. */
+  public static final int BOX = 0;
+
+  /** The circle region type. */
+  public static final int CIRCLE = 1;
+
+  /** The polygon region type. */
+  public static final int POLYGON = 2;
+
+  /** The number of boundary points to sample along each box or polygon edge. */
+  private static final int EDGE_POINTS = 64;
+
+  /** The number of boundary points to sample around a circle. */
+  private static final int CIRCLE_POINTS = 256;
+
+  /** The approximate number of points to scan in each data dimension. */
+  private static final int SCAN_POINTS = 256;
+
+  /** The mean earth radius in kilometres. */
+  private static final double EARTH_RADIUS = 6371.0;
+
+  /** The minimum data location increment for circle radius probes. */
+  private static final double MIN_INC = 1e-6;
+
+  // Variables
+  // ---------
+
+  /** The region type. */
+  private int type;
+
+  /** The box latitude limits as [min, max]. */
+  private double[] latLimits;
+
+  /** The box western longitude in the range [-180..180). */
+  private double westLon;
+
+  /** The box longitude extent in degrees eastward from the western longitude. */
+  private double lonExtent;
+
+  /** The circle center location. */
+  private EarthLocation center;
+
+  /** The circle radius in kilometres. */
+  private double radius;
+
+  /** The polygon vertices. */
+  private List<EarthLocation> vertices;
+
+  /** The polygon path in (lon, lat) coordinates, unwrapped across the anti-meridian. */
+  private Path2D path;
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates a new region of the specified type. */
+  private EarthRegion (int type) { this.type = type; }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a latitude/longitude box region.  If the minimum longitude
+   * is greater than the maximum, the box crosses the anti-meridian.
+   *
+   * @param minLat the minimum latitude in degrees.
+   * @param minLon the western longitude in degrees.
+   * @param maxLat the maximum latitude in degrees.
+   * @param maxLon the eastern longitude in degrees.
+   *
+   * @return the new region.
+   *
+   * @throws IllegalArgumentException if the latitude limits are invalid.
+   */
+  public static EarthRegion fromBounds (
+    double minLat,
+    double minLon,
+    double maxLat,
+    double maxLon
+  ) {
+
+    if (minLat > maxLat || minLat < -90 || maxLat > 90)
+      throw new IllegalArgumentException ("Invalid latitude limits " + minLat + ", " + maxLat);
+
+    EarthRegion region = new EarthRegion (BOX);
+    region.latLimits = new double[] {minLat, maxLat};
+    region.westLon = EarthLocation.lonRange (minLon);
+    double extent = maxLon - minLon;
+    if (extent >= 360) extent = 360;
+    else {
+      extent = EarthLocation.lonRange (maxLon) - region.westLon;
+      if (extent < 0) extent += 360;
+    } // else
+    region.lonExtent = extent;
+
+    return (region);
+
+  } // fromBounds
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a circular region.
+   *
+   * @param center the center location.
+   * @param radius the radius in kilometres.
+   *
+   * @return the new region.
+   */
+  public static EarthRegion fromCircle (
+    EarthLocation center,
+    double radius
+  ) {
+
+    EarthRegion region = new EarthRegion (CIRCLE);
+    region.center = (EarthLocation) center.clone();
+    region.radius = radius;
+
+    return (region);
+
+  } // fromCircle
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a polygon region.  Consecutive vertices are joined by
+   * straight lines in latitude/longitude space, taking the shorter way
+   * around in longitude.  The polygon is closed automatically.
+   *
+   * @param vertices the list of polygon vertices, at least three.
+   *
+   * @return the new region.
+   *
+   * @throws IllegalArgumentException if there are fewer than three
+   * vertices.
+   */
+  public static EarthRegion fromPolygon (
+    List<EarthLocation> vertices
+  ) {
+
+    if (vertices.size() < 3)
+      throw new IllegalArgumentException ("Polygon requires at least three vertices");
+
+    EarthRegion region = new EarthRegion (POLYGON);
+    region.vertices = new ArrayList<EarthLocation> (vertices);
+    region.path = new Path2D.Double();
+    double lastLon = 0;
+    for (int i = 0; i < vertices.size(); i++) {
+      EarthLocation loc = vertices.get (i);
+      double lon = loc.lon;
+      if (i == 0) region.path.moveTo (lon, loc.lat);
+      else {
+        lon = lastLon + EarthLocation.lonRange (lon - lastLon);
+        region.path.lineTo (lon, loc.lat);
+      } // else
+      lastLon = lon;
+    } // for
+    region.path.closePath();
+
+    return (region);
+
+  } // fromPolygon
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Parses a region from a tool option specification.  The
+   * specification is either LAT/LON/RADIUS for a circle with radius in
+   * kilometres, or MINLAT/MINLON/MAXLAT/MAXLON for a box.
+   *
+   * @param spec the region specification.
+   * @param splitRegex the regular expression for splitting values.
+   *
+   * @return the new region.
+   *
+   * @throws IllegalArgumentException if the specification is invalid.
+   */
+  public static EarthRegion parse (
+    String spec,
+    String splitRegex
+  ) {
+
+    String[] array = spec.split (splitRegex);
+    double[] values = new double[array.length];
+    try {
+      for (int i = 0; i < array.length; i++)
+        values[i] = Double.parseDouble (array[i]);
+    } // try
+    catch (NumberFormatException e) {
+      throw new IllegalArgumentException ("Invalid region '" + spec + "'");
+    } // catch
+
+    EarthRegion region;
+    if (values.length == 3)
+      region = fromCircle (new EarthLocation (values[0], values[1]), values[2]);
+    else if (values.length == 4)
+      region = fromBounds (values[0], values[1], values[2], values[3]);
+    else
+      throw new IllegalArgumentException ("Invalid region '" + spec + "'");
+
+    return (region);
+
+  } // parse
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the region type, either {@link #BOX}, {@link #CIRCLE}, or {@link #POLYGON}. */
+  public int getType () { return (type); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Determines if this region contains a location.
+   *
+   * @param loc the location to test.
+   *
+   * @return true if the location is inside the region or false if not,
+   * or if the location is invalid.
+   */
+  public boolean contains (
+    EarthLocation loc
+  ) {
+
+    if (!loc.isValid()) return (false);
+
+    boolean isInside;
+    switch (type) {
+
+    case BOX:
+      if (loc.lat < latLimits[0] || loc.lat > latLimits[1]) isInside = false;
+      else {
+        double offset = loc.lon - westLon;
+        if (offset < 0) offset += 360;
+        isInside = (offset <= lonExtent);
+      } // else
+      break;
+
+    case CIRCLE:
+      isInside = (loc.distance (center) <= radius);
+      break;
+
+    default:
+      isInside = (
+        path.contains (loc.lon, loc.lat) ||
+        path.contains (loc.lon + 360, loc.lat) ||
+        path.contains (loc.lon - 360, loc.lat)
+      );
+      break;
+
+    } // switch
+
+    return (isInside);
+
+  } // contains
+
+  ////////////////////////////////////////////////////////////
+
+  /** Adds points along a straight line in latitude/longitude space. */
+  private static void addEdge (
+    List<EarthLocation> points,
+    double lat1,
+    double lon1,
+    double lat2,
+    double lon2
+  ) {
+
+    for (int i = 0; i < EDGE_POINTS; i++) {
+      double t = (double) i / EDGE_POINTS;
+      points.add (new EarthLocation (lat1 + t*(lat2-lat1), lon1 + t*(lon2-lon1)));
+    } // for
+
+  } // addEdge
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a list of points along the region boundary, plus the region
+   * center for box and circle regions.
+   *
+   * @return the list of boundary points.
+   */
+  public List<EarthLocation> getBoundary () {
+
+    List<EarthLocation> points = new ArrayList<EarthLocation>();
+    switch (type) {
+
+    case BOX:
+      double east = westLon + lonExtent;
+      addEdge (points, latLimits[0], westLon, latLimits[0], east);
+      addEdge (points, latLimits[0], east, latLimits[1], east);
+      addEdge (points, latLimits[1], east, latLimits[1], westLon);
+      addEdge (points, latLimits[1], westLon, latLimits[0], westLon);
+      points.add (new EarthLocation ((latLimits[0] + latLimits[1])/2, westLon + lonExtent/2));
+      break;
+
+    /**
+     * For a circle, we compute the destination point at the radius
+     * distance along a set of bearings from the center, using a
+     * spherical earth.
+     */
+    case CIRCLE:
+      double lat1 = Math.toRadians (center.lat);
+      double lon1 = Math.toRadians (center.lon);
+      double angle = radius / EARTH_RADIUS;
+      for (int i = 0; i < CIRCLE_POINTS; i++) {
+        double bearing = 2*Math.PI*i/CIRCLE_POINTS;
+        double lat2 = Math.asin (Math.sin (lat1)*Math.cos (angle) +
+          Math.cos (lat1)*Math.sin (angle)*Math.cos (bearing));
+        double lon2 = lon1 + Math.atan2 (Math.sin (bearing)*Math.sin (angle)*Math.cos (lat1),
+          Math.cos (angle) - Math.sin (lat1)*Math.sin (lat2));
+        points.add (new EarthLocation (Math.toDegrees (lat2), EarthLocation.lonRange (Math.toDegrees (lon2))));
+      } // for
+      points.add ((EarthLocation) center.clone());
+      break;
+
+    default:
+      int count = vertices.size();
+      for (int i = 0; i < count; i++) {
+        EarthLocation start = vertices.get (i);
+        EarthLocation end = vertices.get ((i+1) % count);
+        double endLon = start.lon + EarthLocation.lonRange (end.lon - start.lon);
+        addEdge (points, start.lat, start.lon, end.lat, endLon);
+      } // for
+      break;
+
+    } // switch
+
+    return (points);
+
+  } // getBoundary
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Determines if a data row or column has any location inside this
+   * region.
+   *
+   * @param trans the earth transform to use.
+   * @param index the row or column index to check.
+   * @param start the first column or row in the range to check.
+   * @param end the last column or row in the range to check.
+   * @param isRow true to check a row, or false to check a column.
+   *
+   * @return true if some location in the range is inside the region.
+   */
+  private boolean hasInside (
+    EarthTransform trans,
+    int index,
+    int start,
+    int end,
+    boolean isRow
+  ) {
+
+    DataLocation dataLoc = new DataLocation (2);
+    EarthLocation earthLoc = new EarthLocation (trans.getDatum());
+    dataLoc.set (isRow ? Grid.ROWS : Grid.COLS, index);
+    int dim = (isRow ? Grid.COLS : Grid.ROWS);
+    for (int i = start; i <= end; i++) {
+      dataLoc.set (dim, i);
+      trans.transform (dataLoc, earthLoc);
+      if (contains (earthLoc)) return (true);
+    } // for
+
+    return (false);
+
+  } // hasInside
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Finds the data location that is the circle radius away from the
+   * center in a specific direction.
+   *
+   * @param trans the earth transform to use for coordinate transforms.
+   * @param dataLoc the data location to use for probing (modified).
+   * @param earthLoc the earth location to use for probing (modified).
+   * @param direction the direction to use for each probe as a data location
+   * offset.
+   *
+   * @return true if successful, false if Double.NaN was returned from
+   * some distance calculation.
+   */
+  private boolean findDataLoc (
+    EarthTransform trans,
+    DataLocation dataLoc,
+    EarthLocation earthLoc,
+    int[] direction
+  ) {
+
+    // Initialize data probe
+    // ---------------------
+    trans.transform (center, dataLoc);
+    trans.transform (dataLoc, earthLoc);
+    double probeDist = Math.abs (center.distance (earthLoc) - radius);
+    double lastProbeDist = Double.MAX_VALUE;
+
+    // Set initial increment
+    // ---------------------
+    double[] inc = new double[] {direction[0], direction[1]};
+    double incMagnitude = Math.max (Math.abs (inc[0]), Math.abs (inc[1]));
+
+    // Loop until tolerance hit
+    // ------------------------
+    while (!Double.isNaN (probeDist) && incMagnitude > MIN_INC) {
+
+      // Increment probe location and test distance
+      // ------------------------------------------
+      dataLoc.set (0, dataLoc.get (0) + inc[0]);
+      dataLoc.set (1, dataLoc.get (1) + inc[1]);
+      trans.transform (dataLoc, earthLoc);
+      probeDist = Math.abs (center.distance (earthLoc) - radius);
+
+      // Check to decrease increment
+      // ---------------------------
+      if (probeDist >= lastProbeDist) {
+        inc[0] *= -0.5;
+        inc[1] *= -0.5;
+        incMagnitude = Math.max (Math.abs (inc[0]), Math.abs (inc[1]));
+      } // if
+      lastProbeDist = probeDist;
+
+    } // while
+
+    // Check final distance
+    // --------------------
+    if (Double.isNaN (probeDist)) return (false);
+    else return (true);
+
+  } // findDataLoc
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the data location limits of a circle region.  The limits are
+   * found by probing from the center along the data rows and columns for
+   * the locations at the circle radius.
+   *
+   * @param trans the earth transform to use for computations.
+   * @param start the starting data location for the rectangle that
+   * encloses the circle (modified).
+   * @param end the ending data location for the rectangle that
+   * encloses the circle (modified).
+   *
+   * @return true if the limits were found and set, or false if
+   * one of the coordinate transforms returned an invalid earth
+   * or data location.  Usually this means that the limits are
+   * past the edge of some transform discontinuity.
+   *
+   * @throws IllegalStateException if this region is not a circle.
+   */
+  public boolean getLimits (
+    EarthTransform trans, 
+    DataLocation start,
+    DataLocation end
+  ) {
+
+    if (type != CIRCLE)
+      throw new IllegalStateException ("Limits are only available for a circle");
+
+    // Create temporary locations
+    // --------------------------
+    DataLocation dataLoc = new DataLocation (2);
+    EarthLocation earthLoc = new EarthLocation (trans.getDatum());
+
+    // Find limits
+    // -----------
+    boolean found = findDataLoc (trans, dataLoc, earthLoc, new int[] {-1, 0});
+    if (!found) return (false);
+    double minRow = dataLoc.get (0);
+    found = findDataLoc (trans, dataLoc, earthLoc, new int[] {1, 0});
+    if (!found) return (false);
+    double maxRow = dataLoc.get (0);
+    found = findDataLoc (trans, dataLoc, earthLoc, new int[] {0, -1});
+    if (!found) return (false);
+    double minCol = dataLoc.get (1);
+    found = findDataLoc (trans, dataLoc, earthLoc, new int[] {0, 1});
+    if (!found) return (false);
+    double maxCol = dataLoc.get (1);
+
+    // Set coords
+    // ----------
+    start.set (0, minRow);
+    start.set (1, minCol);
+    end.set (0, maxRow);
+    end.set (1, maxCol);
+    return (true);
+
+  } // getLimits
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the data coordinate rectangle that covers this region in an
+   * earth transform.<p>
+   *
+   * The rectangle is computed from two sources: the data locations of
+   * points sampled along the region boundary, and a coarse scan of the
+   * data coordinates for locations inside the region, expanded by the
+   * scan step.  The boundary catches regions smaller than the scan step
+   * and the scan catches parts of the region where the boundary falls
+   * outside the data, so the method works for swath transforms as well
+   * as map projections.<p>
+   *
+   * For a circle, the rectangle is the one from {@link #getLimits}
+   * rounded to whole data coordinates and clipped to the data, so that
+   * circles select the same rectangle as a
+   * {@link noaa.coastwatch.render.Subregion} of the same center and
+   * radius.  The general method above is only used if the limits cannot
+   * be found.
+   *
+   * @param trans the earth transform to use, with two dimensions.
+   *
+   * @return the rectangle as an array of [start, count], where start is
+   * the [row, column] of the upper-left corner and count is the
+   * [rows, columns] size, or null if the region does not intersect the
+   * data.
+   */
+  public int[][] getDataBounds (
+    EarthTransform trans
+  ) {
+
+    int[] dims = trans.getDimensions();
+    int rows = dims[Grid.ROWS];
+    int cols = dims[Grid.COLS];
+
+    // Use circle limits
+    // -----------------
+    if (type == CIRCLE) {
+      DataLocation startLoc = new DataLocation (2);
+      DataLocation endLoc = new DataLocation (2);
+      if (getLimits (trans, startLoc, endLoc)) {
+        int[] start = new int[] {
+          (int) Math.max (0, Math.round (startLoc.get (Grid.ROWS))),
+          (int) Math.max (0, Math.round (startLoc.get (Grid.COLS)))
+        };
+        int[] end = new int[] {
+          (int) Math.min (rows-1, Math.round (endLoc.get (Grid.ROWS))),
+          (int) Math.min (cols-1, Math.round (endLoc.get (Grid.COLS)))
+        };
+        if (start[0] > end[0] || start[1] > end[1]) return (null);
+        return (new int[][] {start, new int[] {end[0] - start[0] + 1, end[1] - start[1] + 1}});
+      } // if
+    } // if
+
+    int[] min = new int[] {Integer.MAX_VALUE, Integer.MAX_VALUE};
+    int[] max = new int[] {Integer.MIN_VALUE, Integer.MIN_VALUE};
+
+    // Add boundary locations
+    // ----------------------
+    DataLocation dataLoc = new DataLocation (2);
+    for (EarthLocation loc : getBoundary()) {
+      loc.setDatum (trans.getDatum());
+      trans.transform (loc, dataLoc);
+      if (!dataLoc.isValid()) continue;
+      int row = (int) Math.round (dataLoc.get (Grid.ROWS));
+      int col = (int) Math.round (dataLoc.get (Grid.COLS));
+      if (row < 0 || row >= rows || col < 0 || col >= cols) continue;
+      min[0] = Math.min (min[0], row); max[0] = Math.max (max[0], row);
+      min[1] = Math.min (min[1], col); max[1] = Math.max (max[1], col);
+    } // for
+
+    int[] boundaryMin = (int[]) min.clone();
+    int[] boundaryMax = (int[]) max.clone();
+
+    // Add scanned locations
+    // ---------------------
+    int step = Math.max (1, Math.max (rows, cols) / SCAN_POINTS);
+    EarthLocation earthLoc = new EarthLocation (trans.getDatum());
+    for (int row = 0; row < rows + step - 1; row += step) {
+      int scanRow = Math.min (row, rows-1);
+      for (int col = 0; col < cols + step - 1; col += step) {
+        int scanCol = Math.min (col, cols-1);
+        dataLoc.set (Grid.ROWS, scanRow);
+        dataLoc.set (Grid.COLS, scanCol);
+        trans.transform (dataLoc, earthLoc);
+        if (!contains (earthLoc)) continue;
+        min[0] = Math.min (min[0], scanRow - step); max[0] = Math.max (max[0], scanRow + step);
+        min[1] = Math.min (min[1], scanCol - step); max[1] = Math.max (max[1], scanCol + step);
+      } // for
+    } // for
+
+    // Create rectangle
+    // ----------------
+    int[][] bounds;
+    if (min[0] > max[0]) bounds = null;
+    else {
+      int[] start = new int[] {Math.max (0, min[0]), Math.max (0, min[1])};
+      int[] end = new int[] {Math.min (rows-1, max[0]), Math.min (cols-1, max[1])};
+
+      /**
+       * The scan expansion may add up to one step of extra rows and
+       * columns on each side, so we trim back edges that contain no
+       * locations inside the region, stopping at the boundary limits.
+       */
+      while (start[0] < end[0] && start[0] < boundaryMin[0] &&
+        !hasInside (trans, start[0], start[1], end[1], true)) start[0]++;
+      while (end[0] > start[0] && end[0] > boundaryMax[0] &&
+        !hasInside (trans, end[0], start[1], end[1], true)) end[0]--;
+      while (start[1] < end[1] && start[1] < boundaryMin[1] &&
+        !hasInside (trans, start[1], start[0], end[0], false)) start[1]++;
+      while (end[1] > start[1] && end[1] > boundaryMax[1] &&
+        !hasInside (trans, end[1], start[0], end[0], false)) end[1]--;
+
+      bounds = new int[][] {start, new int[] {end[0] - start[0] + 1, end[1] - start[1] + 1}};
+    } // else
+
+    return (bounds);
+
+  } // getDataBounds
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (EarthRegion.class);
+
+    // ------------------------->
+
+    logger.test ("parse and contains");
+
+    EarthRegion box = parse ("10/-20/30/-10", "[,/]");
+    assert (box.getType() == BOX);
+    assert (box.contains (new EarthLocation (20, -15)));
+    assert (!box.contains (new EarthLocation (20, -5)));
+    assert (!box.contains (new EarthLocation (35, -15)));
+
+    EarthRegion wrap = fromBounds (-10, 170, 10, -170);
+    assert (wrap.contains (new EarthLocation (0, 175)));
+    assert (wrap.contains (new EarthLocation (0, -175)));
+    assert (!wrap.contains (new EarthLocation (0, 0)));
+
+    EarthRegion circle = parse ("40,-120,100", "[,/]");
+    assert (circle.getType() == CIRCLE);
+    assert (circle.contains (new EarthLocation (40.5, -120)));
+    assert (!circle.contains (new EarthLocation (42, -120)));
+
+    List<EarthLocation> vertices = new ArrayList<EarthLocation>();
+    vertices.add (new EarthLocation (0, 170));
+    vertices.add (new EarthLocation (10, 175));
+    vertices.add (new EarthLocation (0, -170));
+    EarthRegion polygon = fromPolygon (vertices);
+    assert (polygon.contains (new EarthLocation (2, 179)));
+    assert (polygon.contains (new EarthLocation (2, -179)));
+    assert (!polygon.contains (new EarthLocation (2, 0)));
+
+    boolean failed = false;
+    try { parse ("1/2", "[,/]"); }
+    catch (IllegalArgumentException e) { failed = true; }
+    assert (failed);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getDataBounds");
+
+    EarthTransform trans = MapProjectionFactory.getInstance().create (GCTP.GEO, 0,
+      new double[] {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}, GCTP.WGS84,
+      new int[] {1800, 3600}, new EarthLocation (0, 0),
+      new double[] {0.1, 0.1});
+
+    int[][] bounds = box.getDataBounds (trans);
+    DataLocation start = new DataLocation (bounds[0][0], bounds[0][1]);
+    DataLocation end = new DataLocation (bounds[0][0] + bounds[1][0] - 1,
+      bounds[0][1] + bounds[1][1] - 1);
+    EarthLocation startLoc = trans.transform (start);
+    EarthLocation endLoc = trans.transform (end);
+    double north = Math.max (startLoc.lat, endLoc.lat);
+    double south = Math.min (startLoc.lat, endLoc.lat);
+    double west = Math.min (startLoc.lon, endLoc.lon);
+    double east = Math.max (startLoc.lon, endLoc.lon);
+    assert (Math.abs (north - 30) <= 0.2 && Math.abs (south - 10) <= 0.2);
+    assert (Math.abs (west + 20) <= 0.2 && Math.abs (east + 10) <= 0.2);
+    assert (bounds[1][0] <= 205 && bounds[1][1] <= 105);
+
+    EarthRegion small = fromBounds (0.01, 0.01, 0.04, 0.04);
+    bounds = small.getDataBounds (trans);
+    assert (bounds != null);
+    assert (bounds[1][0] <= 2 && bounds[1][1] <= 2);
+
+    int[] dims = trans.getDimensions();
+    bounds = fromBounds (-90, -180, 90, 179.99).getDataBounds (trans);
+    assert (bounds[1][0] == dims[0] && bounds[1][1] == dims[1]);
+
+    start = new DataLocation (2);
+    end = new DataLocation (2);
+    assert (circle.getLimits (trans, start, end));
+    bounds = circle.getDataBounds (trans);
+    assert (bounds[0][0] == Math.round (start.get (0)));
+    assert (bounds[0][1] == Math.round (start.get (1)));
+    assert (bounds[0][0] + bounds[1][0] - 1 == Math.round (end.get (0)));
+    assert (bounds[0][1] + bounds[1][1] - 1 == Math.round (end.get (1)));
+    DataLocation centerLoc = trans.transform (new EarthLocation (40, -120));
+    assert (start.get (0) < centerLoc.get (0) && centerLoc.get (0) < end.get (0));
+    assert (start.get (1) < centerLoc.get (1) && centerLoc.get (1) < end.get (1));
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // EarthRegion class
+
+////////////////////////////////////////////////////////////////////////
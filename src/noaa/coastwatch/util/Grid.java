@@ -31,6 +31,7 @@ import java.text.NumberFormat;
 import java.util.Map;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.io.tile.TilingScheme;
 
 // Testing
@@ -144,6 +145,9 @@ public class Grid
   /**
    * Constructs a new 2D grid from the specified grid.  All properties
    * are copied, but the data array contains no actual data values.
+   * Statistics summary attributes are not copied, since they would not
+   * describe the new data values (see {@link Statistics#copyAttributes}
+   * for grids that share the same data).
    *
    * @param grid the grid to use for properties.
    */
@@ -159,6 +163,7 @@ public class Grid
     setUnsigned (grid.getUnsigned());
     setLookup (grid.lookup);
     getMetadataMap().putAll (grid.getMetadataMap());
+    Statistics.removeAttributes (getMetadataMap());
 
   } // Grid constructor
 
@@ -185,6 +190,7 @@ public class Grid
     setNavigation (grid.nav);
     setUnsigned (grid.getUnsigned());
     getMetadataMap().putAll (grid.getMetadataMap());
+    Statistics.removeAttributes (getMetadataMap());
 
   } // Grid constructor
 
@@ -506,6 +512,37 @@ public class Grid
 
   } // getData
 
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Reads a span of scaled data values from one row with no
+   * navigation.  The raw values are retrieved together using
+   * {@link #getData(int[],int[])} and then scaled, which avoids the
+   * cost of locating the data separately for each value.
+   *
+   * @param row the data row.
+   * @param startCol the starting data column.
+   * @param count the number of columns to read.
+   * @param values the array to fill with scaled data values, using
+   * <code>Double.NaN</code> for missing data (modified).
+   *
+   * @throws IndexOutOfBoundsException if the span falls outside the
+   * grid dimensions.
+   *
+   * @since 3.7.0
+   */
+  public void getValues (
+    int row,
+    int startCol,
+    int count,
+    double[] values
+  ) {
+
+    Object subset = getData (new int[] {row, startCol}, new int[] {1, count});
+    for (int i = 0; i < count; i++) values[i] = getValue (i, subset);
+
+  } // getValues
+
   ////////////////////////////////////////////////////////////
   
   /** 
@@ -587,6 +624,24 @@ public class Grid
 
     // ------------------------->
 
+    logger.test ("getValues");
+
+    Grid scaled = new Grid ("scaled", "scaled data", "meters", dims[ROWS],
+      dims[COLS], data, new java.text.DecimalFormat ("000"),
+      new double[] {0.5, 10}, Integer.valueOf (data[5*dims[COLS] + 12]));
+    double[] rowValues = new double[20];
+    scaled.getValues (5, 7, rowValues.length, rowValues);
+    for (int j = 0; j < rowValues.length; j++) {
+      double expected = scaled.getValue (5, 7 + j);
+      if (Double.isNaN (expected)) assert (Double.isNaN (rowValues[j]));
+      else assert (rowValues[j] == expected);
+    } // for
+    assert (Double.isNaN (rowValues[5]));
+
+    logger.passed();
+
+    // ------------------------->
+
     logger.test ("setData");
     
     start = new int[] {7, 13};
@@ -620,6 +675,19 @@ public class Grid
 
     // ------------------------->
 
+    logger.test ("Grid(Grid)");
+
+    grid.getMetadataMap().put ("comment", "test comment");
+    grid.getMetadataMap().put (Statistics.ATTRIBUTE_PREFIX + "values",
+      Integer.valueOf (data.length));
+    Grid copy = new Grid (grid);
+    assert (copy.getMetadataMap().get ("comment").equals ("test comment"));
+    assert (!copy.getMetadataMap().containsKey (Statistics.ATTRIBUTE_PREFIX + "values"));
+
+    logger.passed();
+
+    // ------------------------->
+
   } // main
 
   ////////////////////////////////////////////////////////////
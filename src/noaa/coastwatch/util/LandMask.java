@@ -25,18 +25,16 @@ package noaa.coastwatch.util;
 
 // Imports
 // -------
-import noaa.coastwatch.io.EarthDataReader;
-import noaa.coastwatch.io.EarthDataReaderFactory;
-import noaa.coastwatch.io.IOServices;
+import noaa.coastwatch.io.ReferenceDataRegistry;
+import noaa.coastwatch.io.ReferenceDataRegistry.ReferenceData;
 import noaa.coastwatch.util.DataLocation;
-import noaa.coastwatch.util.EarthDataInfo;
 import noaa.coastwatch.util.EarthLocation;
-import noaa.coastwatch.util.Grid;
-import noaa.coastwatch.util.trans.EarthTransform;
 
 /**
  * The <code>LandMask</code> class may be used to retrieve a true or
  * false value for the presence of land at a certain earth location.
+ * The land databases are shared through the {@link ReferenceDataRegistry}
+ * and the class is safe to use from multiple threads.
  *
  * @author Peter Hollemans
  * @since 3.1.9
@@ -83,16 +81,13 @@ public class LandMask {
   /** The one and only instance. */
   private static LandMask instance;
 
-  /** The array of grids. */
-  private Grid[] gridArray;
-
-  /** The array of earth transforms. */
-  private EarthTransform[] transArray;
+  /** The array of loaded databases. */
+  private ReferenceData[] dataArray;
 
   ////////////////////////////////////////////////////////////
 
   /** Gets an instance of the <code>LandMask</code> class. */
-  public static LandMask getInstance () {
+  public static synchronized LandMask getInstance () {
 
     if (instance == null) instance = new LandMask();
     return (instance);
@@ -133,10 +128,9 @@ public class LandMask {
   /** Creates a new <code>LandMask</code> object. */
   private LandMask () {
 
-    // Initialize arrays
-    // -----------------
-    gridArray = new Grid[DATABASES.length];
-    transArray = new EarthTransform[DATABASES.length];
+    // Initialize array
+    // ----------------
+    dataArray = new ReferenceData[DATABASES.length];
 
   } // LandMask constructor
 
@@ -155,23 +149,27 @@ public class LandMask {
 
     // Load database
     // -------------
+    /**
+     * Two threads may both find the database missing here, but the
+     * registry loads it only once and they store the same object.
+     */
     int index = getDatabase (loc);
-    if (gridArray[index] == null) {
+    ReferenceData data = dataArray[index];
+    if (data == null) {
       try {
-        String path = IOServices.getFilePath (getClass(), DATABASES[index]);
-        EarthDataReader reader = EarthDataReaderFactory.create (path);
-        gridArray[index] = (Grid) reader.getVariable (VARIABLE);
-        transArray[index] = reader.getInfo().getTransform();
+        data = ReferenceDataRegistry.getInstance().getData (LandMask.class,
+          DATABASES[index], VARIABLE);
       } // try
       catch (Exception e) {
         throw new RuntimeException (e.getMessage());
       } // catch
+      dataArray[index] = data;
     } // if
       
     // Get land value
     // --------------
-    DataLocation dataLoc = transArray[index].transform (loc);
-    return (((byte) gridArray[index].getValue (dataLoc)) != 0);
+    DataLocation dataLoc = data.getTransform().transform (loc);
+    return (((byte) data.getGrid().getValue (dataLoc)) != 0);
 
   } // isLand
 
@@ -25,6 +25,7 @@ package noaa.coastwatch.util;
 
 // Imports
 // -------
+import java.io.PrintStream;
 import java.text.DecimalFormat;
 import java.text.NumberFormat;
 import noaa.coastwatch.util.DataLocation;
@@ -32,7 +33,9 @@ import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.DataVariableIterator;
 import noaa.coastwatch.util.EarthDataSurvey;
 import noaa.coastwatch.util.EarthLocation;
+import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.LineLocationIterator;
+import noaa.coastwatch.util.RowSpanSampler;
 import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.trans.EarthTransform;
 
@@ -90,6 +93,66 @@ public class LineSurvey
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Writes the line data values in CSV format, one line per location in
+   * line order.
+   *
+   * @param stream the stream to write to.
+   *
+   * @since 3.7.0
+   */
+  @Override
+  public void writeCSV (
+    PrintStream stream
+  ) {
+
+    stream.println ("\"ROW\",\"COL\",\"LAT\",\"LON\",\"" +
+      getVariableName().toUpperCase() + "\"");
+    EarthTransform trans = getTransform();
+    DataLocation[] locs = getExtents();
+    Statistics stats = getStatistics();
+    LineLocationIterator iter = new LineLocationIterator (locs[0], locs[1]);
+    for (int i = 0; iter.hasNext(); i++) {
+      DataLocation loc = iter.next();
+      EarthLocation earthLoc = trans.transform (loc);
+      stream.println (
+        (int) loc.get (Grid.ROWS) + "," +
+        (int) loc.get (Grid.COLS) + "," +
+        earthLoc.lat + "," +
+        earthLoc.lon + "," +
+        stats.getData (i));
+    } // for
+
+  } // writeCSV
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the statistics along a line, with the data values saved in
+   * line order.
+   */
+  private static Statistics getLineStatistics (
+    DataVariable variable,
+    DataLocation start,
+    DataLocation end
+  ) {
+
+    Statistics stats;
+    if (RowSpanSampler.canSample (variable)) {
+      RowSpanSampler sampler = RowSpanSampler.forLine (start, end);
+      stats = RowSpanSampler.getStatistics (sampler.getValues ((Grid) variable));
+    } // if
+    else {
+      stats = new Statistics (new DataVariableIterator (variable, 
+        new LineLocationIterator (start, end)), true);
+    } // else
+
+    return (stats);
+
+  } // getLineStatistics
+
+  ////////////////////////////////////////////////////////////
+
   /** 
    * Creates a new line survey.
    * 
@@ -110,8 +173,7 @@ public class LineSurvey
       variable.getUnits(),
       variable.getFormat(),
       trans,
-      new Statistics (new DataVariableIterator (variable, 
-        new LineLocationIterator (start, end)), true),
+      getLineStatistics (variable, start, end),
       new DataLocation[] {start, end}
     );
 
@@ -420,6 +420,49 @@ public class LocationEstimator {
 
   ////////////////////////////////////////////////////////////
 
+  /** Creates an empty estimator to be filled in by a copy. */
+  private LocationEstimator () {}
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a copy of this estimator for use by another thread.  The
+   * copy shares the partitions and polynomial estimators, which are
+   * not modified after construction, but uses its own transforms and
+   * temporary storage for explicit location queries.
+   *
+   * @param refTrans the reference transform for the copy, normally a
+   * clone of the reference transform of this estimator.
+   * @param targetTrans the target transform for the copy, normally a
+   * clone of the target transform of this estimator.
+   *
+   * @return the estimator copy.
+   *
+   * @since 3.7.0
+   */
+  public LocationEstimator copyWithTransforms (
+    EarthTransform refTrans,
+    EarthTransform targetTrans
+  ) {
+
+    LocationEstimator copy = new LocationEstimator();
+    copy.refTrans = refTrans;
+    copy.refDims = refDims;
+    copy.targetTrans = targetTrans;
+    copy.targetDims = targetDims;
+    copy.targetNav = targetNav;
+    copy.partition = partition;
+    copy.parts = parts;
+    copy.queryMode = queryMode;
+    copy.tempEarthLoc = new EarthLocation();
+    copy.tempRefCoords = new double[2];
+
+    return (copy);
+
+  } // copyWithTransforms
+
+  ////////////////////////////////////////////////////////////
+
   /** 
    * Gets the target location for the specified reference location.
    * 
@@ -437,9 +480,41 @@ public class LocationEstimator {
     DataLocation targetLoc
   ) {
 
-    // Create target location if needed
-    // --------------------------------
     if (targetLoc == null) targetLoc = new DataLocation (2);
+    getLocation (refLoc, targetLoc, tempEarthLoc, tempRefCoords);
+    return (targetLoc);
+
+  } // getLocation
+
+  ////////////////////////////////////////////////////////////
+
+  /** 
+   * Gets the target location for the specified reference location
+   * using caller-supplied temporary storage.  Unlike the other
+   * <code>getLocation</code> methods, this method may be called
+   * from multiple threads at once, provided that each thread uses its
+   * own temporary objects and the reference and target transforms are
+   * thread-safe.  Since most transforms keep intermediate values between
+   * calls, threads should normally each use their own estimator from
+   * {@link #copyWithTransforms} with cloned transforms.
+   * 
+   * @param refLoc the reference location. 
+   * @param targetLoc the target location (modified).  The target
+   * location may be invalid if an error occurred in calculation or if the
+   * specified reference location has no valid target location.
+   * @param earthLoc the temporary earth location for calculations.
+   * @param refCoords the temporary coordinate array for calculations,
+   * of length 2.
+   *
+   * @since 3.7.0
+   */
+  public void getLocation (
+    DataLocation refLoc,
+    DataLocation targetLoc,
+    EarthLocation earthLoc,
+    double[] refCoords
+  ) {
+
     targetLoc.markInvalid();
 
     // Get child partition
@@ -458,8 +533,8 @@ public class LocationEstimator {
         // Perform explicit location transform
         // -----------------------------------
         if (data.coverage && queryMode != FAST) {
-          refTrans.transform (refLoc, tempEarthLoc);
-          targetTrans.transform (tempEarthLoc, targetLoc);
+          refTrans.transform (refLoc, earthLoc);
+          targetTrans.transform (earthLoc, targetLoc);
           if (targetNav != null) targetLoc.transformInPlace (targetNav);
         } // if
 
@@ -468,15 +543,13 @@ public class LocationEstimator {
       // Perform estimated location transform
       // ------------------------------------
       else {
-        refLoc.getCoords (tempRefCoords);
-        targetLoc.set (Grid.ROWS, data.rowEst.evaluate (tempRefCoords));
-        targetLoc.set (Grid.COLS, data.colEst.evaluate (tempRefCoords));
+        refLoc.getCoords (refCoords);
+        targetLoc.set (Grid.ROWS, data.rowEst.evaluate (refCoords));
+        targetLoc.set (Grid.COLS, data.colEst.evaluate (refCoords));
       } // else
 
     } // if
 
-    return (targetLoc);
-
   } // getLocation
   
   ////////////////////////////////////////////////////////////
@@ -0,0 +1,306 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: MaskCorrelator.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util;
+
+// Imports
+// -------
+import java.util.Random;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>MaskCorrelator</code> class computes the agreement between a
+ * binary image box and a larger binary reference mask at every offset in
+ * a search window.  The reference mask is packed into 64-bit words once,
+ * pre-shifted for every column offset, so that the count of agreeing
+ * pixels at an offset is computed a whole word at a time with an
+ * exclusive-or and a population count.  This is about 64 times less work
+ * than comparing pixels one by one.  A correlator may be reused for any
+ * number of images against the same reference mask.<p>
+ *
+ * The reference mask has dimensions [boxHeight + 2*maxRowOffset,
+ * boxWidth + 2*maxColOffset].  At offset (rowOffset, colOffset), image
+ * pixel [i][j] is compared to mask pixel [i - rowOffset + maxRowOffset]
+ * [j - colOffset + maxColOffset].
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class MaskCorrelator {
+
+  // Variables
+  // ---------
+
+  /** The image box height. */
+  private int boxHeight;
+
+  /** The image box width. */
+  private int boxWidth;
+
+  /** The maximum offset in the rows direction. */
+  private int maxRowOffset;
+
+  /** The maximum offset in the columns direction. */
+  private int maxColOffset;
+
+  /** The number of 64-bit words in a packed image row. */
+  private int words;
+
+  /**
+   * The packed mask rows as [maskRow][colShift][word], where colShift is
+   * the starting mask column for the row segment.
+   */
+  private long[][][] packedMask;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new correlator.
+   *
+   * @param mask the reference mask with dimensions [boxHeight +
+   * 2*maxRowOffset][boxWidth + 2*maxColOffset].
+   * @param boxHeight the image box height.
+   * @param boxWidth the image box width.
+   * @param maxRowOffset the maximum offset in the rows direction.
+   * @param maxColOffset the maximum offset in the columns direction.
+   */
+  public MaskCorrelator (
+    boolean[][] mask,
+    int boxHeight,
+    int boxWidth,
+    int maxRowOffset,
+    int maxColOffset
+  ) {
+
+    this.boxHeight = boxHeight;
+    this.boxWidth = boxWidth;
+    this.maxRowOffset = maxRowOffset;
+    this.maxColOffset = maxColOffset;
+    this.words = (boxWidth + 63) / 64;
+
+    // Pack mask rows
+    // --------------
+    int maskHeight = boxHeight + 2*maxRowOffset;
+    int shifts = 2*maxColOffset + 1;
+    packedMask = new long[maskHeight][shifts][];
+    for (int row = 0; row < maskHeight; row++) {
+      long[] fullRow = pack (mask[row], mask[row].length);
+      for (int shift = 0; shift < shifts; shift++)
+        packedMask[row][shift] = extract (fullRow, shift, boxWidth);
+    } // for
+
+  } // MaskCorrelator constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Packs a row of flags into words, with column j stored in bit
+   * (j % 64) of word (j / 64).
+   */
+  private static long[] pack (
+    boolean[] flags,
+    int length
+  ) {
+
+    long[] packed = new long[(length + 63) / 64];
+    for (int j = 0; j < length; j++) {
+      if (flags[j]) packed[j >>> 6] |= (1L << (j & 63));
+    } // for
+
+    return (packed);
+
+  } // pack
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Extracts a run of bits from a packed row into a new packed row
+   * starting at bit 0, with any unused bits in the last word cleared.
+   */
+  private static long[] extract (
+    long[] packed,
+    int start,
+    int length
+  ) {
+
+    int words = (length + 63) / 64;
+    long[] result = new long[words];
+    int shift = start & 63;
+    for (int w = 0; w < words; w++) {
+      int index = (start >>> 6) + w;
+      long value = packed[index] >>> shift;
+      if (shift != 0 && index+1 < packed.length)
+        value |= packed[index+1] << (64 - shift);
+      result[w] = value;
+    } // for
+    int lastBits = length & 63;
+    if (lastBits != 0) result[words-1] &= (1L << lastBits) - 1;
+
+    return (result);
+
+  } // extract
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the number of agreeing pixels between an image and the mask at
+   * every offset.  The number of disagreeing pixels at an offset (ie:
+   * the agreement with the inverted image) is the box size
+   * boxHeight*boxWidth minus the agreeing count.
+   *
+   * @param image the image flags with dimensions [boxHeight][boxWidth].
+   *
+   * @return the agreeing pixel counts as [rowOffset +
+   * maxRowOffset][colOffset + maxColOffset].
+   */
+  public int[][] getMatchCounts (
+    boolean[][] image
+  ) {
+
+    // Pack image rows
+    // ---------------
+    long[][] packedImage = new long[boxHeight][];
+    for (int i = 0; i < boxHeight; i++)
+      packedImage[i] = pack (image[i], boxWidth);
+
+    // Count mismatches at each offset
+    // -------------------------------
+    int total = boxHeight*boxWidth;
+    int[][] counts = new int[2*maxRowOffset + 1][2*maxColOffset + 1];
+    for (int rowOffset = -maxRowOffset; rowOffset <= maxRowOffset; rowOffset++) {
+      int rowIndex = rowOffset + maxRowOffset;
+      for (int colOffset = -maxColOffset; colOffset <= maxColOffset; colOffset++) {
+        int shift = maxColOffset - colOffset;
+        int mismatches = 0;
+        for (int i = 0; i < boxHeight; i++) {
+          long[] imageRow = packedImage[i];
+          long[] maskRow = packedMask[i - rowOffset + maxRowOffset][shift];
+          for (int w = 0; w < words; w++)
+            mismatches += Long.bitCount (imageRow[w] ^ maskRow[w]);
+        } // for
+        counts[rowIndex][colOffset + maxColOffset] = total - mismatches;
+      } // for
+    } // for
+
+    return (counts);
+
+  } // getMatchCounts
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (MaskCorrelator.class);
+
+    // ------------------------->
+
+    logger.test ("getMatchCounts against brute force");
+
+    /**
+     * The synthetic coastlines are a wavy boundary between land and
+     * water at a random angle, with some noise pixels flipped in the
+     * image to simulate cloud and misclassification.  Box widths are
+     * chosen to cover partial, single, and multiple words.
+     */
+    Random random = new Random (4321);
+    int[][] sizes = new int[][] {{10, 10}, {25, 64}, {40, 70}, {33, 130}};
+    for (int[] size : sizes) {
+      int boxHeight = size[0];
+      int boxWidth = size[1];
+      int maxRowOffset = boxHeight/2;
+      int maxColOffset = boxWidth/2;
+      int maskHeight = boxHeight + 2*maxRowOffset;
+      int maskWidth = boxWidth + 2*maxColOffset;
+
+      double angle = random.nextDouble()*Math.PI*2;
+      double wave = random.nextDouble()*5;
+      boolean[][] mask = new boolean[maskHeight][maskWidth];
+      for (int i = 0; i < maskHeight; i++) {
+        for (int j = 0; j < maskWidth; j++) {
+          double x = (j - maskWidth/2.0)*Math.cos (angle) + (i - maskHeight/2.0)*Math.sin (angle);
+          double y = -(j - maskWidth/2.0)*Math.sin (angle) + (i - maskHeight/2.0)*Math.cos (angle);
+          mask[i][j] = (x + wave*Math.sin (y/4) > 0);
+        } // for
+      } // for
+
+      int trueRowOffset = random.nextInt (maxRowOffset+1) - maxRowOffset/2;
+      int trueColOffset = random.nextInt (maxColOffset+1) - maxColOffset/2;
+      boolean[][] image = new boolean[boxHeight][boxWidth];
+      for (int i = 0; i < boxHeight; i++) {
+        for (int j = 0; j < boxWidth; j++) {
+          image[i][j] = mask[i - trueRowOffset + maxRowOffset][j - trueColOffset + maxColOffset];
+          if (random.nextDouble() < 0.02) image[i][j] = !image[i][j];
+        } // for
+      } // for
+
+      MaskCorrelator correlator = new MaskCorrelator (mask, boxHeight, boxWidth, maxRowOffset, maxColOffset);
+      for (int pass = 0; pass < 2; pass++) {
+        int[][] counts = correlator.getMatchCounts (image);
+        int bestCount = 0;
+        for (int rowOffset = -maxRowOffset; rowOffset <= maxRowOffset; rowOffset++) {
+          for (int colOffset = -maxColOffset; colOffset <= maxColOffset; colOffset++) {
+            int[] corr = new int[2];
+            for (int i = 0; i < boxHeight; i++) {
+              for (int j = 0; j < boxWidth; j++) {
+                boolean isLand = mask[i-rowOffset+maxRowOffset][j-colOffset+maxColOffset];
+                corr[0] += (image[i][j] == isLand ? 1 : 0);
+                corr[1] += (!image[i][j] == isLand ? 1 : 0);
+              } // for
+            } // for
+            int count = counts[rowOffset+maxRowOffset][colOffset+maxColOffset];
+            assert (count == corr[0]);
+            assert (boxHeight*boxWidth - count == corr[1]);
+            bestCount = Math.max (bestCount, count);
+          } // for
+        } // for
+        int trueCount = counts[trueRowOffset+maxRowOffset][trueColOffset+maxColOffset];
+        if (pass == 0) assert (trueCount > 0.9*boxHeight*boxWidth);
+        else assert (trueCount < 0.1*boxHeight*boxWidth);
+        assert (bestCount >= trueCount);
+
+        // Reuse the correlator with the opposite polarity image
+        for (int i = 0; i < boxHeight; i++)
+          for (int j = 0; j < boxWidth; j++) image[i][j] = !image[i][j];
+      } // for
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // MaskCorrelator class
+
+////////////////////////////////////////////////////////////////////////
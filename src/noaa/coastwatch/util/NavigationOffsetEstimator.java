@@ -33,6 +33,7 @@ import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.EarthLocation;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.LandMask;
+import noaa.coastwatch.util.MaskCorrelator;
 import noaa.coastwatch.util.trans.EarthTransform;
 
 import java.util.logging.Logger;
@@ -414,7 +415,7 @@ public class NavigationOffsetEstimator {
    * @param thresh the land/water class separation threshold.
    * @param boxHeight the navigation box height in data dimensions.
    * @param boxWidth the navigation box width in data dimensions.
-   * @param land the land box flag data.
+   * @param correlator the land box correlator.
    * @param maxRowOffset maximum offset in the rows direction.
    * @param maxColOffset maximum offset in the columns direction.
    * @param correlation the correlation coefficient (modified) or
@@ -429,31 +430,41 @@ public class NavigationOffsetEstimator {
     double thresh,
     int boxHeight,
     int boxWidth,
-    boolean[][] land,
+    MaskCorrelator correlator,
     int maxRowOffset,
     int maxColOffset,
     double[] correlation
   ) {
 
+    // Compute correlation at all offsets
+    // ----------------------------------
+    /**
+     * The correlator gives the count of pixels where high data values
+     * agree with land at every offset in one pass.  The count for the
+     * opposite polarity, where low data values agree with land, is the
+     * remainder of the box.
+     */
+    boolean[][] highIsLand = new boolean[boxHeight][boxWidth];
+    for (int i = 0; i < boxHeight; i++) {
+      for (int j = 0; j < boxWidth; j++) {
+        highIsLand[i][j] = (data[i][j] > thresh);
+      } // for
+    } // for
+    int[][] counts = correlator.getMatchCounts (highIsLand);
+    int total = boxHeight*boxWidth;
+
     // Find maximum image correlation
     // ------------------------------
     int[] maxCorr = new int[2];
     int[] maxCorrRowOffset = new int[2];
     int[] maxCorrColOffset = new int[2];
+    int[] corr = new int[2];
     for (int rowOffset = -maxRowOffset; rowOffset <= maxRowOffset; 
       rowOffset++) {
       for (int colOffset = -maxColOffset; colOffset <= maxColOffset; 
         colOffset++) {
-        int[] corr = new int[2];
-        for (int i = 0; i < boxHeight; i++) {
-          for (int j = 0; j < boxWidth; j++) {
-            boolean highIsLand = (data[i][j] > thresh);
-            boolean isLand = 
-              land[i-rowOffset+maxRowOffset][j-colOffset+maxColOffset];
-            corr[0] += (highIsLand == isLand ? 1 : 0);
-            corr[1] += (!highIsLand == isLand ? 1 : 0);
-          } // for
-        } // for
+        corr[0] = counts[rowOffset+maxRowOffset][colOffset+maxColOffset];
+        corr[1] = total - corr[0];
         for (int k = 0; k < 2; k++) {
           if (corr[k] > maxCorr[k]) {
             maxCorr[k] = corr[k];
@@ -555,7 +566,7 @@ public class NavigationOffsetEstimator {
     int landHeight = boxHeight + maxRowOffset*2;
     int landWidth = boxWidth + maxColOffset*2;
     int[] landMin = new int[] {min[0] - maxRowOffset, min[1] - maxColOffset};
-    boolean[][] land = null;
+    MaskCorrelator correlator = null;
 
     // Loop over each guess navigation
     // -------------------------------
@@ -581,13 +592,16 @@ public class NavigationOffsetEstimator {
     
       // Get land data array
       // -------------------
-      if (land == null) 
-        land = getLandData (trans, landMin, landHeight, landWidth);
+      if (correlator == null) {
+        boolean[][] land = getLandData (trans, landMin, landHeight, landWidth);
+        correlator = new MaskCorrelator (land, boxHeight, boxWidth,
+          maxRowOffset, maxColOffset);
+      } // if
     
       // Find maximum image correlation offset
       // -------------------------------------
       int[] offset = getMaxCorrelationOffset (data, thresh, boxHeight, 
-        boxWidth, land, maxRowOffset, maxColOffset, corr);
+        boxWidth, correlator, maxRowOffset, maxColOffset, corr);
       if (offset == null) {
         VERBOSE.info ("Image correlation failed");
         continue;
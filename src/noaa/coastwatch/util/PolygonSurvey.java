@@ -33,6 +33,7 @@ import noaa.coastwatch.util.ConstrainedStrideLocationIterator;
 import noaa.coastwatch.util.DataLocation;
 import noaa.coastwatch.util.DataVariable;
 import noaa.coastwatch.util.DataVariableIterator;
+import noaa.coastwatch.util.RowSpanSampler;
 import noaa.coastwatch.util.Statistics;
 import noaa.coastwatch.util.trans.EarthTransform;
 
@@ -107,7 +108,7 @@ public class PolygonSurvey
     lc.polygon = shape;
     lc.fraction = 0.01;
     lc.minCount = 1000;
-    Statistics stats = VariableStatisticsGenerator.getInstance().generate (variable, lc);
+    Statistics stats = RowSpanSampler.generate (variable, lc);
 
     // Initialize
     // ----------
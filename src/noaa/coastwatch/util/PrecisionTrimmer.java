@@ -0,0 +1,327 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: PrecisionTrimmer.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util;
+
+// Imports
+// -------
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>PrecisionTrimmer</code> class performs lossy quantization of
+ * floating-point data by rounding the mantissa of each value to a number
+ * of significant bits and setting the remaining trailing bits to zero.
+ * The trimmed values compress much better with lossless compression such
+ * as deflate, while the relative error of each value is bounded by
+ * 2<sup>-(bits+1)</sup>.  Rounding is to the nearest value with ties to
+ * even, known as the "bitround" algorithm in the CF metadata conventions.
+ * NaN, infinite, and missing values are left unchanged.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class PrecisionTrimmer {
+
+  // Constants
+  // ---------
+
+  /** The CF quantization algorithm name for this trimmer. */
+  public static final String ALGORITHM = "bitround";
+
+  /** The number of explicit mantissa bits in a float value. */
+  public static final int FLOAT_MANTISSA_BITS = 23;
+
+  /** The number of explicit mantissa bits in a double value. */
+  public static final int DOUBLE_MANTISSA_BITS = 52;
+
+  // Variables
+  // ---------
+
+  /** The number of mantissa bits to keep. */
+  private int bits;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new trimmer.
+   *
+   * @param bits the number of significant mantissa bits to keep, in
+   * the range [1..52].  Values with fewer mantissa bits than this are
+   * left unchanged.
+   *
+   * @throws IllegalArgumentException if the number of bits is out of range.
+   */
+  public PrecisionTrimmer (
+    int bits
+  ) {
+
+    if (bits < 1 || bits > DOUBLE_MANTISSA_BITS)
+      throw new IllegalArgumentException ("Invalid number of significant bits: " + bits);
+    this.bits = bits;
+
+  } // PrecisionTrimmer constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of significant mantissa bits kept by this trimmer. */
+  public int getBits () { return (bits); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the number of significant mantissa bits needed to preserve a
+   * number of significant decimal digits.
+   *
+   * @param digits the number of significant decimal digits.
+   *
+   * @return the number of significant bits.
+   */
+  public static int getBitsForDigits (
+    int digits
+  ) {
+
+    return ((int) Math.ceil (digits * Math.log (10) / Math.log (2)));
+
+  } // getBitsForDigits
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Determines if a data class can be trimmed.
+   *
+   * @param dataClass the data class to check.
+   *
+   * @return true if the class is a float or double primitive type.
+   */
+  public static boolean isTrimmable (
+    Class dataClass
+  ) {
+
+    return (dataClass.equals (Float.TYPE) || dataClass.equals (Double.TYPE));
+
+  } // isTrimmable
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the number of explicit mantissa bits for a data class.
+   *
+   * @param dataClass the data class to check.
+   *
+   * @return the number of mantissa bits for a float or double primitive
+   * type, or 0 for any other type.
+   */
+  public static int getMantissaBits (
+    Class dataClass
+  ) {
+
+    int bits;
+    if (dataClass.equals (Float.TYPE)) bits = FLOAT_MANTISSA_BITS;
+    else if (dataClass.equals (Double.TYPE)) bits = DOUBLE_MANTISSA_BITS;
+    else bits = 0;
+
+    return (bits);
+
+  } // getMantissaBits
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Trims the precision of data values in place.
+   *
+   * @param data the data array, either <code>float[]</code> or
+   * <code>double[]</code>.  Arrays of other types are left unchanged.
+   * @param missing the missing value to leave unchanged, or null for none.
+   */
+  public void trim (
+    Object data,
+    Object missing
+  ) {
+
+    if (data instanceof float[]) {
+      float missingValue = (missing instanceof Number ? ((Number) missing).floatValue() : Float.NaN);
+      trimFloat ((float[]) data, missingValue);
+    } // if
+    else if (data instanceof double[]) {
+      double missingValue = (missing instanceof Number ? ((Number) missing).doubleValue() : Double.NaN);
+      trimDouble ((double[]) data, missingValue);
+    } // else if
+
+  } // trim
+
+  ////////////////////////////////////////////////////////////
+
+  /** Trims the precision of float values in place. */
+  private void trimFloat (
+    float[] data,
+    float missing
+  ) {
+
+    if (bits >= FLOAT_MANTISSA_BITS) return;
+
+    /**
+     * We round by adding just under one half of the last kept bit,
+     * plus one more if the last kept bit is odd, then masking off
+     * the trailing bits.  A carry out of the mantissa correctly
+     * increments the exponent.  Values with an all-ones exponent
+     * (NaN and infinity) are skipped, as are values whose rounding
+     * would overflow into infinity.
+     */
+    int shift = FLOAT_MANTISSA_BITS - bits;
+    int mask = -1 << shift;
+    int half = (1 << (shift - 1)) - 1;
+    int missingBits = Float.floatToRawIntBits (missing);
+    final int exponentMask = 0x7f800000;
+
+    for (int i = 0; i < data.length; i++) {
+      int value = Float.floatToRawIntBits (data[i]);
+      if ((value & exponentMask) == exponentMask || value == missingBits) continue;
+      int rounded = (value + half + ((value >>> shift) & 1)) & mask;
+      if ((rounded & exponentMask) == exponentMask) rounded = value & mask;
+      data[i] = Float.intBitsToFloat (rounded);
+    } // for
+
+  } // trimFloat
+
+  ////////////////////////////////////////////////////////////
+
+  /** Trims the precision of double values in place. */
+  private void trimDouble (
+    double[] data,
+    double missing
+  ) {
+
+    if (bits >= DOUBLE_MANTISSA_BITS) return;
+
+    int shift = DOUBLE_MANTISSA_BITS - bits;
+    long mask = -1L << shift;
+    long half = (1L << (shift - 1)) - 1;
+    long missingBits = Double.doubleToRawLongBits (missing);
+    final long exponentMask = 0x7ff0000000000000L;
+
+    for (int i = 0; i < data.length; i++) {
+      long value = Double.doubleToRawLongBits (data[i]);
+      if ((value & exponentMask) == exponentMask || value == missingBits) continue;
+      long rounded = (value + half + ((value >>> shift) & 1)) & mask;
+      if ((rounded & exponentMask) == exponentMask) rounded = value & mask;
+      data[i] = Double.longBitsToDouble (rounded);
+    } // for
+
+  } // trimDouble
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (PrecisionTrimmer.class);
+
+    // ------------------------->
+
+    logger.test ("getBitsForDigits");
+
+    assert (getBitsForDigits (1) == 4);
+    assert (getBitsForDigits (3) == 10);
+    assert (getBitsForDigits (4) == 14);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("getMantissaBits");
+
+    assert (getMantissaBits (Float.TYPE) == FLOAT_MANTISSA_BITS);
+    assert (getMantissaBits (Double.TYPE) == DOUBLE_MANTISSA_BITS);
+    assert (getMantissaBits (Short.TYPE) == 0);
+    assert (getBitsForDigits (15) > getMantissaBits (Float.TYPE));
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("trim float");
+
+    int bits = 10;
+    PrecisionTrimmer trimmer = new PrecisionTrimmer (bits);
+    float[] data = new float[10000];
+    for (int i = 0; i < data.length; i++)
+      data[i] = (float) (Math.sin (i*0.01) * 30 + 5 + i*1e-5);
+    data[0] = -999;
+    data[1] = Float.NaN;
+    data[2] = Float.POSITIVE_INFINITY;
+    data[3] = Float.MAX_VALUE;
+    data[4] = 0;
+    float[] original = data.clone();
+    trimmer.trim (data, Float.valueOf (-999));
+
+    assert (data[0] == -999);
+    assert (Float.isNaN (data[1]));
+    assert (data[2] == Float.POSITIVE_INFINITY);
+    assert (!Float.isInfinite (data[3]));
+    assert (data[4] == 0);
+    int trailingMask = (1 << (FLOAT_MANTISSA_BITS - bits)) - 1;
+    double maxError = Math.pow (2, -(bits+1));
+    for (int i = 5; i < data.length; i++) {
+      assert ((Float.floatToRawIntBits (data[i]) & trailingMask) == 0);
+      double error = Math.abs (data[i] - original[i]) / Math.abs (original[i]);
+      assert (error <= maxError);
+    } // for
+
+    float[] again = data.clone();
+    trimmer.trim (again, Float.valueOf (-999));
+    for (int i = 5; i < data.length; i++) assert (again[i] == data[i]);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("trim double");
+
+    double[] doubleData = new double[] {Math.PI, -Math.E, 1e-300, Double.NaN, 1.0};
+    double[] doubleOriginal = doubleData.clone();
+    new PrecisionTrimmer (20).trim (doubleData, null);
+    long doubleMask = (1L << (DOUBLE_MANTISSA_BITS - 20)) - 1;
+    for (int i = 0; i < doubleData.length; i++) {
+      if (Double.isNaN (doubleOriginal[i])) { assert (Double.isNaN (doubleData[i])); continue; }
+      assert ((Double.doubleToRawLongBits (doubleData[i]) & doubleMask) == 0);
+      assert (Math.abs (doubleData[i] - doubleOriginal[i]) / Math.abs (doubleOriginal[i]) <= Math.pow (2, -21));
+    } // for
+    assert (doubleData[4] == 1.0);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // PrecisionTrimmer class
+
+////////////////////////////////////////////////////////////////////////
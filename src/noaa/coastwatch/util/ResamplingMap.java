@@ -35,7 +35,9 @@ import static noaa.coastwatch.util.Grid.COL;
  * to their corresponding nearest neighbour in the source coordinate
  * space.  This allows for a fast nearest neighbour resampling algorithms
  * to run using only the map.  A map covers a specific rectangular
- * extent of the destination coordinate extents.
+ * extent of the destination coordinate extents.  A map may also hold the
+ * fractional source coordinates of each destination coordinate, for use by
+ * interpolating and area-averaging resampling kernels.
  *
  * @author Peter Hollemans
  * @since 3.5.0
@@ -57,6 +59,12 @@ public class ResamplingMap {
   /** The array of source coordinate column values for each destination coordinate. */
   private int[] colMap;
 
+  /** The fractional source row for each destination coordinate, or null. */
+  private float[] rowCoords;
+
+  /** The fractional source column for each destination coordinate, or null. */
+  private float[] colCoords;
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -90,6 +98,59 @@ public class ResamplingMap {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Determines if this map holds fractional source coordinates.
+   *
+   * @return true if fractional coordinates are available, or false if
+   * only the nearest neighbour integer coordinates are available.
+   *
+   * @since 3.7.0
+   */
+  public boolean hasFractionalCoords () { return (rowCoords != null); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Maps the destination coordinates to their corresponding fractional
+   * source coordinates.  If this map holds no fractional coordinates, the
+   * nearest neighbour integer coordinates are returned.
+   *
+   * @param destCoords the destination coordinates to map as [row, col].
+   * The coordinates must be within the destination space extents defined
+   * by the map.
+   * @param sourceCoords the source coordinates as [row, col] (modified).
+   *
+   * @return true if the mapping exists from destination coordinates, or false
+   * if not.  If false, the values in the sourceCoords array are undefined.
+   *
+   * @since 3.7.0
+   */
+  public boolean map (
+    int[] destCoords,
+    double[] sourceCoords
+  ) {
+
+    int mapRow = destCoords[ROW] - start[ROW];
+    int mapCol = destCoords[COL] - start[COL];
+    int index = mapRow*length[COL] + mapCol;
+    boolean isValidMapping = (rowMap[index] != Integer.MIN_VALUE);
+    if (isValidMapping) {
+      if (rowCoords != null) {
+        sourceCoords[ROW] = rowCoords[index];
+        sourceCoords[COL] = colCoords[index];
+      } // if
+      else {
+        sourceCoords[ROW] = rowMap[index];
+        sourceCoords[COL] = colMap[index];
+      } // else
+    } // if
+
+    return (isValidMapping);
+
+  } // map
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Creates a new 2D resampling map.
    *
@@ -118,6 +179,39 @@ public class ResamplingMap {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Creates a new 2D resampling map with fractional source coordinates.
+   *
+   * @param start the starting map coordinates in the destination space.
+   * @param length the map length along each dimension in the destination space.
+   * @param rowMap the source coordinate row mapping from destination
+   * coordinates, as for {@link #ResamplingMap(int[],int[],int[],int[])}.
+   * @param colMap the source coordinate column mapping from destination
+   * coordinates, as for {@link #ResamplingMap(int[],int[],int[],int[])}.
+   * @param rowCoords the fractional source row for each destination
+   * coordinate.  Values are ignored where no mapping exists.
+   * @param colCoords the fractional source column for each destination
+   * coordinate.  Values are ignored where no mapping exists.
+   *
+   * @since 3.7.0
+   */
+  public ResamplingMap (
+    int[] start,
+    int[] length,
+    int[] rowMap,
+    int[] colMap,
+    float[] rowCoords,
+    float[] colCoords
+  ) {
+
+    this (start, length, rowMap, colMap);
+    this.rowCoords = rowCoords;
+    this.colCoords = colCoords;
+
+  } // ResamplingMap constructor
+
+  ////////////////////////////////////////////////////////////
+
 } // ResamplingMap class
 
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,775 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: RowSpanSampler.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util;
+
+// Imports
+// -------
+import java.awt.Polygon;
+import java.awt.Shape;
+import java.awt.geom.PathIterator;
+import java.awt.geom.Rectangle2D;
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.Future;
+import noaa.coastwatch.util.DataIterator;
+import noaa.coastwatch.util.DataLocation;
+import noaa.coastwatch.util.DataLocationConstraints;
+import noaa.coastwatch.util.DataLocationIteratorFactory;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.Grid;
+import noaa.coastwatch.util.LineLocationIterator;
+import noaa.coastwatch.util.Statistics;
+import noaa.coastwatch.util.StatisticsAccumulator;
+import noaa.coastwatch.util.VariableStatisticsGenerator;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>RowSpanSampler</code> class samples a 2D grid over a box,
+ * polygon, or line of data locations.  The locations are converted once
+ * to spans of columns in each sampled row, so that the grid is read a
+ * span at a time as arrays of raw values rather than one location and
+ * one scaled value at a time as with a {@link DataLocationIterator}.
+ * Statistics are computed in a single pass using a
+ * {@link StatisticsAccumulator}, in parallel over bands of rows for
+ * large samples.  The sampled locations are the same as those of the
+ * iterator created by {@link DataLocationIteratorFactory} for the same
+ * constraints.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class RowSpanSampler {
+
+  // Constants
+  // ---------
+
+  /** The number of samples above which statistics are computed in parallel. */
+  private static final int PARALLEL_SAMPLES = 65536;
+
+  /** The number of grid rows covered by each parallel band. */
+  private static final int BAND_HEIGHT = 64;
+
+  /** The flatness used for converting curved shapes to line segments. */
+  private static final double FLATNESS = 0.01;
+
+  // Variables
+  // ---------
+
+  /** The sampled rows in increasing order. */
+  private int[] rows;
+
+  /**
+   * The column spans for each sampled row as [start, end] pairs of
+   * sampled columns, inclusive and in increasing order.
+   */
+  private int[][] spans;
+
+  /** The column stride between sampled values in a span. */
+  private int colStride;
+
+  /** The line locations as [row, col] in line order, or null if not a line. */
+  private int[][] linePoints;
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates a new sampler from the specified spans. */
+  private RowSpanSampler (
+    int[] rows,
+    int[][] spans,
+    int colStride,
+    int[][] linePoints
+  ) {
+
+    this.rows = rows;
+    this.spans = spans;
+    this.colStride = colStride;
+    this.linePoints = linePoints;
+
+  } // RowSpanSampler constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Determines if a variable can be sampled by spans.  The variable must
+   * be a grid with no navigation correction, since the navigation would
+   * move the data locations off their rows.
+   *
+   * @param var the variable to check.
+   *
+   * @return true if the variable can be sampled.
+   */
+  public static boolean canSample (
+    DataVariable var
+  ) {
+
+    return (var instanceof Grid && ((Grid) var).getNavigation().isIdentity());
+
+  } // canSample
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a sampler for a box of data locations.  The sampled
+   * locations are start + k*stride, rounded to the nearest row and
+   * column, up to the end location.
+   *
+   * @param start the box starting location.
+   * @param end the box ending location, with coordinates &gt;= the
+   * starting location.
+   * @param stride the sampling stride as [row, column].
+   *
+   * @return the new sampler.
+   */
+  public static RowSpanSampler forBox (
+    DataLocation start,
+    DataLocation end,
+    int[] stride
+  ) {
+
+    int rowCount = (int) Math.floor ((end.get (Grid.ROWS) - start.get (Grid.ROWS)) / stride[Grid.ROWS]) + 1;
+    int colCount = (int) Math.floor ((end.get (Grid.COLS) - start.get (Grid.COLS)) / stride[Grid.COLS]) + 1;
+    rowCount = Math.max (rowCount, 0);
+    int firstRow = (int) Math.round (start.get (Grid.ROWS));
+    int firstCol = (int) Math.round (start.get (Grid.COLS));
+
+    int[] rows = new int[rowCount];
+    int[][] spans = new int[rowCount][];
+    int[] span = (colCount > 0 ?
+      new int[] {firstCol, firstCol + (colCount-1)*stride[Grid.COLS]} : new int[0]);
+    for (int i = 0; i < rowCount; i++) {
+      rows[i] = firstRow + i*stride[Grid.ROWS];
+      spans[i] = span;
+    } // for
+
+    return (new RowSpanSampler (rows, spans, stride[Grid.COLS], null));
+
+  } // forBox
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a sampler for the data locations inside a polygon shape.
+   * The shape coordinates are interpreted as (row, column).  The sampled
+   * locations are the points (minRow + k*rowStride, minCol +
+   * m*colStride) from the shape bounds that are contained in the shape,
+   * rounded to the nearest row and column.
+   *
+   * @param shape the polygon shape.
+   * @param stride the sampling stride as [row, column].
+   *
+   * @return the new sampler.
+   */
+  public static RowSpanSampler forPolygon (
+    Shape shape,
+    int[] stride
+  ) {
+
+    // Get edges
+    // ---------
+    List<double[]> edges = new ArrayList<>();
+    PathIterator path = shape.getPathIterator (null, FLATNESS);
+    boolean isEvenOdd = (path.getWindingRule() == PathIterator.WIND_EVEN_ODD);
+    double[] coords = new double[6];
+    double startX = 0, startY = 0, lastX = 0, lastY = 0;
+    while (!path.isDone()) {
+      int type = path.currentSegment (coords);
+      if (type == PathIterator.SEG_MOVETO || type == PathIterator.SEG_CLOSE) {
+        if (lastX != startX || lastY != startY)
+          edges.add (new double[] {lastX, lastY, startX, startY});
+        if (type == PathIterator.SEG_MOVETO) { startX = coords[0]; startY = coords[1]; }
+        lastX = startX;
+        lastY = startY;
+      } // if
+      else {
+        edges.add (new double[] {lastX, lastY, coords[0], coords[1]});
+        lastX = coords[0];
+        lastY = coords[1];
+      } // else
+      path.next();
+    } // while
+    if (lastX != startX || lastY != startY)
+      edges.add (new double[] {lastX, lastY, startX, startY});
+
+    // Compute spans for each sampled row
+    // ----------------------------------
+    /**
+     * Each row crosses the edges at a set of columns, and the columns
+     * between crossings are inside or outside the shape according to the
+     * winding rule.  The span ends are then checked against the shape
+     * itself, so that rounding in the crossings never disagrees with
+     * the shape at the boundary.
+     */
+    Rectangle2D bounds = shape.getBounds2D();
+    double minX = bounds.getMinX(), minY = bounds.getMinY();
+    int rowStride = stride[Grid.ROWS], colStride = stride[Grid.COLS];
+    int rowCount = (int) Math.floor ((bounds.getMaxX() - minX) / rowStride) + 1;
+    int maxCol = (int) Math.floor ((bounds.getMaxY() - minY) / colStride);
+    int firstCol = (int) Math.round (minY);
+
+    List<Integer> rowList = new ArrayList<>();
+    List<int[]> spanList = new ArrayList<>();
+    double[][] crossings = new double[edges.size()][];
+    for (int k = 0; k < rowCount; k++) {
+      double x = minX + k*rowStride;
+
+      // Find crossings
+      // --------------
+      int count = 0;
+      for (double[] edge : edges) {
+        double x1 = edge[0], y1 = edge[1], x2 = edge[2], y2 = edge[3];
+        if ((x1 <= x && x < x2) || (x2 <= x && x < x1)) {
+          double y = y1 + (x - x1)*(y2 - y1)/(x2 - x1);
+          crossings[count++] = new double[] {y, (x2 > x1 ? 1 : -1)};
+        } // if
+      } // for
+      if (count == 0) continue;
+      Arrays.sort (crossings, 0, count, (a, b) -> Double.compare (a[0], b[0]));
+
+      // Convert inside intervals to sampled columns
+      // -------------------------------------------
+      List<Integer> ends = new ArrayList<>();
+      int winding = 0;
+      double low = 0;
+      for (int i = 0; i < count; i++) {
+        boolean wasInside = (isEvenOdd ? (winding & 1) != 0 : winding != 0);
+        winding += (int) crossings[i][1];
+        boolean isInside = (isEvenOdd ? (winding & 1) != 0 : winding != 0);
+        if (!wasInside && isInside) low = crossings[i][0];
+        else if (wasInside && !isInside) {
+          int first = Math.max (0, (int) Math.ceil ((low - minY) / colStride));
+          int last = Math.min (maxCol, (int) Math.floor ((crossings[i][0] - minY) / colStride));
+          while (first <= last && !shape.contains (x, minY + first*colStride)) first++;
+          while (last >= first && !shape.contains (x, minY + last*colStride)) last--;
+          if (first > last) continue;
+          if (first > 0 && shape.contains (x, minY + (first-1)*colStride)) first--;
+          if (last < maxCol && shape.contains (x, minY + (last+1)*colStride)) last++;
+          int size = ends.size();
+          if (size != 0 && first <= ends.get (size-1) + 1)
+            ends.set (size-1, Math.max (last, ends.get (size-1)));
+          else {
+            ends.add (first);
+            ends.add (last);
+          } // else
+        } // else if
+      } // for
+
+      // Add row spans
+      // -------------
+      if (ends.size() == 0) continue;
+      int[] span = new int[ends.size()];
+      for (int i = 0; i < span.length; i++) span[i] = firstCol + ends.get (i)*colStride;
+      rowList.add ((int) Math.round (x));
+      spanList.add (span);
+
+    } // for
+
+    int[] rows = new int[rowList.size()];
+    for (int i = 0; i < rows.length; i++) rows[i] = rowList.get (i);
+
+    return (new RowSpanSampler (rows, spanList.toArray (new int[0][]), colStride, null));
+
+  } // forPolygon
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a sampler for the data locations along a line.  The
+   * locations are the same as those of a {@link LineLocationIterator},
+   * and values are returned by {@link #getValues} in line order.
+   *
+   * @param start the line starting location.
+   * @param end the line ending location.
+   *
+   * @return the new sampler.
+   */
+  public static RowSpanSampler forLine (
+    DataLocation start,
+    DataLocation end
+  ) {
+
+    // Get line points
+    // ---------------
+    List<int[]> pointList = new ArrayList<>();
+    LineLocationIterator iter = new LineLocationIterator (start, end);
+    DataLocation loc = new DataLocation (2);
+    while (iter.hasNext()) {
+      iter.nextLocation (loc);
+      pointList.add (new int[] {(int) loc.get (Grid.ROWS), (int) loc.get (Grid.COLS)});
+    } // while
+    int[][] linePoints = pointList.toArray (new int[0][]);
+
+    // Create one span per row
+    // -----------------------
+    int[][] sorted = linePoints.clone();
+    Arrays.sort (sorted, (a, b) -> Integer.compare (a[0], b[0]));
+    List<Integer> rowList = new ArrayList<>();
+    List<int[]> spanList = new ArrayList<>();
+    for (int[] point : sorted) {
+      int last = rowList.size()-1;
+      if (last >= 0 && rowList.get (last) == point[0]) {
+        int[] span = spanList.get (last);
+        span[0] = Math.min (span[0], point[1]);
+        span[1] = Math.max (span[1], point[1]);
+      } // if
+      else {
+        rowList.add (point[0]);
+        spanList.add (new int[] {point[1], point[1]});
+      } // else
+    } // for
+    int[] rows = new int[rowList.size()];
+    for (int i = 0; i < rows.length; i++) rows[i] = rowList.get (i);
+
+    return (new RowSpanSampler (rows, spanList.toArray (new int[0][]), 1, linePoints));
+
+  } // forLine
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a sampler for a set of data location constraints, as an
+   * alternative to {@link DataLocationIteratorFactory#create}.  The
+   * constraints must specify a polygon or a start and end location, and
+   * a stride or coverage fraction.
+   *
+   * @param constraints the data location constraints.
+   *
+   * @return the new sampler.
+   *
+   * @throws IllegalArgumentException if the constraints do not specify
+   * a polygon or box with a stride or coverage fraction.
+   */
+  public static RowSpanSampler create (
+    DataLocationConstraints constraints
+  ) {
+
+    if (constraints.fraction == 0 && constraints.stride == null)
+      throw new IllegalArgumentException ("No coverage or stride specified");
+
+    // Create polygon sampler
+    // ----------------------
+    RowSpanSampler sampler;
+    Shape polygon = constraints.polygon;
+    if (polygon != null) {
+      DataLocation[] bounds = DataLocationConstraints.getShapeBounds (polygon);
+      if (bounds == null)
+        throw new IllegalArgumentException ("Polygon has zero area");
+      int[] stride = constraints.stride;
+      if (stride == null) {
+        double fraction = constraints.fraction;
+        int minCount = constraints.minCount;
+        double polygonArea = DataLocationConstraints.getShapeArea (polygon);
+        if (polygonArea != 0) {
+          fraction = Math.min (fraction / polygonArea, 1);
+          minCount = (int) (minCount / polygonArea);
+        } // if
+        stride = DataLocationIteratorFactory.getInstance().getOptimalStride (
+          bounds[0], bounds[1], fraction, minCount);
+      } // if
+      sampler = forPolygon (polygon, stride);
+    } // if
+
+    // Create box sampler
+    // ------------------
+    else {
+      if (constraints.start == null || constraints.end == null)
+        throw new IllegalArgumentException ("No start and end locations specified");
+      int[] stride = constraints.stride;
+      if (stride == null) {
+        stride = DataLocationIteratorFactory.getInstance().getOptimalStride (
+          constraints.start, constraints.end, constraints.fraction,
+          constraints.minCount);
+      } // if
+      sampler = forBox (constraints.start, constraints.end, stride);
+    } // else
+
+    return (sampler);
+
+  } // create
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Generates statistics for a variable over a polygon or box.  If the
+   * variable can be sampled by spans, a sampler is used, otherwise the
+   * statistics are generated by {@link VariableStatisticsGenerator}.
+   *
+   * @param var the variable to get data from.
+   * @param constraints the data location constraints.
+   *
+   * @return the data statistics.
+   *
+   * @see #create
+   */
+  public static Statistics generate (
+    DataVariable var,
+    DataLocationConstraints constraints
+  ) {
+
+    Statistics stats = null;
+    if (canSample (var))
+      stats = create (constraints).getStatistics ((Grid) var);
+    if (stats == null)
+      stats = VariableStatisticsGenerator.getInstance().generate (var, constraints);
+
+    return (stats);
+
+  } // generate
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the total number of sampled locations. */
+  public int getCount () {
+
+    if (linePoints != null) return (linePoints.length);
+    int count = 0;
+    for (int[] span : spans) {
+      for (int j = 0; j < span.length; j += 2)
+        count += (span[j+1] - span[j])/colStride + 1;
+    } // for
+
+    return (count);
+
+  } // getCount
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Clips a span to the grid columns.
+   *
+   * @return the clipped span as [start, end], with start &gt; end if
+   * no sampled columns are inside the grid.
+   */
+  private int[] clip (
+    int start,
+    int end,
+    int cols
+  ) {
+
+    if (start < 0) start += ((-start + colStride-1)/colStride)*colStride;
+    if (end > cols-1) end -= ((end - (cols-1) + colStride-1)/colStride)*colStride;
+
+    return (new int[] {start, end});
+
+  } // clip
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Accumulates the raw values in a range of sampled rows.  Locations
+   * outside the grid are counted as invalid.
+   */
+  private void accumulate (
+    Grid grid,
+    Object gridLock,
+    int firstIndex,
+    int lastIndex,
+    StatisticsAccumulator accumulator
+  ) {
+
+    int[] dims = grid.getDimensions();
+    for (int i = firstIndex; i <= lastIndex; i++) {
+      int[] span = spans[i];
+      for (int j = 0; j < span.length; j += 2) {
+        int count = (span[j+1] - span[j])/colStride + 1;
+        if (rows[i] < 0 || rows[i] > dims[Grid.ROWS]-1) {
+          accumulator.addInvalid (count);
+          continue;
+        } // if
+        int[] clipped = clip (span[j], span[j+1], dims[Grid.COLS]);
+        int sampled = (clipped[0] > clipped[1] ? 0 : (clipped[1] - clipped[0])/colStride + 1);
+        if (sampled != count) accumulator.addInvalid (count - sampled);
+        if (sampled == 0) continue;
+        Object data;
+        synchronized (gridLock) {
+          data = grid.getData (new int[] {rows[i], clipped[0]},
+            new int[] {1, clipped[1] - clipped[0] + 1});
+        } // synchronized
+        accumulator.accumulate (data, 0, colStride, sampled);
+      } // for
+    } // for
+
+  } // accumulate
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Computes the statistics of a grid over the sampled locations.
+   *
+   * @param grid the grid to sample.
+   *
+   * @return the statistics, or null if the grid data cannot be
+   * accumulated, for example floating-point data with a lookup table.
+   */
+  public Statistics getStatistics (
+    Grid grid
+  ) {
+
+    // Create bands
+    // ------------
+    List<int[]> bands = new ArrayList<>();
+    int bandStart = 0;
+    for (int i = 1; i <= rows.length; i++) {
+      if (i == rows.length || rows[i] - rows[bandStart] >= BAND_HEIGHT) {
+        bands.add (new int[] {bandStart, i-1});
+        bandStart = i;
+      } // if
+    } // for
+
+    // Accumulate serially
+    // -------------------
+    /**
+     * Grids are not safe for concurrent reads, so reads are made under
+     * a lock and the threads overlap only the accumulation.  For tiled
+     * grids, the rows in a band are mostly read from the same tiles.
+     */
+    StatisticsAccumulator accumulator = new StatisticsAccumulator (grid);
+    Object gridLock = new Object();
+    int processors = Runtime.getRuntime().availableProcessors();
+    if (getCount() < PARALLEL_SAMPLES || bands.size() < 2 || processors < 2) {
+      for (int[] band : bands)
+        accumulate (grid, gridLock, band[0], band[1], accumulator);
+    } // if
+
+    // Accumulate in parallel
+    // ----------------------
+    else {
+      ExecutorService executor = Executors.newFixedThreadPool (Math.min (processors, bands.size()));
+      try {
+        List<Future<StatisticsAccumulator>> futures = new ArrayList<>();
+        for (int[] band : bands) {
+          futures.add (executor.submit (() -> {
+            StatisticsAccumulator bandAccumulator = new StatisticsAccumulator (grid);
+            accumulate (grid, gridLock, band[0], band[1], bandAccumulator);
+            return (bandAccumulator);
+          }));
+        } // for
+        for (Future<StatisticsAccumulator> future : futures)
+          accumulator.merge (future.get());
+      } // try
+      catch (InterruptedException e) {
+        Thread.currentThread().interrupt();
+        throw new RuntimeException (e);
+      } // catch
+      catch (ExecutionException e) {
+        Throwable cause = e.getCause();
+        if (cause instanceof RuntimeException) throw (RuntimeException) cause;
+        throw new RuntimeException (cause);
+      } // catch
+      finally {
+        executor.shutdownNow();
+      } // finally
+    } // else
+
+    return (accumulator.getStatistics());
+
+  } // getStatistics
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the scaled grid values at the sampled locations.  For a line,
+   * the values are in line order.  Otherwise the values are in row
+   * order, and in column order within each row.
+   *
+   * @param grid the grid to sample.
+   *
+   * @return the values, with <code>Double.NaN</code> for missing values
+   * and locations outside the grid.
+   */
+  public double[] getValues (
+    Grid grid
+  ) {
+
+    // Read spans
+    // ----------
+    int[] dims = grid.getDimensions();
+    double[][] rowValues = new double[rows.length][];
+    for (int i = 0; i < rows.length; i++) {
+      int[] span = spans[i];
+      int count = 0;
+      for (int j = 0; j < span.length; j += 2) count += (span[j+1] - span[j])/colStride + 1;
+      double[] values = new double[count];
+      Arrays.fill (values, Double.NaN);
+      rowValues[i] = values;
+      if (rows[i] < 0 || rows[i] > dims[Grid.ROWS]-1) continue;
+      int index = 0;
+      for (int j = 0; j < span.length; j += 2) {
+        int[] clipped = clip (span[j], span[j+1], dims[Grid.COLS]);
+        int offset = index + (clipped[0] - span[j])/colStride;
+        index += (span[j+1] - span[j])/colStride + 1;
+        if (clipped[0] > clipped[1]) continue;
+        Object data = grid.getData (new int[] {rows[i], clipped[0]},
+          new int[] {1, clipped[1] - clipped[0] + 1});
+        for (int k = 0, col = 0; col <= clipped[1] - clipped[0]; k++, col += colStride)
+          values[offset + k] = grid.getValue (col, data);
+      } // for
+    } // for
+
+    // Order values
+    // ------------
+    double[] values;
+    if (linePoints != null) {
+      values = new double[linePoints.length];
+      for (int k = 0; k < linePoints.length; k++) {
+        int i = Arrays.binarySearch (rows, linePoints[k][0]);
+        values[k] = rowValues[i][linePoints[k][1] - spans[i][0]];
+      } // for
+    } // if
+    else {
+      values = new double[getCount()];
+      int index = 0;
+      for (double[] row : rowValues) {
+        System.arraycopy (row, 0, values, index, row.length);
+        index += row.length;
+      } // for
+    } // else
+
+    return (values);
+
+  } // getValues
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a statistics object for an array of values, with the values
+   * saved in the statistics.
+   *
+   * @param values the values to use.
+   *
+   * @return the statistics for the values.
+   */
+  public static Statistics getStatistics (
+    final double[] values
+  ) {
+
+    return (new Statistics (new DataIterator () {
+        private int index = 0;
+        public double nextDouble () { return (values[index++]); }
+        public void reset () { index = 0; }
+        public boolean hasNext () { return (index < values.length); }
+        public void remove () { throw new UnsupportedOperationException(); }
+        public Double next () { return (Double.valueOf (nextDouble())); }
+      }, true));
+
+  } // getStatistics
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (RowSpanSampler.class);
+
+    int rows = 300, cols = 400;
+    short[] data = new short[rows*cols];
+    for (int i = 0; i < data.length; i++) {
+      data[i] = (short) ((i/cols)*7 + (i%cols)*3 + (i%11));
+      if (i%37 == 0) data[i] = -1;
+    } // for
+    Grid grid = new Grid ("test", "test", "celsius", rows, cols, data,
+      new java.text.DecimalFormat ("0.00"), new double[] {0.1, 5}, Short.valueOf ((short) -1));
+
+    // ------------------------->
+
+    logger.test ("forBox, forPolygon against iterators");
+
+    Polygon polygon = new Polygon();
+    polygon.addPoint (10, 20);
+    polygon.addPoint (250, 60);
+    polygon.addPoint (200, 390);
+    polygon.addPoint (120, 200);
+    polygon.addPoint (30, 350);
+
+    for (int pass = 0; pass < 3; pass++) {
+      DataLocationConstraints lc = new DataLocationConstraints();
+      if (pass == 0) {
+        lc.start = new DataLocation (-10.3, 15.6);
+        lc.end = new DataLocation (280.2, 420.7);
+        lc.stride = new int[] {3, 3};
+      } // if
+      else {
+        lc.polygon = polygon;
+        lc.stride = new int[] {pass, pass};
+      } // else
+
+      RowSpanSampler sampler = create (lc);
+      Statistics stats = sampler.getStatistics (grid);
+      DataLocationIterator iter = DataLocationIteratorFactory.getInstance().create (lc);
+      Statistics expected = new Statistics (new DataVariableIterator (grid, iter));
+      assert (sampler.getCount() == expected.getValues());
+      assert (stats.getValues() == expected.getValues());
+      assert (stats.getValid() == expected.getValid());
+      assert (stats.getMin() == expected.getMin());
+      assert (stats.getMax() == expected.getMax());
+      assert (Math.abs (stats.getMean() - expected.getMean()) < 1e-9);
+      assert (Math.abs (stats.getStdev() - expected.getStdev()) < 1e-9);
+
+      double[] values = sampler.getValues (grid);
+      iter.reset();
+      for (int i = 0; i < values.length; i++) {
+        double value = grid.getValue (iter.next());
+        assert (Double.compare (values[i], value) == 0);
+      } // for
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("forLine");
+
+    DataLocation start = new DataLocation (250, 10);
+    DataLocation end = new DataLocation (5, 380);
+    RowSpanSampler sampler = forLine (start, end);
+    double[] values = sampler.getValues (grid);
+    Statistics stats = getStatistics (values);
+    Statistics expected = new Statistics (new DataVariableIterator (grid,
+      new LineLocationIterator (start, end)), true);
+    assert (stats.getValues() == expected.getValues());
+    for (int i = 0; i < values.length; i++)
+      assert (Double.compare (stats.getData (i), expected.getData (i)) == 0);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // RowSpanSampler class
+
+////////////////////////////////////////////////////////////////////////
@@ -25,14 +25,21 @@ package noaa.coastwatch.util;
 
 // Imports
 // -------
+import java.lang.reflect.Array;
 import java.util.Arrays;
+import java.util.Iterator;
+import java.util.Map;
 import java.util.Random;
 import noaa.coastwatch.util.DataIterator;
 
 /**
  * The statistics class is a container for various data variable
  * statistics such as minimum, maximum, mean, standard deviation,
- * histogram counts, and so on.
+ * histogram counts, and so on.  Statistics may also be stored as a
+ * summary in a set of metadata attributes, for example by a data writer
+ * that computes statistics while writing, and recreated later from the
+ * attributes without accessing the data (see {@link #putAttributes} and
+ * {@link #fromAttributes}).
  *
  * @author Peter Hollemans
  * @since 3.1.6
@@ -43,7 +50,22 @@ public class Statistics {
   // ---------
 
   /** The number of histogram bins. */
-  private static final int HISTOGRAM_BINS = 100;
+  public static final int HISTOGRAM_BINS = 100;
+
+  /** 
+   * The percentile levels computed along with the statistics. 
+   *
+   * @since 3.7.0
+   */
+  public static final double[] PERCENTILE_LEVELS = 
+    new double[] {1, 2, 5, 10, 25, 50, 75, 90, 95, 98, 99};
+
+  /**
+   * The prefix for the names of statistics summary metadata attributes.
+   *
+   * @since 3.7.0
+   */
+  public static final String ATTRIBUTE_PREFIX = "stats_";
 
   // Variables
   // ---------
@@ -84,6 +106,9 @@ public class Statistics {
   /** The median value of the data. */
   private double median;
 
+  /** The data values at each percentile level, or null if none. */
+  private double[] percentiles;
+
   ////////////////////////////////////////////////////////////
 
   /** Gets a test statistics object with normal distribution. */
@@ -152,6 +177,46 @@ public class Statistics {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets a percentile value of the data.  The value is interpolated
+   * linearly between the values computed at the percentile levels in
+   * {@link #PERCENTILE_LEVELS}, and the minimum and maximum at the 0
+   * and 100 levels.
+   *
+   * @param level the percentile level in the range [0..100].
+   *
+   * @return the data value at the percentile level, or
+   * <code>Double.NaN</code> if there are no valid data values.
+   *
+   * @since 3.7.0
+   */
+  public double getPercentile (
+    double level
+  ) {
+
+    if (percentiles == null) return (Double.NaN);
+    if (level <= 0) return (min);
+    if (level >= 100) return (max);
+
+    double lastLevel = 0;
+    double lastValue = min;
+    for (int i = 0; i <= PERCENTILE_LEVELS.length; i++) {
+      double nextLevel = (i < PERCENTILE_LEVELS.length ? PERCENTILE_LEVELS[i] : 100);
+      double nextValue = (i < PERCENTILE_LEVELS.length ? percentiles[i] : max);
+      if (level <= nextLevel) {
+        double weight = (level - lastLevel) / (nextLevel - lastLevel);
+        return (lastValue + weight*(nextValue - lastValue));
+      } // if
+      lastLevel = nextLevel;
+      lastValue = nextValue;
+    } // for
+
+    return (max);
+
+  } // getPercentile
+
+  ////////////////////////////////////////////////////////////
+
   /**
    * Gets the specified data value.  This is only possible if the
    * <code>saveData</code> flag was specified to be true in the
@@ -256,6 +321,8 @@ public class Statistics {
     if (valid == 1) {
       stdev = 0;
       median = mean;
+      percentiles = new double[PERCENTILE_LEVELS.length];
+      Arrays.fill (percentiles, mean);
       return;
     } // if
 
@@ -337,10 +404,262 @@ public class Statistics {
     else
       median = medianDataArray[(valid+1)/2 - 1];
 
+    // Calculate percentile values
+    // ---------------------------
+    percentiles = new double[PERCENTILE_LEVELS.length];
+    for (int i = 0; i < PERCENTILE_LEVELS.length; i++) {
+      double rank = PERCENTILE_LEVELS[i]/100 * (valid-1);
+      int lower = (int) Math.floor (rank);
+      int upper = Math.min (lower+1, valid-1);
+      double weight = rank - lower;
+      percentiles[i] = medianDataArray[lower] + 
+        weight*(medianDataArray[upper] - medianDataArray[lower]);
+    } // for
+
   } // Statistics constructor
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Creates a new set of statistics from previously computed summary
+   * values.
+   *
+   * @param values the total number of data values, including invalid data.
+   * @param valid the total number of valid data values.
+   * @param min the minimum data value.
+   * @param max the maximum data value.
+   * @param mean the mean data value.
+   * @param stdev the standard deviation from the mean.
+   * @param adev the average deviation from the mean.
+   * @param median the median data value.
+   * @param percentiles the data values at each of the percentile levels 
+   * in {@link #PERCENTILE_LEVELS}, or null if not available.
+   * @param histogram the histogram counts in {@link #HISTOGRAM_BINS} 
+   * equal width bins between the minimum and maximum, or null if not 
+   * available.
+   *
+   * @throws IllegalArgumentException if the percentiles or histogram 
+   * array has the wrong length.
+   *
+   * @since 3.7.0
+   */
+  public Statistics (
+    int values,
+    int valid,
+    double min,
+    double max,
+    double mean,
+    double stdev,
+    double adev,
+    double median,
+    double[] percentiles,
+    int[] histogram
+  ) {
+
+    if (percentiles != null && percentiles.length != PERCENTILE_LEVELS.length)
+      throw new IllegalArgumentException ("Invalid percentiles length " + percentiles.length);
+    if (histogram != null && histogram.length != HISTOGRAM_BINS)
+      throw new IllegalArgumentException ("Invalid histogram length " + histogram.length);
+
+    this.values = values;
+    this.valid = valid;
+    this.min = min;
+    this.max = max;
+    this.mean = mean;
+    this.stdev = stdev;
+    this.adev = adev;
+    this.median = median;
+    this.percentiles = percentiles;
+    this.histogram = histogram;
+
+    if (histogram != null) {
+      binWidth = (max-min)/HISTOGRAM_BINS;
+      maxCountBin = 0;
+      for (int i = 1; i < HISTOGRAM_BINS; i++) {
+        if (histogram[i] > histogram[maxCountBin]) maxCountBin = i;
+      } // for
+    } // if
+
+  } // Statistics constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Stores a summary of these statistics as metadata attributes.  The
+   * attribute names all start with {@link #ATTRIBUTE_PREFIX}.  Saved data
+   * values are not stored.
+   *
+   * @param map the map to store the attributes in.
+   *
+   * @since 3.7.0
+   */
+  public void putAttributes (
+    Map map
+  ) {
+
+    map.put (ATTRIBUTE_PREFIX + "values", Integer.valueOf (values));
+    map.put (ATTRIBUTE_PREFIX + "valid", Integer.valueOf (valid));
+    map.put (ATTRIBUTE_PREFIX + "min", Double.valueOf (min));
+    map.put (ATTRIBUTE_PREFIX + "max", Double.valueOf (max));
+    map.put (ATTRIBUTE_PREFIX + "mean", Double.valueOf (mean));
+    map.put (ATTRIBUTE_PREFIX + "stdev", Double.valueOf (stdev));
+    map.put (ATTRIBUTE_PREFIX + "adev", Double.valueOf (adev));
+    map.put (ATTRIBUTE_PREFIX + "median", Double.valueOf (median));
+    if (percentiles != null) {
+      map.put (ATTRIBUTE_PREFIX + "percentile_levels", PERCENTILE_LEVELS.clone());
+      map.put (ATTRIBUTE_PREFIX + "percentiles", percentiles.clone());
+    } // if
+    if (histogram != null)
+      map.put (ATTRIBUTE_PREFIX + "histogram", histogram.clone());
+
+  } // putAttributes
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Removes any statistics summary attributes from a metadata map.
+   * This should be done whenever the data that the summary describes
+   * is modified.
+   *
+   * @param map the map to remove the attributes from.
+   *
+   * @since 3.7.0
+   */
+  public static void removeAttributes (
+    Map map
+  ) {
+
+    for (Iterator iter = map.keySet().iterator(); iter.hasNext();) {
+      if (iter.next().toString().startsWith (ATTRIBUTE_PREFIX)) iter.remove();
+    } // for
+
+  } // removeAttributes
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Copies any statistics summary attributes from one metadata map to
+   * another.  This should only be done when the destination describes
+   * exactly the same data values as the source.
+   *
+   * @param source the map to copy the attributes from.
+   * @param dest the map to copy the attributes to.
+   *
+   * @since 3.7.0
+   */
+  public static void copyAttributes (
+    Map source,
+    Map dest
+  ) {
+
+    for (Iterator iter = source.entrySet().iterator(); iter.hasNext();) {
+      Map.Entry entry = (Map.Entry) iter.next();
+      if (entry.getKey().toString().startsWith (ATTRIBUTE_PREFIX))
+        dest.put (entry.getKey(), entry.getValue());
+    } // for
+
+  } // copyAttributes
+
+  ////////////////////////////////////////////////////////////
+
+  /** 
+   * Gets an attribute value as a double array, or null if the value is
+   * not a number or array of numbers.
+   */
+  private static double[] getAttributeArray (
+    Map map,
+    String name
+  ) {
+
+    Object value = map.get (ATTRIBUTE_PREFIX + name);
+    double[] array = null;
+    if (value instanceof Number)
+      array = new double[] {((Number) value).doubleValue()};
+    else if (value != null && value.getClass().isArray()) {
+      int length = Array.getLength (value);
+      array = new double[length];
+      for (int i = 0; i < length; i++) {
+        Object element = Array.get (value, i);
+        if (!(element instanceof Number)) return (null);
+        array[i] = ((Number) element).doubleValue();
+      } // for
+    } // else if
+
+    return (array);
+
+  } // getAttributeArray
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets an attribute value as a double, or NaN if not available. */
+  private static double getAttributeValue (
+    Map map,
+    String name
+  ) {
+
+    double[] array = getAttributeArray (map, name);
+    return (array != null && array.length == 1 ? array[0] : Double.NaN);
+
+  } // getAttributeValue
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new set of statistics from summary metadata attributes.
+   * Attribute values may be stored either as single numbers or as
+   * arrays of numbers, as read back from a data file.
+   *
+   * @param map the map to read the attributes from.
+   *
+   * @return the statistics or null if the map does not contain a
+   * complete statistics summary.
+   *
+   * @see #putAttributes
+   *
+   * @since 3.7.0
+   */
+  public static Statistics fromAttributes (
+    Map map
+  ) {
+
+    // Get required values
+    // -------------------
+    double values = getAttributeValue (map, "values");
+    double valid = getAttributeValue (map, "valid");
+    if (Double.isNaN (values) || Double.isNaN (valid)) return (null);
+    double min = getAttributeValue (map, "min");
+    double max = getAttributeValue (map, "max");
+    double mean = getAttributeValue (map, "mean");
+    double stdev = getAttributeValue (map, "stdev");
+    if (valid != 0 && (Double.isNaN (min) || Double.isNaN (max) || 
+      Double.isNaN (mean) || Double.isNaN (stdev))) return (null);
+
+    // Get percentiles
+    // ---------------
+    double[] levels = getAttributeArray (map, "percentile_levels");
+    double[] percentiles = getAttributeArray (map, "percentiles");
+    if (levels == null || percentiles == null || 
+      !Arrays.equals (levels, PERCENTILE_LEVELS) || 
+      percentiles.length != PERCENTILE_LEVELS.length)
+      percentiles = null;
+
+    // Get histogram
+    // -------------
+    double[] counts = getAttributeArray (map, "histogram");
+    int[] histogram = null;
+    if (counts != null && counts.length == HISTOGRAM_BINS) {
+      histogram = new int[HISTOGRAM_BINS];
+      for (int i = 0; i < HISTOGRAM_BINS; i++) histogram[i] = (int) counts[i];
+    } // if
+
+    return (new Statistics ((int) values, (int) valid, min, max, mean, stdev,
+      getAttributeValue (map, "adev"), getAttributeValue (map, "median"),
+      percentiles, histogram));
+
+  } // fromAttributes
+
+  ////////////////////////////////////////////////////////////
+
   /** 
    * Gets the histogram count for a data value.
    * 
@@ -0,0 +1,751 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: StatisticsAccumulator.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util;
+
+// Imports
+// -------
+import java.lang.reflect.Array;
+import java.util.Arrays;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.Map;
+import noaa.coastwatch.test.TestLogger;
+import noaa.coastwatch.util.DataIterator;
+import noaa.coastwatch.util.DataVariable;
+import noaa.coastwatch.util.Statistics;
+
+/**
+ * The <code>StatisticsAccumulator</code> class computes the statistics of
+ * a data variable in a single pass over blocks of raw data values, for
+ * example while the variable is being written tile by tile.  Blocks may
+ * be accumulated in any order and from multiple threads.  The data
+ * values themselves are not stored.  Instead, each value is counted in
+ * one of 65536 fine histogram bins:
+ * <ul>
+ *
+ *   <li>For 8- and 16-bit integer data, each bin holds exactly one raw
+ *   value, and all statistics are exact.</li>
+ *
+ *   <li>For other data types, each bin holds a range of scaled data
+ *   values with the same upper 16 bits of single precision floating
+ *   point representation, or about 2 to 3 significant digits.  The
+ *   minimum, maximum, mean, and standard deviation are exact, and the
+ *   median, percentiles, average deviation, and histogram are
+ *   interpolated within the fine bins.</li>
+ *
+ * </ul>
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class StatisticsAccumulator {
+
+  // Constants
+  // ---------
+
+  /** The number of fine histogram bins. */
+  private static final int FINE_BINS = 65536;
+
+  // Variables
+  // ---------
+
+  /** The scaling factor and offset, or null for none. */
+  private double[] scaling;
+
+  /** The lookup table, or null for none. */
+  private double[] lookup;
+
+  /** The missing value flag, true if there is a missing value. */
+  private boolean hasMissing;
+
+  /** The missing value for integer data. */
+  private long missingLong;
+
+  /** The missing value for floating-point data. */
+  private double missingDouble;
+
+  /** The unsigned flag, true if the data values are unsigned. */
+  private boolean isUnsigned;
+
+  /** The data class of the raw values. */
+  private Class dataClass;
+
+  /** The exact flag, true if each fine bin holds one raw value. */
+  private boolean isExact;
+
+  /** The fine histogram counts. */
+  private long[] counts;
+
+  /** The total number of values accumulated, including invalid data. */
+  private long values;
+
+  /** The number of valid values for inexact data. */
+  private long valid;
+
+  /** The minimum and maximum valid values for inexact data. */
+  private double min, max;
+
+  /** The shift and shifted sums of values and squares for inexact data. */
+  private double shift, sum, sumSquares;
+
+  /** The invalid flag, true if the statistics can no longer be computed. */
+  private boolean isInvalid;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new accumulator for a variable.
+   *
+   * @param var the variable whose data will be accumulated.  The
+   * scaling, missing value, unsigned flag, and lookup table of the
+   * variable are used to convert raw values to data values.
+   */
+  public StatisticsAccumulator (
+    DataVariable var
+  ) {
+
+    scaling = var.getScaling();
+    lookup = var.lookup;
+    isUnsigned = var.getUnsigned();
+    dataClass = var.getDataClass();
+    Object missing = var.getMissing();
+    hasMissing = (missing instanceof Number);
+    if (hasMissing) {
+      missingLong = ((Number) missing).longValue();
+      missingDouble = ((Number) missing).doubleValue();
+    } // if
+
+    isExact = (dataClass.equals (Byte.TYPE) || dataClass.equals (Short.TYPE));
+    if (lookup != null && !isExact) isInvalid = true;
+    counts = new long[FINE_BINS];
+    min = Double.POSITIVE_INFINITY;
+    max = Double.NEGATIVE_INFINITY;
+    shift = Double.NaN;
+
+  } // StatisticsAccumulator constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Marks the statistics as invalid, for example if the same data
+   * values would be accumulated more than once.
+   */
+  public synchronized void invalidate () { isInvalid = true; }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Determines if the accumulated statistics are still valid. */
+  public synchronized boolean isValid () { return (!isInvalid); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Adds a number of invalid values to the total count, for example
+   * values that were never written and so hold the missing value.
+   *
+   * @param count the number of invalid values to add.
+   */
+  public synchronized void addInvalid (long count) { values += count; }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Converts a data value to its fine bin. */
+  private static int getKey (
+    double value
+  ) {
+
+    /**
+     * Flipping the sign bit of positive floats and all the bits of
+     * negative floats gives integers that sort in the same order as the
+     * float values when compared as unsigned.
+     */
+    int bits = Float.floatToRawIntBits ((float) value);
+    int ordered = (bits < 0 ? ~bits : bits | 0x80000000);
+
+    return (ordered >>> 16);
+
+  } // getKey
+
+  ////////////////////////////////////////////////////////////
+
+  /** Converts an ordered integer back to a float value. */
+  private static float getOrderedFloat (
+    int ordered
+  ) {
+
+    int bits = (ordered < 0 ? ordered & 0x7fffffff : ~ordered);
+    return (Float.intBitsToFloat (bits));
+
+  } // getOrderedFloat
+
+  ////////////////////////////////////////////////////////////
+
+  /** Adds a valid data value for inexact data. */
+  private void addValue (
+    double value
+  ) {
+
+    if (valid == 0) shift = value;
+    valid++;
+    if (value < min) min = value;
+    if (value > max) max = value;
+    double diff = value - shift;
+    sum += diff;
+    sumSquares += diff*diff;
+    counts[getKey (value)]++;
+
+  } // addValue
+
+  ////////////////////////////////////////////////////////////
+
+  /** Scales a raw value to a data value. */
+  private double scale (
+    double raw
+  ) {
+
+    if (scaling == null) return (raw);
+    else return ((raw - scaling[1])*scaling[0]);
+
+  } // scale
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Accumulates a block of raw data values.
+   *
+   * @param data the raw data array, with the same data class as the
+   * variable.
+   */
+  public void accumulate (
+    Object data
+  ) {
+
+    accumulate (data, 0, 1, Array.getLength (data));
+
+  } // accumulate
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Accumulates a strided run of raw data values from a block, for
+   * example every nth value of a row segment.
+   *
+   * @param data the raw data array, with the same data class as the
+   * variable.
+   * @param offset the index of the first value to accumulate.
+   * @param stride the index increment between values.
+   * @param count the number of values to accumulate.
+   *
+   * @since 3.7.0
+   */
+  public synchronized void accumulate (
+    Object data,
+    int offset,
+    int stride,
+    int count
+  ) {
+
+    values += count;
+    if (isInvalid) return;
+    int end = offset + count*stride;
+
+    // Count exact raw values
+    // ----------------------
+    /**
+     * The fine bin for exact data is the unsigned bit pattern of the
+     * raw value.  The bins are converted to data values once at the
+     * end.
+     */
+    if (data instanceof byte[]) {
+      byte[] array = (byte[]) data;
+      for (int i = offset; i < end; i += stride) {
+        if (hasMissing && array[i] == missingLong) continue;
+        counts[array[i] & 0xff]++;
+      } // for
+    } // if
+    else if (data instanceof short[]) {
+      short[] array = (short[]) data;
+      for (int i = offset; i < end; i += stride) {
+        if (hasMissing && array[i] == missingLong) continue;
+        counts[array[i] & 0xffff]++;
+      } // for
+    } // else if
+
+    // Add other values
+    // ----------------
+    else if (data instanceof int[]) {
+      int[] array = (int[]) data;
+      for (int i = offset; i < end; i += stride) {
+        if (hasMissing && array[i] == missingLong) continue;
+        addValue (scale (isUnsigned ? array[i] & 0xffffffffL : array[i]));
+      } // for
+    } // else if
+    else if (data instanceof long[]) {
+      long[] array = (long[]) data;
+      for (int i = offset; i < end; i += stride) {
+        if (hasMissing && array[i] == missingLong) continue;
+        addValue (scale (array[i]));
+      } // for
+    } // else if
+    else if (data instanceof float[]) {
+      float[] array = (float[]) data;
+      for (int i = offset; i < end; i += stride) {
+        float raw = array[i];
+        if (Float.isNaN (raw) || (hasMissing && raw == missingDouble)) continue;
+        double value = scale (raw);
+        if (!Double.isNaN (value)) addValue (value);
+      } // for
+    } // else if
+    else if (data instanceof double[]) {
+      double[] array = (double[]) data;
+      for (int i = offset; i < end; i += stride) {
+        double raw = array[i];
+        if (Double.isNaN (raw) || (hasMissing && raw == missingDouble)) continue;
+        double value = scale (raw);
+        if (!Double.isNaN (value)) addValue (value);
+      } // for
+    } // else if
+    else {
+      isInvalid = true;
+    } // else
+
+  } // accumulate
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Merges the values accumulated by another accumulator into this
+   * one, so that blocks may be accumulated separately in parallel and
+   * combined at the end without contending for a single accumulator.
+   *
+   * @param other the other accumulator, created for the same variable.
+   *
+   * @since 3.7.0
+   */
+  public void merge (
+    StatisticsAccumulator other
+  ) {
+
+    synchronized (other) {
+      synchronized (this) {
+
+        values += other.values;
+        if (other.isInvalid) isInvalid = true;
+        if (isInvalid) return;
+        for (int key = 0; key < FINE_BINS; key++) counts[key] += other.counts[key];
+
+        /**
+         * The other sums are relative to the other shift, so they are
+         * moved to this shift using sum (x - a) = sum (x - b) + n (b - a).
+         */
+        if (other.valid != 0) {
+          if (valid == 0) shift = other.shift;
+          double delta = other.shift - shift;
+          sumSquares += other.sumSquares + 2*delta*other.sum + other.valid*delta*delta;
+          sum += other.sum + other.valid*delta;
+          valid += other.valid;
+          min = Math.min (min, other.min);
+          max = Math.max (max, other.max);
+        } // if
+
+      } // synchronized
+    } // synchronized
+
+  } // merge
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the data value for an exact fine bin. */
+  private double getExactValue (
+    int key
+  ) {
+
+    int raw;
+    if (dataClass.equals (Byte.TYPE)) raw = (isUnsigned ? key : (byte) key);
+    else raw = (isUnsigned ? key : (short) key);
+
+    double value;
+    if (lookup != null) value = (raw >= 0 && raw < lookup.length ? lookup[raw] : Double.NaN);
+    else value = scale (raw);
+
+    return (value);
+
+  } // getExactValue
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the data value at a rank in the sorted valid values, by
+   * interpolating within the fine bin that contains the rank.
+   */
+  private static double getRankValue (
+    long rank,
+    int bins,
+    double[] low,
+    double[] high,
+    long[] binCounts
+  ) {
+
+    long before = 0;
+    for (int i = 0; i < bins; i++) {
+      if (rank < before + binCounts[i]) {
+        double weight = (rank - before + 0.5) / binCounts[i];
+        return (low[i] + weight*(high[i] - low[i]));
+      } // if
+      before += binCounts[i];
+    } // for
+
+    return (high[bins-1]);
+
+  } // getRankValue
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the statistics for the data accumulated so far.
+   *
+   * @return the statistics, or null if the statistics are invalid.
+   */
+  public synchronized Statistics getStatistics () {
+
+    if (isInvalid) return (null);
+
+    // Create list of occupied bins
+    // ----------------------------
+    int bins = 0;
+    for (int key = 0; key < FINE_BINS; key++) if (counts[key] != 0) bins++;
+    double[] low = new double[bins];
+    double[] high = new double[bins];
+    long[] binCounts = new long[bins];
+    int bin = 0;
+    for (int key = 0; key < FINE_BINS; key++) {
+      if (counts[key] == 0) continue;
+      if (isExact) {
+        low[bin] = high[bin] = getExactValue (key);
+      } // if
+      else {
+        low[bin] = getOrderedFloat (key << 16);
+        high[bin] = getOrderedFloat ((key << 16) | 0xffff);
+      } // else
+      binCounts[bin] = counts[key];
+      bin++;
+    } // for
+
+    // Compute exact moments
+    // ---------------------
+    long validCount = valid;
+    double dataMin = min, dataMax = max, dataShift = shift;
+    double dataSum = sum, dataSumSquares = sumSquares;
+    if (isExact) {
+      validCount = 0;
+      for (int i = 0; i < bins; i++) {
+        double value = low[i];
+        if (Double.isNaN (value)) { binCounts[i] = 0; continue; }
+        if (validCount == 0) dataShift = value;
+        validCount += binCounts[i];
+        dataMin = Math.min (dataMin, value);
+        dataMax = Math.max (dataMax, value);
+        double diff = value - dataShift;
+        dataSum += binCounts[i]*diff;
+        dataSumSquares += binCounts[i]*diff*diff;
+      } // for
+    } // if
+
+    // Sort bins by value
+    // ------------------
+    /**
+     * Inexact bins are already in value order.  Exact bins are in raw
+     * value order, which is reversed by a negative scaling factor and
+     * scrambled by signed data and lookup tables.
+     */
+    if (isExact) {
+      Integer[] order = new Integer[bins];
+      for (int i = 0; i < bins; i++) order[i] = i;
+      final double[] keys = low;
+      Arrays.sort (order, new Comparator<Integer>() {
+        public int compare (Integer a, Integer b) {
+          return (Double.compare (keys[a], keys[b]));
+        } // compare
+      });
+      double[] sortedValues = new double[bins];
+      long[] sortedCounts = new long[bins];
+      for (int i = 0; i < bins; i++) {
+        sortedValues[i] = keys[order[i]];
+        sortedCounts[i] = binCounts[order[i]];
+      } // for
+      low = sortedValues;
+      high = sortedValues;
+      binCounts = sortedCounts;
+    } // if
+
+    // Clamp bin ranges to data range
+    // ------------------------------
+    else {
+      for (int i = 0; i < bins; i++) {
+        if (!(low[i] >= dataMin)) low[i] = dataMin;
+        if (!(high[i] <= dataMax)) high[i] = dataMax;
+        if (high[i] < low[i]) high[i] = low[i];
+      } // for
+    } // else
+
+    // Check for zero or one valid value
+    // ---------------------------------
+    int totalValues = (int) Math.min (values, Integer.MAX_VALUE);
+    int totalValid = (int) Math.min (validCount, Integer.MAX_VALUE);
+    if (validCount == 0) {
+      return (new Statistics (totalValues, 0, Double.NaN, Double.NaN,
+        Double.NaN, Double.NaN, Double.NaN, Double.NaN, null, null));
+    } // if
+    double mean = dataShift + dataSum/validCount;
+    if (validCount == 1) {
+      double[] percentiles = new double[Statistics.PERCENTILE_LEVELS.length];
+      Arrays.fill (percentiles, mean);
+      return (new Statistics (totalValues, 1, mean, mean, mean, 0, 0, mean,
+        percentiles, null));
+    } // if
+
+    // Compute standard and average deviation
+    // --------------------------------------
+    double variance = (dataSumSquares - dataSum*dataSum/validCount) / (validCount-1);
+    double stdev = Math.sqrt (Math.max (variance, 0));
+    double asum = 0;
+    for (int i = 0; i < bins; i++) {
+      if (binCounts[i] != 0) asum += binCounts[i]*Math.abs ((low[i] + high[i])/2 - mean);
+    } // for
+    double adev = asum/validCount;
+
+    // Compute percentiles
+    // -------------------
+    double[] percentiles = new double[Statistics.PERCENTILE_LEVELS.length];
+    double median = Double.NaN;
+    for (int i = 0; i <= percentiles.length; i++) {
+      double level = (i < percentiles.length ? Statistics.PERCENTILE_LEVELS[i] : 50);
+      double rank = level/100 * (validCount-1);
+      long lower = (long) Math.floor (rank);
+      long upper = Math.min (lower+1, validCount-1);
+      double lowerValue = getRankValue (lower, bins, low, high, binCounts);
+      double upperValue = (upper == lower ? lowerValue :
+        getRankValue (upper, bins, low, high, binCounts));
+      double value = lowerValue + (rank - lower)*(upperValue - lowerValue);
+      if (i < percentiles.length) percentiles[i] = value;
+      else median = value;
+    } // for
+
+    // Compute histogram
+    // -----------------
+    /**
+     * Each fine bin is spread over the histogram bins that it overlaps
+     * in proportion to the overlap.  Exact fine bins are placed in
+     * whole, using the same computation as the normal statistics.
+     */
+    int histBins = Statistics.HISTOGRAM_BINS;
+    double binWidth = (dataMax - dataMin)/histBins;
+    double[] histCounts = new double[histBins];
+    for (int i = 0; i < bins; i++) {
+      if (binCounts[i] == 0) continue;
+      if (high[i] == low[i] || binWidth == 0) {
+        int index = (int) ((low[i] - dataMin) / binWidth);
+        histCounts[Math.max (0, Math.min (index, histBins-1))] += binCounts[i];
+      } // if
+      else {
+        int first = Math.max (0, (int) ((low[i] - dataMin) / binWidth));
+        int last = Math.min (histBins-1, (int) ((high[i] - dataMin) / binWidth));
+        double range = high[i] - low[i];
+        for (int j = first; j <= last; j++) {
+          double start = Math.max (low[i], dataMin + j*binWidth);
+          double end = Math.min (high[i], dataMin + (j+1)*binWidth);
+          if (end > start) histCounts[j] += binCounts[i]*(end - start)/range;
+        } // for
+      } // else
+    } // for
+    int[] histogram = new int[histBins];
+    for (int i = 0; i < histBins; i++)
+      histogram[i] = (int) Math.round (histCounts[i]);
+
+    return (new Statistics (totalValues, totalValid, dataMin, dataMax, mean,
+      stdev, adev, median, percentiles, histogram));
+
+  } // getStatistics
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets statistics for an array of values using the normal constructor. */
+  private static Statistics getReference (
+    final double[] data
+  ) {
+
+    return (new Statistics (new DataIterator () {
+        private int index = 0;
+        public double nextDouble () { return (data[index++]); }
+        public void reset () { index = 0; }
+        public boolean hasNext () { return (index < data.length); }
+        public void remove () { throw new UnsupportedOperationException(); }
+        public Double next () { return (Double.valueOf (nextDouble())); }
+      }));
+
+  } // getReference
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (StatisticsAccumulator.class);
+
+    // ------------------------->
+
+    logger.test ("exact statistics");
+
+    int rows = 200, cols = 300;
+    short[] shortData = new short[rows*cols];
+    double[] scaling = new double[] {-0.01, 50};
+    for (int i = 0; i < shortData.length; i++) {
+      shortData[i] = (short) (Math.sin (i*0.001)*3000 + (i%17)*10);
+      if (i%31 == 0) shortData[i] = Short.MIN_VALUE;
+    } // for
+    Grid grid = new Grid ("test", "test", "celsius", rows, cols, shortData,
+      new java.text.DecimalFormat ("0.00"), scaling, Short.valueOf (Short.MIN_VALUE));
+
+    StatisticsAccumulator accumulator = new StatisticsAccumulator (grid);
+    for (int i = 0; i < rows; i += 64) {
+      int count = Math.min (64, rows-i);
+      accumulator.accumulate (grid.getData (new int[] {i, 0}, new int[] {count, cols}));
+    } // for
+    Statistics stats = accumulator.getStatistics();
+
+    double[] values = new double[shortData.length];
+    for (int i = 0; i < values.length; i++) values[i] = grid.getValue (i);
+    Statistics expected = getReference (values);
+
+    assert (stats.getValues() == expected.getValues());
+    assert (stats.getValid() == expected.getValid());
+    assert (stats.getMin() == expected.getMin());
+    assert (stats.getMax() == expected.getMax());
+    assert (Math.abs (stats.getMean() - expected.getMean()) < 1e-9);
+    assert (Math.abs (stats.getStdev() - expected.getStdev()) < 1e-9);
+    assert (Math.abs (stats.getAdev() - expected.getAdev()) < 1e-9);
+    assert (Math.abs (stats.getMedian() - expected.getMedian()) < 1e-9);
+    for (double level : Statistics.PERCENTILE_LEVELS)
+      assert (Math.abs (stats.getPercentile (level) - expected.getPercentile (level)) < 1e-9);
+    for (int i = 0; i < Statistics.HISTOGRAM_BINS; i++) {
+      double value = expected.getMin() + (i+0.5)*(expected.getMax() - expected.getMin())/Statistics.HISTOGRAM_BINS;
+      assert (stats.getCount (value) == expected.getCount (value));
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("inexact statistics");
+
+    float[] floatData = new float[rows*cols];
+    for (int i = 0; i < floatData.length; i++) {
+      floatData[i] = (float) (Math.cos (i*0.0007)*12 + 15 + (i%13)*0.01);
+      if (i%29 == 0) floatData[i] = Float.NaN;
+    } // for
+    grid = new Grid ("test", "test", "celsius", rows, cols, floatData,
+      new java.text.DecimalFormat ("0.00"), null, Float.valueOf (Float.NaN));
+    accumulator = new StatisticsAccumulator (grid);
+    accumulator.accumulate (floatData);
+    stats = accumulator.getStatistics();
+    for (int i = 0; i < values.length; i++) values[i] = grid.getValue (i);
+    expected = getReference (values);
+
+    assert (stats.getValid() == expected.getValid());
+    assert (stats.getMin() == expected.getMin());
+    assert (stats.getMax() == expected.getMax());
+    assert (Math.abs (stats.getMean() - expected.getMean()) < 1e-6);
+    assert (Math.abs (stats.getStdev() - expected.getStdev()) < 1e-6);
+    double tolerance = expected.getMax() * Math.pow (2, -7);
+    assert (Math.abs (stats.getMedian() - expected.getMedian()) < tolerance);
+    for (double level : Statistics.PERCENTILE_LEVELS)
+      assert (Math.abs (stats.getPercentile (level) - expected.getPercentile (level)) < tolerance);
+    assert (Math.abs (stats.getAdev() - expected.getAdev()) < tolerance);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("attributes");
+
+    Map<String, Object> map = new HashMap<String, Object>();
+    map.put ("units", "celsius");
+    stats.putAttributes (map);
+    Statistics restored = Statistics.fromAttributes (map);
+    assert (restored.getValid() == stats.getValid());
+    assert (restored.getMedian() == stats.getMedian());
+    assert (restored.getPercentile (37) == stats.getPercentile (37));
+    assert (restored.getCount (stats.getMean()) == stats.getCount (stats.getMean()));
+
+    map.put ("stats_valid", new int[] {stats.getValid()});
+    assert (Statistics.fromAttributes (map).getValid() == stats.getValid());
+    Statistics.removeAttributes (map);
+    assert (map.size() == 1);
+    assert (Statistics.fromAttributes (map) == null);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("strided accumulate and merge");
+
+    StatisticsAccumulator first = new StatisticsAccumulator (grid);
+    StatisticsAccumulator second = new StatisticsAccumulator (grid);
+    first.accumulate (floatData, 0, 2, floatData.length/2);
+    second.accumulate (floatData, 1, 2, floatData.length/2);
+    first.merge (second);
+    Statistics merged = first.getStatistics();
+    assert (merged.getValues() == stats.getValues());
+    assert (merged.getValid() == stats.getValid());
+    assert (merged.getMin() == stats.getMin());
+    assert (merged.getMax() == stats.getMax());
+    assert (Math.abs (merged.getMean() - stats.getMean()) < 1e-9);
+    assert (Math.abs (merged.getStdev() - stats.getStdev()) < 1e-9);
+    assert (merged.getMedian() == stats.getMedian());
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("invalidate");
+
+    accumulator.invalidate();
+    assert (!accumulator.isValid());
+    assert (accumulator.getStatistics() == null);
+
+    logger.passed();
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // StatisticsAccumulator class
+
+////////////////////////////////////////////////////////////////////////
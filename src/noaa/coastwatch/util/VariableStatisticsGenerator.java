@@ -73,7 +73,9 @@ public class VariableStatisticsGenerator {
    * automatically populated from the variable dimensions.
    *
    * @return the data statistics computed over the locations in the variable,
-   * subject to the location constraints.
+   * subject to the location constraints.  If the constraints cover the
+   * whole variable without an explicit stride and the variable has a
+   * stored statistics summary, the stored statistics are returned.
    *
    * @throws IllegalArgumentException if inconsistencies are found in the
    * constraints.
@@ -83,6 +85,20 @@ public class VariableStatisticsGenerator {
     DataLocationConstraints constraints
   ) {
 
+    // Check for stored statistics
+    // ---------------------------
+    /**
+     * A stored summary covers every value in the variable, so it
+     * answers any sampled request for the whole variable at no cost.
+     */
+    if ((constraints.start == null || constraints.end == null) &&
+      constraints.polygon == null && constraints.stride == null) {
+      Statistics stats = var.getStoredStatistics();
+      if (stats != null) return (stats);
+    } // if
+
+    // Compute statistics
+    // ------------------
     if (constraints.start == null || constraints.end == null)
       constraints.dims = var.getDimensions();
     DataLocationIterator locationIter = DataLocationIteratorFactory.getInstance().create (constraints);
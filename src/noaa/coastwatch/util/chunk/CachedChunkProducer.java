@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: CachedChunkProducer.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util.chunk;
+
+// Imports
+// -------
+import noaa.coastwatch.util.chunk.ChunkCache;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkProducer;
+import noaa.coastwatch.util.chunk.ChunkingScheme;
+import noaa.coastwatch.util.chunk.DataChunk;
+import noaa.coastwatch.util.chunk.DataChunk.DataType;
+
+/**
+ * The <code>CachedChunkProducer</code> class wraps another producer and
+ * gets its chunks through a {@link ChunkCache}.  The cache may be shared
+ * between many producers and threads, so that a chunk requested by more
+ * than one operation is produced only once while it stays in the cache.
+ * Chunks returned are shared, and must not be modified.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public class CachedChunkProducer implements ChunkProducer {
+
+  // Variables
+  // ---------
+
+  /** The producer of chunks to cache. */
+  private ChunkProducer producer;
+
+  /** The cache of chunks. */
+  private ChunkCache cache;
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new cached producer.
+   *
+   * @param producer the producer of chunks to cache.
+   * @param cache the cache to hold the chunks.
+   */
+  public CachedChunkProducer (
+    ChunkProducer producer,
+    ChunkCache cache
+  ) {
+
+    this.producer = producer;
+    this.cache = cache;
+
+  } // CachedChunkProducer constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the producer whose chunks are cached.
+   *
+   * @return the wrapped producer.
+   */
+  public ChunkProducer getProducer () { return (producer); }
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public DataType getExternalType() { return (producer.getExternalType()); }
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public DataChunk getChunk (ChunkPosition pos) { return (cache.getChunk (producer, pos)); }
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public ChunkingScheme getNativeScheme() { return (producer.getNativeScheme()); }
+
+  ////////////////////////////////////////////////////////////
+
+  @Override
+  public DataChunk getPrototypeChunk() { return (producer.getPrototypeChunk()); }
+
+  ////////////////////////////////////////////////////////////
+
+} // CachedChunkProducer class
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,309 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: ChunkCache.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util.chunk;
+
+// Imports
+// -------
+import java.lang.reflect.Array;
+import java.util.Arrays;
+import java.util.Iterator;
+import java.util.LinkedHashMap;
+import java.util.Map;
+import java.util.concurrent.ExecutionException;
+import java.util.concurrent.FutureTask;
+import noaa.coastwatch.util.chunk.ChunkPosition;
+import noaa.coastwatch.util.chunk.ChunkProducer;
+import noaa.coastwatch.util.chunk.DataChunk;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
+
+/**
+ * The <code>ChunkCache</code> class holds recently produced data chunks
+ * from any number of {@link ChunkProducer} objects, up to a maximum
+ * memory size.  The cache may be shared by multiple threads.  If more
+ * than one thread requests the same chunk at the same time, only one of
+ * them produces it and the others wait for the result.  When the cache
+ * is full, the least recently used chunks are removed first.  Chunks
+ * returned from the cache are shared, and must not be modified.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+@noaa.coastwatch.test.Testable
+public class ChunkCache {
+
+  // Variables
+  // ---------
+
+  /** The maximum memory for cached chunks in bytes. */
+  private long maxMemory;
+
+  /** The memory used by cached chunks in bytes. */
+  private long memory;
+
+  /** The map of key to chunk entry in access order. */
+  private Map<Key, Entry> entryMap = new LinkedHashMap<> (16, 0.75f, true);
+
+  /** The number of chunk requests. */
+  private long requests;
+
+  /** The number of chunks produced. */
+  private long loads;
+
+  ////////////////////////////////////////////////////////////
+
+  /** A key for a chunk from a producer. */
+  private static class Key {
+
+    private ChunkProducer producer;
+    private int[] start;
+
+    public Key (ChunkProducer producer, int[] start) {
+      this.producer = producer;
+      this.start = start.clone();
+    } // Key constructor
+
+    @Override
+    public boolean equals (Object obj) {
+      if (!(obj instanceof Key)) return (false);
+      Key key = (Key) obj;
+      return (producer == key.producer && Arrays.equals (start, key.start));
+    } // equals
+
+    @Override
+    public int hashCode () {
+      return (System.identityHashCode (producer)*31 + Arrays.hashCode (start));
+    } // hashCode
+
+  } // Key class
+
+  ////////////////////////////////////////////////////////////
+
+  /** An entry for a chunk that is loaded or being loaded. */
+  private static class Entry {
+
+    /** The task that produces the chunk. */
+    public FutureTask<DataChunk> task;
+
+    /** The chunk memory in bytes, or -1 if still loading. */
+    public long memory = -1;
+
+    public Entry (FutureTask<DataChunk> task) { this.task = task; }
+
+  } // Entry class
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new empty cache.
+   *
+   * @param maxMemory the maximum memory to use for cached chunks in bytes.
+   */
+  public ChunkCache (
+    long maxMemory
+  ) {
+
+    this.maxMemory = maxMemory;
+
+  } // ChunkCache constructor
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets a chunk from the cache, or from the producer if the chunk is
+   * not in the cache.
+   *
+   * @param producer the producer for the chunk.
+   * @param pos the chunk position.
+   *
+   * @return the chunk.
+   */
+  public DataChunk getChunk (
+    ChunkProducer producer,
+    ChunkPosition pos
+  ) {
+
+    // Find or create entry
+    // --------------------
+    Key key = new Key (producer, pos.start);
+    Entry entry;
+    boolean isLoader = false;
+    synchronized (this) {
+      requests++;
+      entry = entryMap.get (key);
+      if (entry == null) {
+        ChunkPosition loadPos = pos.clone();
+        entry = new Entry (new FutureTask<> (() -> producer.getChunk (loadPos)));
+        entryMap.put (key, entry);
+        isLoader = true;
+        loads++;
+      } // if
+    } // synchronized
+
+    // Produce chunk
+    // -------------
+    if (isLoader) entry.task.run();
+    DataChunk chunk;
+    try { chunk = entry.task.get(); }
+    catch (InterruptedException e) {
+      Thread.currentThread().interrupt();
+      throw new RuntimeException (e);
+    } // catch
+    catch (ExecutionException e) {
+      synchronized (this) {
+        if (entryMap.get (key) == entry) entryMap.remove (key);
+      } // synchronized
+      Throwable cause = e.getCause();
+      if (cause instanceof RuntimeException) throw (RuntimeException) cause;
+      throw new RuntimeException (cause);
+    } // catch
+
+    // Account for memory and remove old chunks
+    // ----------------------------------------
+    if (isLoader) {
+      synchronized (this) {
+        entry.memory = getMemory (chunk);
+        memory += entry.memory;
+        Iterator<Entry> iter = entryMap.values().iterator();
+        while (memory > maxMemory && iter.hasNext()) {
+          Entry oldEntry = iter.next();
+          if (oldEntry == entry || oldEntry.memory < 0) continue;
+          memory -= oldEntry.memory;
+          iter.remove();
+        } // while
+      } // synchronized
+    } // if
+
+    return (chunk);
+
+  } // getChunk
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the memory used by a chunk's primitive data in bytes. */
+  private static long getMemory (
+    DataChunk chunk
+  ) {
+
+    Object data = chunk.getPrimitiveData();
+    if (data == null) return (0);
+    Class type = data.getClass().getComponentType();
+    int bytes;
+    if (type.equals (Byte.TYPE)) bytes = 1;
+    else if (type.equals (Short.TYPE)) bytes = 2;
+    else if (type.equals (Integer.TYPE) || type.equals (Float.TYPE)) bytes = 4;
+    else bytes = 8;
+
+    return ((long) Array.getLength (data) * bytes);
+
+  } // getMemory
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of chunk requests made to the cache. */
+  public synchronized long getRequests () { return (requests); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the number of chunks produced by the cache. */
+  public synchronized long getLoads () { return (loads); }
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the memory used by the cached chunks in bytes. */
+  public synchronized long getMemoryUsage () { return (memory); }
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (ChunkCache.class);
+
+    // ------------------------->
+
+    logger.test ("getChunk");
+
+    ChunkingScheme scheme = new ChunkingScheme (new int[] {100, 100}, new int[] {10, 10});
+    int[] produced = new int[1];
+    ChunkProducer producer = new SyntheticIntChunkProducer (scheme, (row, col) -> row*100 + col) {
+      @Override
+      public DataChunk getChunk (ChunkPosition pos) {
+        synchronized (produced) { produced[0]++; }
+        return (super.getChunk (pos));
+      } // getChunk
+    };
+
+    ChunkCache cache = new ChunkCache (4*100*4);
+    ChunkPosition pos = scheme.getPosition (new int[] {25, 35});
+    DataChunk chunk = cache.getChunk (producer, pos);
+    assert (((int[]) chunk.getPrimitiveData())[0] == 2030);
+    assert (cache.getChunk (producer, pos.clone()) == chunk);
+    assert (produced[0] == 1);
+    assert (cache.getRequests() == 2 && cache.getLoads() == 1);
+    assert (cache.getMemoryUsage() == 400);
+
+    for (int i = 0; i < 5; i++)
+      cache.getChunk (producer, scheme.getPosition (new int[] {i*10, 0}));
+    assert (cache.getMemoryUsage() <= 4*400);
+    cache.getChunk (producer, pos);
+    assert (produced[0] == 7);
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("concurrent getChunk");
+
+    produced[0] = 0;
+    cache = new ChunkCache (Long.MAX_VALUE);
+    ChunkCache sharedCache = cache;
+    Thread[] threads = new Thread[8];
+    for (int t = 0; t < threads.length; t++) {
+      threads[t] = new Thread (() -> {
+        for (ChunkPosition p : scheme) sharedCache.getChunk (producer, p);
+      });
+      threads[t].start();
+    } // for
+    for (Thread thread : threads) thread.join();
+    assert (produced[0] == scheme.getTotalChunks());
+    assert (cache.getRequests() == threads.length*scheme.getTotalChunks());
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
+
+  ////////////////////////////////////////////////////////////
+
+} // ChunkCache class
+
+////////////////////////////////////////////////////////////////////////
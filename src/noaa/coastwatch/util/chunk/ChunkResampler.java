@@ -25,24 +25,44 @@ package noaa.coastwatch.util.chunk;
 
 // Imports
 // --------
+import java.util.Arrays;
 import noaa.coastwatch.util.chunk.DataChunk;
+import noaa.coastwatch.util.chunk.DataChunk.DataType;
 import noaa.coastwatch.util.chunk.ChunkProducer;
 import noaa.coastwatch.util.chunk.ChunkConsumer;
 import noaa.coastwatch.util.chunk.ChunkPosition;
 import noaa.coastwatch.util.chunk.ChunkingScheme;
 import noaa.coastwatch.util.chunk.ChunkDataFlagger;
+import noaa.coastwatch.util.chunk.ChunkDataAccessor;
+import noaa.coastwatch.util.chunk.ChunkDataModifier;
 import noaa.coastwatch.util.ResamplingMap;
+import noaa.coastwatch.util.ResamplingMapFactory;
+
+// Testing
+import noaa.coastwatch.test.TestLogger;
 
 /**
  * The <code>ChunkResampler</code> class performs a resampling of 2D chunk
  * data from a source coordinate system to a destination.  Each resampler
  * objects holds onto a coordinate {@link ResamplingMap} and the map is used to
  * resample data chunks from a {@link ChunkProducer} into a
- * {@link ChunkConsumer}.
+ * {@link ChunkConsumer}.  The source coordinates for a destination chunk
+ * are computed once and reused when resampling more than one variable at
+ * the same chunk position.<p>
+ *
+ * By default each destination value is copied from the nearest source
+ * value.  Values may instead be resampled with one of the interpolating
+ * or area-averaging {@link Kernel} types, as a weighted mean of the source
+ * values around the fractional source coordinates from the map.  The
+ * source coordinates and weights are computed once per destination chunk
+ * into a table.  Missing source values are left out and the remaining
+ * weights normalized, and a destination value is marked as missing if
+ * less than half of its total weight is valid.
  *
  * @author Peter Hollemans
  * @since 3.5.0
  */
+@noaa.coastwatch.test.Testable
 public class ChunkResampler {
 
   // Constants
@@ -52,12 +72,76 @@ public class ChunkResampler {
   private static int ROW = 0;
   private static int COL = 1;
 
+  /** The minimum fraction of kernel weight that must be valid. */
+  private static final double MIN_VALID_WEIGHT = 0.5;
+
+  /** The maximum area kernel footprint width in source pixels. */
+  private static final int MAX_FOOTPRINT = 32;
+
+  /** The cubic convolution parameter for bicubic kernels. */
+  private static final double CUBIC_A = -0.5;
+
+  /**
+   * The resampling kernel types.
+   *
+   * @since 3.7.0
+   */
+  public enum Kernel {
+
+    /** Copies the nearest source value. */
+    NEAREST,
+
+    /** Interpolates linearly between the four surrounding source values. */
+    BILINEAR,
+
+    /**
+     * Interpolates using cubic convolution between the sixteen surrounding
+     * source values.
+     */
+    BICUBIC,
+
+    /**
+     * Averages the source values under the destination pixel footprint,
+     * weighted by the area of overlap.  The footprint is estimated from
+     * the source coordinates of neighbouring destination pixels.
+     */
+    AREA
+
+  }; // Kernel enum
+
   // Variables
   // ---------
 
   /** The resampling map used for translating coordiantes. */
   private ResamplingMap map;
 
+  /** The destination chunk position of the mapped source coordinates. */
+  private ChunkPosition mappedPos;
+
+  /** The mapped source row for each destination value, or -1 if invalid. */
+  private int[] sourceRows;
+
+  /** The mapped source column for each destination value. */
+  private int[] sourceCols;
+
+  /** The kernel of the weight table. */
+  private Kernel weightKernel;
+
+  /** The destination chunk position of the weight table. */
+  private ChunkPosition weightPos;
+
+  /** The start of the weight table entries for each destination value. */
+  private int[] weightStart;
+
+  /** The source row of each weight table entry. */
+  private int[] weightRows;
+
+  /** The source column of each weight table entry. */
+  private int[] weightCols;
+
+  /** The weight of each weight table entry. */
+  private double[] weights;
+
   ////////////////////////////////////////////////////////////
 
   /**
@@ -78,7 +162,7 @@ public class ChunkResampler {
 
   /**
    * Resamples chunk data from a producer to a consumer at the specified chunk
-   * position.
+   * position using the nearest source value.
    *
    * @param producer the producer to use for requesting chunk data.
    * @param consumer the consumer to push resampled chunk data to.
@@ -94,6 +178,34 @@ public class ChunkResampler {
     ChunkPosition pos
   ) {
 
+    resample (producer, consumer, pos, Kernel.NEAREST);
+
+  } // resample
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Resamples chunk data from a producer to a consumer at the specified chunk
+   * position.
+   *
+   * @param producer the producer to use for requesting chunk data.
+   * @param consumer the consumer to push resampled chunk data to.
+   * @param pos the position within the chunking scheme of the consumer
+   * to create and push a resampled chunk.
+   * @param kernel the kernel to use for computing resampled values.
+   *
+   * @throws IllegalStateException if either the consumer or producer have no
+   * valid chunking scheme.
+   *
+   * @since 3.7.0
+   */
+  public void resample (
+    ChunkProducer producer,
+    ChunkConsumer consumer,
+    ChunkPosition pos,
+    Kernel kernel
+  ) {
+
     // Create destination chunk
     // ------------------------
     ChunkingScheme destScheme = consumer.getNativeScheme();
@@ -104,11 +216,44 @@ public class ChunkResampler {
     DataChunk protoChunk = consumer.getPrototypeChunk();
     DataChunk destChunk = protoChunk.blankCopyWithValues (values);
 
-    // Create array of source chunks
-    // -----------------------------
+    // Check source scheme
+    // -------------------
     ChunkingScheme sourceScheme = producer.getNativeScheme();
     if (sourceScheme == null)
       throw new IllegalStateException ("No chunking scheme found for source");
+
+    // Resample values
+    // ---------------
+    if (kernel == Kernel.NEAREST)
+      resampleNearest (producer, sourceScheme, destChunk, pos);
+    else
+      resampleKernel (producer, sourceScheme, destChunk, pos, kernel);
+
+    // Push the new reampled chunk to the consumer
+    // -------------------------------------------
+    consumer.putChunk (pos, destChunk);
+
+  } // resample
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Resamples chunk data by copying the nearest source values.
+   *
+   * @param producer the producer to use for requesting chunk data.
+   * @param sourceScheme the producer chunking scheme.
+   * @param destChunk the destination chunk to fill.
+   * @param pos the destination chunk position.
+   */
+  private void resampleNearest (
+    ChunkProducer producer,
+    ChunkingScheme sourceScheme,
+    DataChunk destChunk,
+    ChunkPosition pos
+  ) {
+
+    // Create array of source chunks
+    // -----------------------------
     int sourceTotalChunks = sourceScheme.getTotalChunks();
     DataChunk[] sourceChunks = new DataChunk[sourceTotalChunks];
     ChunkPosition[] sourcePositions = new ChunkPosition[sourceTotalChunks];
@@ -122,60 +267,51 @@ public class ChunkResampler {
 
     // Loop over each coordinate in destination chunk
     // ----------------------------------------------
-    int[] destCoords = new int[2];
+    mapCoords (pos);
     int[] sourceCoords = new int[2];
     ChunkDataCopier copier = new ChunkDataCopier();
-    int destIndex = 0;
+    int destValues = pos.length[ROW] * pos.length[COL];
 
-    for (int i = 0; i < pos.length[ROW]; i++) {
-      for (int j = 0; j < pos.length[COL]; j++) {
+    for (int destIndex = 0; destIndex < destValues; destIndex++) {
 
-        // Map dest to source
-        // ------------------
-        destCoords[ROW] = i + pos.start[ROW];
-        destCoords[COL] = j + pos.start[COL];
-        boolean isValid = map.map (destCoords, sourceCoords);
-
-        if (isValid) {
-
-          // Get source chunk
-          // ----------------
-          int sourceChunkRow = sourceCoords[ROW]/sourceChunkSize[ROW];
-          int sourceChunkCol = sourceCoords[COL]/sourceChunkSize[COL];
-          int sourceChunkIndex = sourceChunkRow*sourceChunkCols + sourceChunkCol;
-          DataChunk sourceChunk = sourceChunks[sourceChunkIndex];
-
-          // Read source chunk into cache if needed
-          // --------------------------------------
-          if (sourceChunk == null) {
-            ChunkPosition sourcePos = sourceScheme.getPosition (sourceCoords);
-            sourceChunk = producer.getChunk (sourcePos);
-            sourceChunks[sourceChunkIndex] = sourceChunk;
-            sourcePositions[sourceChunkIndex] = sourcePos;
-          } // if
+      sourceCoords[ROW] = sourceRows[destIndex];
+      sourceCoords[COL] = sourceCols[destIndex];
+
+      if (sourceCoords[ROW] != -1) {
 
-          // Copy data value into destination
-          // --------------------------------
-          ChunkPosition sourcePos = sourcePositions[sourceChunkIndex];
-          int sourceIndex =
-            (sourceCoords[ROW] - sourcePos.start[ROW])*sourcePos.length[COL] +
-            (sourceCoords[COL] - sourcePos.start[COL]);
-          copier.copyValue (sourceChunk, sourceIndex, destChunk, destIndex);
+        // Get source chunk
+        // ----------------
+        int sourceChunkRow = sourceCoords[ROW]/sourceChunkSize[ROW];
+        int sourceChunkCol = sourceCoords[COL]/sourceChunkSize[COL];
+        int sourceChunkIndex = sourceChunkRow*sourceChunkCols + sourceChunkCol;
+        DataChunk sourceChunk = sourceChunks[sourceChunkIndex];
 
+        // Read source chunk into cache if needed
+        // --------------------------------------
+        if (sourceChunk == null) {
+          ChunkPosition sourcePos = sourceScheme.getPosition (sourceCoords);
+          sourceChunk = producer.getChunk (sourcePos);
+          sourceChunks[sourceChunkIndex] = sourceChunk;
+          sourcePositions[sourceChunkIndex] = sourcePos;
         } // if
 
-        // Flag value as missing
-        // ---------------------
-        else {
-          isMissingArray[destIndex] = true;
-          isMissingUsed = true;
-        } //else
+        // Copy data value into destination
+        // --------------------------------
+        ChunkPosition sourcePos = sourcePositions[sourceChunkIndex];
+        int sourceIndex =
+          (sourceCoords[ROW] - sourcePos.start[ROW])*sourcePos.length[COL] +
+          (sourceCoords[COL] - sourcePos.start[COL]);
+        copier.copyValue (sourceChunk, sourceIndex, destChunk, destIndex);
 
-        // Increment index to next data value
-        // ----------------------------------
-        destIndex++;
+      } // if
+
+      // Flag value as missing
+      // ---------------------
+      else {
+        isMissingArray[destIndex] = true;
+        isMissingUsed = true;
+      } //else
 
-      } // for
     } // for
 
     // Flag missing values in chunk
@@ -186,11 +322,728 @@ public class ChunkResampler {
       destChunk.accept (flagger);
     } // if
 
-    // Push the new reampled chunk to the consumer
-    // -------------------------------------------
-    consumer.putChunk (pos, destChunk);
+  } // resampleNearest
 
-  } // resample
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Resamples chunk data by computing a weighted mean of source values
+   * from the weight table.
+   *
+   * @param producer the producer to use for requesting chunk data.
+   * @param sourceScheme the producer chunking scheme.
+   * @param destChunk the destination chunk to fill.
+   * @param pos the destination chunk position.
+   * @param kernel the kernel to use for weights.
+   */
+  private void resampleKernel (
+    ChunkProducer producer,
+    ChunkingScheme sourceScheme,
+    DataChunk destChunk,
+    ChunkPosition pos,
+    Kernel kernel
+  ) {
+
+    // Create arrays of source chunk data
+    // ----------------------------------
+    int sourceTotalChunks = sourceScheme.getTotalChunks();
+    ChunkDataAccessor[] sourceAccessors = new ChunkDataAccessor[sourceTotalChunks];
+    DataType[] sourceTypes = new DataType[sourceTotalChunks];
+    ChunkPosition[] sourcePositions = new ChunkPosition[sourceTotalChunks];
+    int[] sourceChunkSize = sourceScheme.getChunkSize();
+    int sourceChunkCols = sourceScheme.getChunkCount (COL);
+
+    // Create arrays of destination values
+    // -----------------------------------
+    int values = destChunk.getValues();
+    double[] valueArray = new double[values];
+    boolean[] isMissingArray = new boolean[values];
+    Arrays.fill (isMissingArray, true);
+
+    // Loop over each coordinate in destination chunk
+    // ----------------------------------------------
+    buildWeights (pos, kernel, sourceScheme.getDims());
+    int[] sourceCoords = new int[2];
+    int destValues = pos.length[ROW] * pos.length[COL];
+
+    for (int destIndex = 0; destIndex < destValues; destIndex++) {
+
+      double sum = 0;
+      double validWeight = 0;
+      double totalWeight = 0;
+
+      for (int entry = weightStart[destIndex]; entry < weightStart[destIndex+1]; entry++) {
+
+        // Get source chunk
+        // ----------------
+        sourceCoords[ROW] = weightRows[entry];
+        sourceCoords[COL] = weightCols[entry];
+        int sourceChunkRow = sourceCoords[ROW]/sourceChunkSize[ROW];
+        int sourceChunkCol = sourceCoords[COL]/sourceChunkSize[COL];
+        int sourceChunkIndex = sourceChunkRow*sourceChunkCols + sourceChunkCol;
+        ChunkDataAccessor accessor = sourceAccessors[sourceChunkIndex];
+
+        // Read source chunk into cache if needed
+        // --------------------------------------
+        if (accessor == null) {
+          ChunkPosition sourcePos = sourceScheme.getPosition (sourceCoords);
+          DataChunk sourceChunk = producer.getChunk (sourcePos);
+          accessor = new ChunkDataAccessor();
+          sourceChunk.accept (accessor);
+          sourceAccessors[sourceChunkIndex] = accessor;
+          sourceTypes[sourceChunkIndex] = sourceChunk.getExternalType();
+          sourcePositions[sourceChunkIndex] = sourcePos;
+        } // if
+
+        // Add weighted value
+        // ------------------
+        ChunkPosition sourcePos = sourcePositions[sourceChunkIndex];
+        int sourceIndex =
+          (sourceCoords[ROW] - sourcePos.start[ROW])*sourcePos.length[COL] +
+          (sourceCoords[COL] - sourcePos.start[COL]);
+        double weight = weights[entry];
+        totalWeight += weight;
+        if (!accessor.isMissingValue (sourceIndex)) {
+          double value = getValue (accessor, sourceTypes[sourceChunkIndex], sourceIndex);
+          if (!Double.isNaN (value)) {
+            sum += weight*value;
+            validWeight += weight;
+          } // if
+        } // if
+
+      } // for
+
+      // Normalize by valid weight
+      // -------------------------
+      if (totalWeight > 0 && validWeight >= MIN_VALID_WEIGHT*totalWeight) {
+        valueArray[destIndex] = sum/validWeight;
+        isMissingArray[destIndex] = false;
+      } // if
+
+    } // for
+
+    setValues (destChunk, valueArray, isMissingArray);
+
+  } // resampleKernel
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets a data value from an accessor as a double. */
+  private static double getValue (
+    ChunkDataAccessor accessor,
+    DataType type,
+    int index
+  ) {
+
+    double value;
+    switch (type) {
+    case BYTE: value = accessor.getByteValue (index); break;
+    case SHORT: value = accessor.getShortValue (index); break;
+    case INT: value = accessor.getIntValue (index); break;
+    case LONG: value = accessor.getLongValue (index); break;
+    case FLOAT: value = accessor.getFloatValue (index); break;
+    case DOUBLE: value = accessor.getDoubleValue (index); break;
+    default: throw new RuntimeException ("Unsupported chunk external type: " + type);
+    } // switch
+
+    return (value);
+
+  } // getValue
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Sets the data values in a chunk.  Integer values are rounded and
+   * clamped to the range of the chunk external type.
+   *
+   * @param chunk the chunk to modify.
+   * @param valueArray the values to set.
+   * @param isMissingArray the missing value flags.
+   */
+  private static void setValues (
+    DataChunk chunk,
+    double[] valueArray,
+    boolean[] isMissingArray
+  ) {
+
+    ChunkDataModifier modifier = new ChunkDataModifier();
+    DataType type = chunk.getExternalType();
+    int values = valueArray.length;
+    switch (type) {
+
+    case BYTE:
+      byte[] byteArray = new byte[values];
+      for (int i = 0; i < values; i++) {
+        if (!isMissingArray[i]) byteArray[i] = (byte) round (valueArray[i], Byte.MIN_VALUE, Byte.MAX_VALUE);
+      } // for
+      modifier.setByteData (byteArray);
+      modifier.setMissingData (isMissingArray);
+      break;
+
+    case SHORT:
+      short[] shortArray = new short[values];
+      for (int i = 0; i < values; i++) {
+        if (!isMissingArray[i]) shortArray[i] = (short) round (valueArray[i], Short.MIN_VALUE, Short.MAX_VALUE);
+      } // for
+      modifier.setShortData (shortArray);
+      modifier.setMissingData (isMissingArray);
+      break;
+
+    case INT:
+      int[] intArray = new int[values];
+      for (int i = 0; i < values; i++) {
+        if (!isMissingArray[i]) intArray[i] = (int) round (valueArray[i], Integer.MIN_VALUE, Integer.MAX_VALUE);
+      } // for
+      modifier.setIntData (intArray);
+      modifier.setMissingData (isMissingArray);
+      break;
+
+    case LONG:
+      long[] longArray = new long[values];
+      for (int i = 0; i < values; i++) {
+        if (!isMissingArray[i]) longArray[i] = round (valueArray[i], Long.MIN_VALUE, Long.MAX_VALUE);
+      } // for
+      modifier.setLongData (longArray);
+      modifier.setMissingData (isMissingArray);
+      break;
+
+    case FLOAT:
+      float[] floatArray = new float[values];
+      for (int i = 0; i < values; i++) {
+        floatArray[i] = (isMissingArray[i] ? Float.NaN : (float) valueArray[i]);
+      } // for
+      modifier.setFloatData (floatArray);
+      break;
+
+    case DOUBLE:
+      double[] doubleArray = new double[values];
+      for (int i = 0; i < values; i++) {
+        doubleArray[i] = (isMissingArray[i] ? Double.NaN : valueArray[i]);
+      } // for
+      modifier.setDoubleData (doubleArray);
+      break;
+
+    default: throw new RuntimeException ("Unsupported chunk external type: " + type);
+
+    } // switch
+
+    chunk.accept (modifier);
+
+  } // setValues
+
+  ////////////////////////////////////////////////////////////
+
+  /** Rounds a value and clamps it to a range. */
+  private static long round (
+    double value,
+    long min,
+    long max
+  ) {
+
+    return (Math.max (min, Math.min (max, Math.round (value))));
+
+  } // round
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Maps the destination coordinates in a chunk to source coordinates,
+   * unless already mapped for the same chunk position.
+   *
+   * @param pos the destination chunk position.
+   */
+  private void mapCoords (
+    ChunkPosition pos
+  ) {
+
+    if (mappedPos != null &&
+      Arrays.equals (mappedPos.start, pos.start) &&
+      Arrays.equals (mappedPos.length, pos.length)) return;
+
+    int destValues = pos.length[ROW] * pos.length[COL];
+    sourceRows = new int[destValues];
+    sourceCols = new int[destValues];
+    int[] destCoords = new int[2];
+    int[] sourceCoords = new int[2];
+    int destIndex = 0;
+
+    for (int i = 0; i < pos.length[ROW]; i++) {
+      for (int j = 0; j < pos.length[COL]; j++) {
+        destCoords[ROW] = i + pos.start[ROW];
+        destCoords[COL] = j + pos.start[COL];
+        if (map.map (destCoords, sourceCoords)) {
+          sourceRows[destIndex] = sourceCoords[ROW];
+          sourceCols[destIndex] = sourceCoords[COL];
+        } // if
+        else {
+          sourceRows[destIndex] = -1;
+        } // else
+        destIndex++;
+      } // for
+    } // for
+
+    mappedPos = pos.clone();
+
+  } // mapCoords
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Builds the table of source coordinates and weights for each
+   * destination value in a chunk, unless already built for the same
+   * kernel and chunk position.  Source coordinates outside the source
+   * dimensions are left out of the table.
+   *
+   * @param pos the destination chunk position.
+   * @param kernel the kernel to use for weights.
+   * @param sourceDims the source dimensions as [rows, cols].
+   */
+  private void buildWeights (
+    ChunkPosition pos,
+    Kernel kernel,
+    int[] sourceDims
+  ) {
+
+    if (weightPos != null && weightKernel == kernel &&
+      Arrays.equals (weightPos.start, pos.start) &&
+      Arrays.equals (weightPos.length, pos.length)) return;
+
+    // Map destination to fractional source coordinates
+    // ------------------------------------------------
+    int destRows = pos.length[ROW];
+    int destCols = pos.length[COL];
+    int destValues = destRows * destCols;
+    double[] rowCoords = new double[destValues];
+    double[] colCoords = new double[destValues];
+    boolean[] isValid = new boolean[destValues];
+    int[] destCoords = new int[2];
+    double[] sourceCoords = new double[2];
+    int destIndex = 0;
+
+    for (int i = 0; i < destRows; i++) {
+      for (int j = 0; j < destCols; j++) {
+        destCoords[ROW] = i + pos.start[ROW];
+        destCoords[COL] = j + pos.start[COL];
+        isValid[destIndex] = map.map (destCoords, sourceCoords);
+        rowCoords[destIndex] = sourceCoords[ROW];
+        colCoords[destIndex] = sourceCoords[COL];
+        destIndex++;
+      } // for
+    } // for
+
+    // Create weight table
+    // -------------------
+    int capacity = destValues * (kernel == Kernel.BICUBIC ? 16 : 4);
+    weightStart = new int[destValues+1];
+    weightRows = new int[capacity];
+    weightCols = new int[capacity];
+    weights = new double[capacity];
+    int entries = 0;
+
+    double[] rowWeights = new double[MAX_FOOTPRINT+2];
+    double[] colWeights = new double[MAX_FOOTPRINT+2];
+    double[] half = new double[] {0.5, 0.5};
+
+    for (destIndex = 0; destIndex < destValues; destIndex++) {
+
+      weightStart[destIndex] = entries;
+      if (!isValid[destIndex]) continue;
+
+      // Compute weights along each axis
+      // -------------------------------
+      if (kernel == Kernel.AREA) {
+        getFootprint (destIndex/destCols, destIndex%destCols, destRows, destCols,
+          rowCoords, colCoords, isValid, half);
+      } // if
+      double row = rowCoords[destIndex];
+      double col = colCoords[destIndex];
+      int firstRow = getFirstIndex (kernel, row, half[ROW]);
+      int firstCol = getFirstIndex (kernel, col, half[COL]);
+      int rowCount = getAxisWeights (kernel, row, half[ROW], firstRow, rowWeights);
+      int colCount = getAxisWeights (kernel, col, half[COL], firstCol, colWeights);
+
+      // Grow table if needed
+      // --------------------
+      if (entries + rowCount*colCount > weights.length) {
+        capacity = Math.max (capacity*2, entries + rowCount*colCount);
+        weightRows = Arrays.copyOf (weightRows, capacity);
+        weightCols = Arrays.copyOf (weightCols, capacity);
+        weights = Arrays.copyOf (weights, capacity);
+      } // if
+
+      // Add source entries
+      // ------------------
+      for (int r = 0; r < rowCount; r++) {
+        int sourceRow = firstRow + r;
+        if (sourceRow < 0 || sourceRow >= sourceDims[ROW] || rowWeights[r] == 0) continue;
+        for (int c = 0; c < colCount; c++) {
+          int sourceCol = firstCol + c;
+          if (sourceCol < 0 || sourceCol >= sourceDims[COL] || colWeights[c] == 0) continue;
+          weightRows[entries] = sourceRow;
+          weightCols[entries] = sourceCol;
+          weights[entries] = rowWeights[r]*colWeights[c];
+          entries++;
+        } // for
+      } // for
+
+    } // for
+    weightStart[destValues] = entries;
+
+    weightKernel = kernel;
+    weightPos = pos.clone();
+
+  } // buildWeights
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Estimates the footprint of a destination pixel in source coordinates
+   * from the source coordinates of its neighbours in the chunk.
+   *
+   * @param i the destination row in the chunk.
+   * @param j the destination column in the chunk.
+   * @param destRows the destination rows in the chunk.
+   * @param destCols the destination columns in the chunk.
+   * @param rowCoords the source row for each destination value.
+   * @param colCoords the source column for each destination value.
+   * @param isValid the valid mapping flag for each destination value.
+   * @param half the footprint half width along the source [row, col]
+   * axes, in the range [0.5..MAX_FOOTPRINT/2] (modified).
+   */
+  private static void getFootprint (
+    int i,
+    int j,
+    int destRows,
+    int destCols,
+    double[] rowCoords,
+    double[] colCoords,
+    boolean[] isValid,
+    double[] half
+  ) {
+
+    /**
+     * The destination pixel covers a parallelogram in source space
+     * spanned by the change in source coordinates along each destination
+     * axis.  We use the extent of the parallelogram along each source
+     * axis, estimated with central differences where both neighbours are
+     * valid and one-sided differences otherwise.
+     */
+    double rowSpan = 0;
+    double colSpan = 0;
+    int center = i*destCols + j;
+    for (int axis = 0; axis < 2; axis++) {
+      int di = (axis == ROW ? 1 : 0);
+      int dj = (axis == COL ? 1 : 0);
+      int prev = -1, next = -1;
+      if (i-di >= 0 && j-dj >= 0 && isValid[(i-di)*destCols + j-dj])
+        prev = (i-di)*destCols + j-dj;
+      if (i+di < destRows && j+dj < destCols && isValid[(i+di)*destCols + j+dj])
+        next = (i+di)*destCols + j+dj;
+      int steps = (prev != -1 ? 1 : 0) + (next != -1 ? 1 : 0);
+      if (steps != 0) {
+        int a = (prev != -1 ? prev : center);
+        int b = (next != -1 ? next : center);
+        rowSpan += Math.abs (rowCoords[b] - rowCoords[a]) / steps;
+        colSpan += Math.abs (colCoords[b] - colCoords[a]) / steps;
+      } // if
+    } // for
+
+    half[ROW] = Math.min (Math.max (rowSpan/2, 0.5), MAX_FOOTPRINT/2.0);
+    half[COL] = Math.min (Math.max (colSpan/2, 0.5), MAX_FOOTPRINT/2.0);
+
+  } // getFootprint
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the first source pixel index used by a kernel along an axis.
+   *
+   * @param kernel the kernel type.
+   * @param coord the fractional source coordinate.
+   * @param half the footprint half width for area kernels.
+   *
+   * @return the first source pixel index.
+   */
+  private static int getFirstIndex (
+    Kernel kernel,
+    double coord,
+    double half
+  ) {
+
+    int first;
+    switch (kernel) {
+    case BILINEAR: first = (int) Math.floor (coord); break;
+    case BICUBIC: first = (int) Math.floor (coord) - 1; break;
+    case AREA: first = (int) Math.floor (coord - half + 0.5); break;
+    default: throw new IllegalArgumentException ("Unsupported kernel " + kernel);
+    } // switch
+
+    return (first);
+
+  } // getFirstIndex
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the weights used by a kernel along an axis.
+   *
+   * @param kernel the kernel type.
+   * @param coord the fractional source coordinate.
+   * @param half the footprint half width for area kernels.
+   * @param first the first source pixel index.
+   * @param axisWeights the weights for successive source pixels starting
+   * at the first index (modified).
+   *
+   * @return the number of weights.
+   */
+  private static int getAxisWeights (
+    Kernel kernel,
+    double coord,
+    double half,
+    int first,
+    double[] axisWeights
+  ) {
+
+    int count;
+    switch (kernel) {
+
+    case BILINEAR:
+      axisWeights[1] = coord - first;
+      axisWeights[0] = 1 - axisWeights[1];
+      count = 2;
+      break;
+
+    case BICUBIC:
+      for (int k = 0; k < 4; k++) axisWeights[k] = getCubicWeight (coord - (first + k));
+      count = 4;
+      break;
+
+    case AREA:
+      double min = coord - half;
+      double max = coord + half;
+      count = (int) Math.floor (max + 0.5) - first + 1;
+      for (int k = 0; k < count; k++) {
+        double pixel = first + k;
+        axisWeights[k] = Math.max (0, Math.min (pixel + 0.5, max) - Math.max (pixel - 0.5, min));
+      } // for
+      break;
+
+    default: throw new IllegalArgumentException ("Unsupported kernel " + kernel);
+
+    } // switch
+
+    return (count);
+
+  } // getAxisWeights
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the cubic convolution weight at a distance from a pixel. */
+  private static double getCubicWeight (
+    double x
+  ) {
+
+    x = Math.abs (x);
+    double weight;
+    if (x <= 1)
+      weight = ((CUBIC_A + 2)*x - (CUBIC_A + 3))*x*x + 1;
+    else if (x < 2)
+      weight = ((CUBIC_A*x - 5*CUBIC_A)*x + 8*CUBIC_A)*x - 4*CUBIC_A;
+    else
+      weight = 0;
+
+    return (weight);
+
+  } // getCubicWeight
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates a test map factory from source coordinate functions. */
+  private static ResamplingMapFactory getTestFactory (
+    java.util.function.DoubleBinaryOperator rowFunction,
+    java.util.function.DoubleBinaryOperator colFunction
+  ) {
+
+    return ((start, length) -> {
+      int values = length[ROW]*length[COL];
+      int[] rowMap = new int[values];
+      int[] colMap = new int[values];
+      float[] rowCoords = new float[values];
+      float[] colCoords = new float[values];
+      for (int i = 0; i < length[ROW]; i++) {
+        for (int j = 0; j < length[COL]; j++) {
+          int index = i*length[COL] + j;
+          rowCoords[index] = (float) rowFunction.applyAsDouble (start[ROW]+i, start[COL]+j);
+          colCoords[index] = (float) colFunction.applyAsDouble (start[ROW]+i, start[COL]+j);
+          rowMap[index] = Math.round (rowCoords[index]);
+          colMap[index] = Math.round (colCoords[index]);
+        } // for
+      } // for
+      return (new ResamplingMap (start, length, rowMap, colMap, rowCoords, colCoords));
+    });
+
+  } // getTestFactory
+
+  ////////////////////////////////////////////////////////////
+
+  /** Creates a test producer of double data from a function. */
+  private static ChunkProducer getTestProducer (
+    ChunkingScheme scheme,
+    java.util.function.DoubleBinaryOperator function
+  ) {
+
+    DataChunk protoChunk = DataChunkFactory.getInstance().create (new double[0], false, Double.NaN, null);
+    return (new ChunkProducer() {
+      public DataType getExternalType() { return (DataType.DOUBLE); }
+      public DataChunk getChunk (ChunkPosition pos) {
+        double[] data = new double[pos.length[ROW]*pos.length[COL]];
+        for (int i = 0; i < pos.length[ROW]; i++) {
+          for (int j = 0; j < pos.length[COL]; j++)
+            data[i*pos.length[COL] + j] = function.applyAsDouble (pos.start[ROW]+i, pos.start[COL]+j);
+        } // for
+        return (DataChunkFactory.getInstance().create (data, false, Double.NaN, null));
+      } // getChunk
+      public ChunkingScheme getNativeScheme() { return (scheme); }
+      public DataChunk getPrototypeChunk() { return (protoChunk.blankCopy()); }
+    });
+
+  } // getTestProducer
+
+  ////////////////////////////////////////////////////////////
+
+  /** Resamples test data to a double array. */
+  private static double[] resampleTest (
+    ChunkProducer producer,
+    ResamplingMapFactory factory,
+    int[] destDims,
+    Kernel kernel
+  ) {
+
+    ChunkingScheme destScheme = new ChunkingScheme (destDims, new int[] {8, 8});
+    double[] result = new double[destDims[ROW]*destDims[COL]];
+    ChunkConsumer consumer = new ChunkConsumer() {
+      public void putChunk (ChunkPosition pos, DataChunk chunk) {
+        double[] data = (double[]) chunk.getPrimitiveData();
+        for (int i = 0; i < pos.length[ROW]; i++) {
+          for (int j = 0; j < pos.length[COL]; j++)
+            result[(pos.start[ROW]+i)*destDims[COL] + pos.start[COL]+j] = data[i*pos.length[COL] + j];
+        } // for
+      } // putChunk
+      public ChunkingScheme getNativeScheme() { return (destScheme); }
+      public DataChunk getPrototypeChunk() {
+        return (DataChunkFactory.getInstance().create (new double[0], false, Double.NaN, null));
+      } // getPrototypeChunk
+    };
+
+    for (ChunkPosition pos : destScheme) {
+      ChunkResampler resampler = new ChunkResampler (factory.create (pos.start, pos.length));
+      resampler.resample (producer, consumer, pos, kernel);
+    } // for
+
+    return (result);
+
+  } // resampleTest
+
+  ////////////////////////////////////////////////////////////
+
+  /** Gets the mean of the nearest integer over a range by sampling. */
+  private static double getRoundedMean (
+    double min,
+    double max
+  ) {
+
+    int samples = 100000;
+    double sum = 0;
+    for (int i = 0; i < samples; i++)
+      sum += Math.round (min + (i + 0.5)*(max - min)/samples);
+
+    return (sum/samples);
+
+  } // getRoundedMean
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Tests this class.
+   *
+   * @param argv the array of command line parameters.
+   */
+  public static void main (String[] argv) throws Exception {
+
+    TestLogger logger = TestLogger.getInstance();
+    logger.startClass (ChunkResampler.class);
+
+    ChunkingScheme sourceScheme = new ChunkingScheme (new int[] {60, 60}, new int[] {16, 16});
+    ChunkProducer producer = getTestProducer (sourceScheme, (row, col) -> 3*row + 2*col);
+    int[] destDims = new int[] {20, 20};
+
+    // ------------------------->
+
+    logger.test ("nearest, bilinear, and bicubic on linear field");
+
+    ResamplingMapFactory factory = getTestFactory ((i, j) -> 5.2 + 0.37*i, (i, j) -> 3.7 + 0.41*j);
+    double[] nearest = resampleTest (producer, factory, destDims, Kernel.NEAREST);
+    double[] bilinear = resampleTest (producer, factory, destDims, Kernel.BILINEAR);
+    double[] bicubic = resampleTest (producer, factory, destDims, Kernel.BICUBIC);
+    for (int i = 0; i < destDims[ROW]; i++) {
+      for (int j = 0; j < destDims[COL]; j++) {
+        int index = i*destDims[COL] + j;
+        float row = (float) (5.2 + 0.37*i);
+        float col = (float) (3.7 + 0.41*j);
+        assert (nearest[index] == 3*Math.round (row) + 2*Math.round (col));
+        assert (Math.abs (bilinear[index] - (3*row + 2*col)) < 1e-3);
+        assert (Math.abs (bicubic[index] - (3*row + 2*col)) < 1e-3);
+      } // for
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("area mean on linear field");
+
+    factory = getTestFactory ((i, j) -> 3*i + 1, (i, j) -> 3*j + 1);
+    double[] area = resampleTest (producer, factory, destDims, Kernel.AREA);
+    for (int i = 0; i < destDims[ROW]; i++) {
+      for (int j = 0; j < destDims[COL]; j++) {
+        double sum = 0;
+        for (int row = 3*i; row < 3*i+3; row++) {
+          for (int col = 3*j; col < 3*j+3; col++) sum += 3*row + 2*col;
+        } // for
+        assert (area[i*destDims[COL] + j] == sum/9);
+      } // for
+    } // for
+
+    factory = getTestFactory ((i, j) -> 2.5*i + 1.3, (i, j) -> 2.5*j + 1.3);
+    area = resampleTest (producer, factory, destDims, Kernel.AREA);
+    for (int i = 0; i < destDims[ROW]; i++) {
+      for (int j = 0; j < destDims[COL]; j++) {
+        float row = (float) (2.5*i + 1.3);
+        float col = (float) (2.5*j + 1.3);
+        double expected = 3*getRoundedMean (row - 1.25, row + 1.25) +
+          2*getRoundedMean (col - 1.25, col + 1.25);
+        assert (Math.abs (area[i*destDims[COL] + j] - expected) < 1e-3);
+      } // for
+    } // for
+
+    logger.passed();
+
+    // ------------------------->
+
+    logger.test ("missing value weight normalization");
+
+    producer = getTestProducer (sourceScheme,
+      (row, col) -> (row == 10 && col == 10 ? Double.NaN : 3*row + 2*col));
+    factory = getTestFactory ((i, j) -> 10.25 + 0.5*i, (i, j) -> 10.25 + 0.5*i);
+    bilinear = resampleTest (producer, factory, new int[] {2, 1}, Kernel.BILINEAR);
+    assert (Double.isNaN (bilinear[0]));
+    assert (Math.abs (bilinear[1] - 54.0) < 1e-6);
+
+    logger.passed();
+
+    // ------------------------->
+
+  } // main
 
   ////////////////////////////////////////////////////////////
 
@@ -28,6 +28,8 @@ package noaa.coastwatch.util.chunk;
 import java.util.NoSuchElementException;
 import java.util.Iterator;
 import java.util.Arrays;
+import java.util.ArrayList;
+import java.util.List;
 import noaa.coastwatch.util.chunk.ChunkPosition;
 
 /**
@@ -295,6 +297,82 @@ public class ChunkingScheme implements Iterable<ChunkPosition> {
 
   ////////////////////////////////////////////////////////////
 
+  /**
+   * Gets the chunk positions in this scheme in an order that keeps
+   * successive chunks close together in space.  For two dimensions, the
+   * chunks are ordered along a Hilbert curve, so that chunks processed
+   * at about the same time tend to be neighbours in both dimensions.
+   * Other dimensions use the iteration order.
+   *
+   * @return the list of chunk positions.
+   *
+   * @since 3.7.0
+   */
+  public List<ChunkPosition> getLocalityOrder () {
+
+    List<ChunkPosition> positions = new ArrayList<> (totalChunks);
+    forEach (positions::add);
+    if (dims.length != 2) return (positions);
+
+    // Compute curve index of each chunk
+    // ---------------------------------
+    int side = 1;
+    while (side < chunkCounts[0] || side < chunkCounts[1]) side *= 2;
+    long[] keys = new long[totalChunks];
+    for (int i = 0; i < totalChunks; i++) {
+      ChunkPosition pos = positions.get (i);
+      int row = pos.start[0] / chunkSize[0];
+      int col = pos.start[1] / chunkSize[1];
+      keys[i] = (getHilbertIndex (side, col, row) << 32) | i;
+    } // for
+
+    // Sort positions by curve index
+    // -----------------------------
+    Arrays.sort (keys);
+    List<ChunkPosition> ordered = new ArrayList<> (totalChunks);
+    for (long key : keys) ordered.add (positions.get ((int) key));
+
+    return (ordered);
+
+  } // getLocalityOrder
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Gets the distance along a Hilbert curve for a square grid.
+   *
+   * @param side the grid side length, a power of two.
+   * @param x the x coordinate in the range [0..side-1].
+   * @param y the y coordinate in the range [0..side-1].
+   *
+   * @return the distance along the curve.
+   */
+  private static long getHilbertIndex (
+    int side,
+    int x,
+    int y
+  ) {
+
+    long index = 0;
+    for (int s = side/2; s > 0; s /= 2) {
+      int rx = ((x & s) > 0 ? 1 : 0);
+      int ry = ((y & s) > 0 ? 1 : 0);
+      index += (long) s * s * ((3 * rx) ^ ry);
+      if (ry == 0) {
+        if (rx == 1) {
+          x = side-1 - x;
+          y = side-1 - y;
+        } // if
+        int t = x; x = y; y = t;
+      } // if
+    } // for
+
+    return (index);
+
+  } // getHilbertIndex
+
+  ////////////////////////////////////////////////////////////
+
 } // ChunkingScheme class
 
 ////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,68 @@
+////////////////////////////////////////////////////////////////////////
+/*
+
+     File: DirectChunkSink.java
+   Author: Peter Hollemans
+     Date: 2026/10/17
+
+  CoastWatch Software Library and Utilities
+  Copyright (c) 2026 National Oceanic and Atmospheric Administration
+  All rights reserved.
+
+  Developed by: CoastWatch / OceanWatch
+                Center for Satellite Applications and Research
+                http://coastwatch.noaa.gov
+
+  For conditions of distribution and use, see the accompanying
+  license.txt file.
+
+*/
+////////////////////////////////////////////////////////////////////////
+
+// Package
+// -------
+package noaa.coastwatch.util.chunk;
+
+// Imports
+// -------
+import java.io.IOException;
+
+/**
+ * The <code>DirectChunkSink</code> interface is implemented by grids that
+ * can store the data for a chunk directly, bypassing any cache.  Chunk
+ * consumers use the interface to write chunks that coincide with the
+ * grid's own storage chunks concurrently from multiple threads, without
+ * locking the grid.
+ *
+ * @author Peter Hollemans
+ * @since 3.7.0
+ */
+public interface DirectChunkSink {
+
+  /**
+   * Determines if a data subset coincides exactly with one storage chunk.
+   *
+   * @param start the subset starting [row, column].
+   * @param length the subset dimensions [rows, columns].
+   *
+   * @return true if the subset is exactly one chunk, or false if not.
+   */
+  public boolean isChunkAligned (int[] start, int[] length);
+
+  /**
+   * Writes the data for one chunk directly to storage.  This method may
+   * be called concurrently from multiple threads for different chunks.
+   *
+   * @param data the chunk data array of unscaled values.
+   * @param start the chunk starting [row, column].
+   * @param length the chunk dimensions [rows, columns].
+   *
+   * @throws IOException if an error occurred writing the chunk data.
+   * @throws IllegalArgumentException if the subset is not chunk-aligned.
+   */
+  public void putChunkData (Object data, int[] start, int[] length)
+    throws IOException;
+
+} // DirectChunkSink interface
+
+////////////////////////////////////////////////////////////////////////
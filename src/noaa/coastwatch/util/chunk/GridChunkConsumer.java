@@ -28,7 +28,9 @@ package noaa.coastwatch.util.chunk;
 import noaa.coastwatch.util.Grid;
 import noaa.coastwatch.util.chunk.ChunkingScheme;
 import noaa.coastwatch.util.chunk.DataChunkFactory;
+import noaa.coastwatch.util.chunk.DirectChunkSink;
 import noaa.coastwatch.io.tile.TilingScheme;
+import java.io.IOException;
 import java.lang.reflect.Array;
 
 /**
@@ -104,9 +106,23 @@ public class GridChunkConsumer implements ChunkConsumer {
 
     int[] start = new int[] {(int) pos.start[0], (int) pos.start[1]};
     int[] length = new int[] {(int) pos.length[0], (int) pos.length[1]};
-    synchronized (grid) {
-      grid.setData (chunk.getPrimitiveData(), start, length);
-    } // synchronized
+
+    /**
+     * Some grids such as Zarr arrays store each chunk independently, so
+     * chunks that match the grid chunks can be written concurrently
+     * without locking the grid.
+     */
+    if (grid instanceof DirectChunkSink && 
+      ((DirectChunkSink) grid).isChunkAligned (start, length)) {
+      try { ((DirectChunkSink) grid).putChunkData (chunk.getPrimitiveData(), start, length); }
+      catch (IOException e) { throw new RuntimeException (e); }
+    } // if
+
+    else {
+      synchronized (grid) {
+        grid.setData (chunk.getPrimitiveData(), start, length);
+      } // synchronized
+    } // else
 
   } // putChunk
 
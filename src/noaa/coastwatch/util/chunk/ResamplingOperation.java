@@ -33,6 +33,7 @@ import noaa.coastwatch.util.chunk.ChunkProducer;
 import noaa.coastwatch.util.chunk.ChunkConsumer;
 import noaa.coastwatch.util.chunk.ChunkOperation;
 import noaa.coastwatch.util.chunk.ChunkResampler;
+import noaa.coastwatch.util.chunk.ChunkResampler.Kernel;
 import noaa.coastwatch.util.ResamplingMapFactory;
 import noaa.coastwatch.util.ResamplingMap;
 
@@ -44,7 +45,9 @@ import noaa.coastwatch.util.ResamplingMap;
  * consumers' chunkiung scheme.  Consumers are all assumed to have the same
  * chunking scheme, so that resampling can be performed on each chunk in the
  * consumers using the same resampling map.  If a given position in the consumer
- * scheme has no valid resampling map, no operation is performed.
+ * scheme has no valid resampling map, no operation is performed.  Each
+ * producer may be resampled with its own {@link Kernel}, or by default
+ * using the nearest source value.
  *
  * @author Peter Hollemans
  * @since 3.5.0
@@ -61,6 +64,9 @@ public class ResamplingOperation implements ChunkOperation {
 
   /** The factory for creating resampling maps. */
   private ResamplingMapFactory mapFactory;
+
+  /** The list of kernels for each producer, or null for nearest. */
+  private List<Kernel> kernelList;
   
   ////////////////////////////////////////////////////////////
 
@@ -90,6 +96,39 @@ public class ResamplingOperation implements ChunkOperation {
     this.mapFactory = mapFactory;
 
   } // ResamplingOperation const
+
+  ////////////////////////////////////////////////////////////
+
+  /**
+   * Creates a new chunk computation from the specified components using
+   * a resampling kernel for each producer.
+   *
+   * @param producerList the list of producers that supply chunks to remap.
+   * @param consumerList the list of corresponding consumers that handle the
+   * remapped chunks, must be the same length as the producer list.
+   * @param mapFactory the factory that creates instances of maps for coordinate
+   * mapping.
+   * @param kernelList the list of kernels used to resample each producer,
+   * must be the same length as the producer list.
+   *
+   * @throws IllegalStateException if the consumer, producer, and kernel
+   * lists have different sizes.
+   *
+   * @since 3.7.0
+   */
+  public ResamplingOperation (
+    List<ChunkProducer> producerList,
+    List<ChunkConsumer> consumerList,
+    ResamplingMapFactory mapFactory,
+    List<Kernel> kernelList
+  ) {
+
+    this (producerList, consumerList, mapFactory);
+    if (kernelList.size() != producerList.size())
+      throw new IllegalStateException ("Kernel and producer lists have different sizes");
+    this.kernelList = kernelList;
+
+  } // ResamplingOperation const
   
   ////////////////////////////////////////////////////////////
 
@@ -102,7 +141,8 @@ public class ResamplingOperation implements ChunkOperation {
       ChunkResampler resampler = new ChunkResampler (map);
       int count = producerList.size();
       for (int i = 0; i < count; i++) {
-        resampler.resample (producerList.get (i), consumerList.get (i), pos);
+        Kernel kernel = (kernelList == null ? Kernel.NEAREST : kernelList.get (i));
+        resampler.resample (producerList.get (i), consumerList.get (i), pos, kernel);
       } // for
 
       LOGGER.fine ("Finished resampling at pos = " + pos);